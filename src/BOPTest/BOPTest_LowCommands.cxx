@@ -15,12 +15,17 @@
 
 
 #include <BOPTest.hxx>
+#include <BOPTest_Objects.hxx>
 #include <BOPTools_AlgoTools2D.hxx>
 #include <BRep_GCurve.hxx>
 #include <BRep_TEdge.hxx>
 #include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepClass3d_SolidBatchClassifier.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepClass_FaceClassifier.hxx>
+#include <BRepTools.hxx>
 #include <DBRep.hxx>
 #include <Draw.hxx>
 #include <DrawTrSurf.hxx>
@@ -48,8 +53,10 @@ static
                                       Standard_Real& Last);
 
 static  Standard_Integer bclassify   (Draw_Interpretor& , Standard_Integer , const char** );
+static  Standard_Integer bclassifygrid (Draw_Interpretor& , Standard_Integer , const char** );
 static  Standard_Integer b2dclassify (Draw_Interpretor& , Standard_Integer , const char** );
 static  Standard_Integer b2dclassifx (Draw_Interpretor& , Standard_Integer , const char** );
+static  Standard_Integer b2dclassifygrid (Draw_Interpretor& , Standard_Integer , const char** );
 static  Standard_Integer bhaspc      (Draw_Interpretor& , Standard_Integer , const char** );
 
 //=======================================================================
@@ -65,6 +72,13 @@ static  Standard_Integer bhaspc      (Draw_Interpretor& , Standard_Integer , con
   const char* g = "BOPTest commands";
   theCommands.Add("bclassify"    , "use bclassify Solid Point [Tolerance=1.e-7]",
                   __FILE__, bclassify   , g);
+  theCommands.Add("bclassifygrid", "use bclassifygrid Solid NbX NbY NbZ [Tolerance=1.e-7] [-exact] [-compare]\n"
+    "Classifies the regular grid of NbX*NbY*NbZ points in the bounding box of the Solid\n"
+    "using the batch classifier and prints the numbers of points in each state.\n"
+    "The parallel mode is defined by brunparallel command.\n"
+    "-exact: forbids the use of triangulation, all points are classified by exact algorithm;\n"
+    "-compare: compares the states with the ones of the point by point classification.",
+                  __FILE__, bclassifygrid, g);
   theCommands.Add("b2dclassify"  , "use b2dclassify Face Point2d [Tol] [UseBox] [GapCheckTol]\n" 
     "Classify  the Point  Point2d  with  Tolerance <Tol> on the face described by <Face>.\n" 
     "<UseBox> == 1/0 (default <UseBox> = 0): switch on/off the use Bnd_Box in the classification.\n"
@@ -73,6 +87,13 @@ static  Standard_Integer bhaspc      (Draw_Interpretor& , Standard_Integer , con
                   __FILE__, b2dclassify , g);
   theCommands.Add("b2dclassifx"  , "use b2dclassifx Face Point2d [Tol] ",
                   __FILE__, b2dclassifx , g);
+  theCommands.Add("b2dclassifygrid", "use b2dclassifygrid Face NbU NbV [Tol] [-compare]\n"
+    "Classifies the regular grid of NbU*NbV 2d points in the UV bounds of the Face\n"
+    "using IntTools_FClass2d and prints the numbers of points in each state.\n"
+    "The parallel mode is defined by brunparallel command.\n"
+    "-compare: compares the states with the ones of the point by point classification\n"
+    "          checking all segments of the polygons of the wires.",
+                  __FILE__, b2dclassifygrid, g);
   theCommands.Add("bhaspc"       , "use bhaspc Edge Face [do]",
                   __FILE__, bhaspc      , g);
 }
@@ -117,6 +138,92 @@ Standard_Integer b2dclassifx (Draw_Interpretor& theDI,
 }
 //
 //=======================================================================
+//function : b2dclassifygrid
+//purpose  : 
+//=======================================================================
+Standard_Integer b2dclassifygrid (Draw_Interpretor& theDI,
+                                  Standard_Integer  theArgNb,
+                                  const char**      theArgVec)
+{
+  if (theArgNb < 4)  {
+    theDI.PrintHelp (theArgVec[0]);
+    return 1;
+  }
+
+  TopoDS_Shape aS = DBRep::Get (theArgVec[1]);
+  if (aS.IsNull())  {
+    theDI << " Null Shape is not allowed here\n";
+    return 1;
+  }
+  else if (aS.ShapeType() != TopAbs_FACE)  {
+    theDI << " Shape type must be FACE\n";
+    return 1;
+  }
+
+  const Standard_Integer aNbU = Draw::Atoi (theArgVec[2]);
+  const Standard_Integer aNbV = Draw::Atoi (theArgVec[3]);
+  if (aNbU < 1 || aNbV < 1)  {
+    theDI << " Number of points must be positive\n";
+    return 1;
+  }
+
+  const TopoDS_Face& aF = TopoDS::Face (aS);
+  Standard_Real aTol = BRep_Tool::Tolerance (aF);
+  Standard_Boolean toCompare = Standard_False;
+  for (Standard_Integer i = 4; i < theArgNb; ++i)  {
+    if (!strcmp (theArgVec[i], "-compare"))  {
+      toCompare = Standard_True;
+    }
+    else {
+      aTol = Draw::Atof (theArgVec[i]);
+    }
+  }
+
+  Standard_Real aUMin, aUMax, aVMin, aVMax;
+  BRepTools::UVBounds (aF, aUMin, aUMax, aVMin, aVMax);
+
+  // grid of points in the UV bounds
+  TColgp_Array1OfPnt2d aPoints (1, aNbU * aNbV);
+  Standard_Integer anInd = 1;
+  for (Standard_Integer i = 0; i < aNbU; ++i)  {
+    const Standard_Real aU = aUMin + (aUMax - aUMin) * (i + 0.5) / aNbU;
+    for (Standard_Integer j = 0; j < aNbV; ++j)  {
+      const Standard_Real aV = aVMin + (aVMax - aVMin) * (j + 0.5) / aNbV;
+      aPoints.SetValue (anInd++, gp_Pnt2d (aU, aV));
+    }
+  }
+
+  IntTools_FClass2d aClassifier (aF, aTol);
+  NCollection_Array1<TopAbs_State> aStates;
+  aClassifier.Perform (aPoints, aStates, Standard_True, BOPTest_Objects::RunParallel());
+
+  Standard_Integer aNbIn = 0, aNbOut = 0, aNbOn = 0, aNbUnknown = 0;
+  for (Standard_Integer i = aStates.Lower(); i <= aStates.Upper(); ++i)  {
+    switch (aStates (i)) {
+     case TopAbs_IN:  ++aNbIn;  break;
+     case TopAbs_OUT: ++aNbOut; break;
+     case TopAbs_ON:  ++aNbOn;  break;
+     default:         ++aNbUnknown; break;
+    }
+  }
+  theDI << "IN: " << aNbIn << " OUT: " << aNbOut
+        << " ON: " << aNbOn << " UNKNOWN: " << aNbUnknown << "\n";
+
+  if (toCompare)  {
+    // reference classifier without the index of the polygon segments
+    IntTools_FClass2d aRefClassifier (aF, aTol, Standard_False);
+
+    Standard_Integer aNbDiff = 0;
+    for (Standard_Integer i = aPoints.Lower(); i <= aPoints.Upper(); ++i)  {
+      if (aRefClassifier.Perform (aPoints (i)) != aStates (i))  {
+        ++aNbDiff;
+      }
+    }
+    theDI << "Different states: " << aNbDiff << "\n";
+  }
+  return 0;
+}
+//=======================================================================
 //function : b2dclassify
 //purpose  : 
 //=======================================================================
@@ -190,6 +297,103 @@ Standard_Integer bclassify (Draw_Interpretor& theDI,
   return 0;
 }
 
+//=======================================================================
+//function : bclassifygrid
+//purpose  : 
+//=======================================================================
+Standard_Integer bclassifygrid (Draw_Interpretor& theDI,
+                                Standard_Integer  theArgNb,
+                                const char**      theArgVec)
+{
+  if (theArgNb < 5)  {
+    theDI.PrintHelp (theArgVec[0]);
+    return 1;
+  }
+
+  TopoDS_Shape aS = DBRep::Get (theArgVec[1]);
+  if (aS.IsNull())  {
+    theDI << " Null Shape is not allowed\n";
+    return 1;
+  }
+  else if (aS.ShapeType() != TopAbs_SOLID)  {
+    theDI << " Shape type must be SOLID\n";
+    return 1;
+  }
+
+  const Standard_Integer aNbX = Draw::Atoi (theArgVec[2]);
+  const Standard_Integer aNbY = Draw::Atoi (theArgVec[3]);
+  const Standard_Integer aNbZ = Draw::Atoi (theArgVec[4]);
+  if (aNbX < 1 || aNbY < 1 || aNbZ < 1)  {
+    theDI << " Number of points must be positive\n";
+    return 1;
+  }
+
+  Standard_Real aTol = 1.e-7;
+  Standard_Boolean isExact = Standard_False, toCompare = Standard_False;
+  for (Standard_Integer i = 5; i < theArgNb; ++i)  {
+    if (!strcmp (theArgVec[i], "-exact"))  {
+      isExact = Standard_True;
+    }
+    else if (!strcmp (theArgVec[i], "-compare"))  {
+      toCompare = Standard_True;
+    }
+    else {
+      aTol = Draw::Atof (theArgVec[i]);
+    }
+  }
+
+  Bnd_Box aBox;
+  BRepBndLib::Add (aS, aBox);
+  Standard_Real aXMin, aYMin, aZMin, aXMax, aYMax, aZMax;
+  aBox.Get (aXMin, aYMin, aZMin, aXMax, aYMax, aZMax);
+
+  // grid of points in the bounding box
+  TColgp_Array1OfPnt aPoints (1, aNbX * aNbY * aNbZ);
+  Standard_Integer anInd = 1;
+  for (Standard_Integer i = 0; i < aNbX; ++i)  {
+    const Standard_Real aX = aXMin + (aXMax - aXMin) * (i + 0.5) / aNbX;
+    for (Standard_Integer j = 0; j < aNbY; ++j)  {
+      const Standard_Real aY = aYMin + (aYMax - aYMin) * (j + 0.5) / aNbY;
+      for (Standard_Integer k = 0; k < aNbZ; ++k)  {
+        const Standard_Real aZ = aZMin + (aZMax - aZMin) * (k + 0.5) / aNbZ;
+        aPoints.SetValue (anInd++, gp_Pnt (aX, aY, aZ));
+      }
+    }
+  }
+
+  BRepClass3d_SolidBatchClassifier aBC (aS);
+  aBC.SetRunParallel (BOPTest_Objects::RunParallel());
+  aBC.SetUseTriangulation (!isExact);
+  aBC.Perform (aPoints, aTol);
+
+  Standard_Integer aNbIn = 0, aNbOut = 0, aNbOn = 0, aNbUnknown = 0;
+  for (Standard_Integer i = aPoints.Lower(); i <= aPoints.Upper(); ++i)  {
+    switch (aBC.State (i)) {
+     case TopAbs_IN:  ++aNbIn;  break;
+     case TopAbs_OUT: ++aNbOut; break;
+     case TopAbs_ON:  ++aNbOn;  break;
+     default:         ++aNbUnknown; break;
+    }
+  }
+
+  theDI << "IN: " << aNbIn << " OUT: " << aNbOut
+        << " ON: " << aNbOn << " UNKNOWN: " << aNbUnknown << "\n";
+  theDI << "Exact classifications: " << aBC.NbExactClassifications() << "\n";
+
+  if (toCompare)  {
+    Standard_Integer aNbDiff = 0;
+    BRepClass3d_SolidClassifier aSC (aS);
+    for (Standard_Integer i = aPoints.Lower(); i <= aPoints.Upper(); ++i)  {
+      aSC.Perform (aPoints (i), aTol);
+      if (aSC.State() != aBC.State (i))  {
+        ++aNbDiff;
+      }
+    }
+    theDI << "Different states: " << aNbDiff << "\n";
+  }
+  return 0;
+}
+
 //=======================================================================
 //function : bhaspc
 //purpose  : 
@@ -29,6 +29,12 @@ class TopoDS_Shape;
 //! -   defining the construction of a duplicate shape,
 //! -   implementing the construction algorithm, and
 //! -   consulting the result.
+//!
+//! The geometry and the mesh of the sub-shapes can be copied in parallel
+//! (see SetRunParallel()); the topology is always copied sequentially.
+//! When the geometry is shared with the original shape (copyGeom is False),
+//! the copy must not be passed to the algorithms modifying the geometry
+//! in place, as the original shape would be modified as well.
 class BRepBuilderAPI_Copy  : public BRepBuilderAPI_ModifyShape
 {
 public:
@@ -64,6 +64,13 @@ public:
   //! of the initial shape.
   Standard_EXPORT virtual TopoDS_Shape ModifiedShape (const TopoDS_Shape& S) const;
 
+  //! Sets the flag of parallel evaluation of the new geometry
+  //! of the sub-shapes (see BRepTools_Modifier::SetRunParallel()).
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myModifier.SetRunParallel (theIsParallel); }
+
+  //! Returns the flag of parallel evaluation of the new geometry.
+  Standard_Boolean IsRunParallel() const { return myModifier.IsRunParallel(); }
+
 
 
 
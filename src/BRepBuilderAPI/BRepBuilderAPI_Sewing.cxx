@@ -76,6 +76,7 @@
 #include <gp_Vec.hxx>
 #include <Message_ProgressScope.hxx>
 #include <NCollection_UBTreeFiller.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_NoSuchObject.hxx>
@@ -1044,6 +1045,144 @@ void BRepBuilderAPI_Sewing::EvaluateAngulars(TopTools_SequenceOfShape& sequenceS
   }
 }
 
+//=======================================================================
+//function : sectionCurve
+//purpose  : internal use
+//           Returns the 3D curve of the section transformed by its location
+//=======================================================================
+static Standard_Boolean sectionCurve(const TopoDS_Edge& theSection,
+                                     Handle(Geom_Curve)& theCurve,
+                                     Standard_Real& theFirst,
+                                     Standard_Real& theLast)
+{
+  TopLoc_Location aLoc;
+  theCurve = BRep_Tool::Curve(theSection, aLoc, theFirst, theLast);
+  if (theCurve.IsNull()) return Standard_False;
+  if (!aLoc.IsIdentity()) {
+    theCurve = Handle(Geom_Curve)::DownCast(theCurve->Copy());
+    theCurve->Transform(aLoc.Transformation());
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : sectionPoints
+//purpose  : internal use
+//           Discretizes the curve uniformly by parameter and returns
+//           the length of the polygon
+//=======================================================================
+static Standard_Real sectionPoints(const Handle(Geom_Curve)& theCurve,
+                                   const Standard_Real theFirst,
+                                   const Standard_Real theLast,
+                                   TColgp_Array1OfPnt& thePnts)
+{
+  const Standard_Integer npt = thePnts.Length();
+  Standard_Real T, deltaT = (theLast - theFirst) / (npt - 1);
+  Standard_Real aLenSec2 = 0.;
+  for (Standard_Integer j = 1; j <= npt; j++) {
+    // Uniform parameter on curve
+    if (j == 1) T = theFirst;
+    else if (j == npt) T = theLast;
+    else T = theFirst + (j - 1) * deltaT;
+    // Take point on curve
+    thePnts(j) = theCurve->Value(T);
+    if (j > 1)
+      aLenSec2 += thePnts(j).SquareDistance(thePnts(j-1));
+  }
+  return sqrt(aLenSec2);
+}
+
+//! Number of points for curve discretization
+static const Standard_Integer THE_NB_SECTION_POINTS = 8;
+
+//=======================================================================
+//function : EvaluateDistance
+//purpose  : internal use
+//=======================================================================
+Standard_Boolean BRepBuilderAPI_Sewing::EvaluateDistance(const TColgp_Array1OfPnt& ptsRef,
+                                                         const Handle(Geom_Curve)& c3dRef,
+                                                         const Standard_Real firstRef,
+                                                         const Standard_Real lastRef,
+                                                         const Standard_Real lenRef,
+                                                         const TopoDS_Edge& sec,
+                                                         SectionDistance& theDistance) const
+{
+  const Standard_Integer npt = ptsRef.Length();
+  Handle(Geom_Curve) c3d;
+  Standard_Real first, last;
+  if (!sectionCurve(sec, c3d, first, last)) return Standard_False;
+
+  TColgp_Array1OfPnt ptsSec(1, npt);
+  //protection to avoid merging with small sections
+  const Standard_Real aLenSec = sectionPoints(c3d, first, last, ptsSec);
+
+  Standard_Real dist, distFor = -1.0, distRev = -1.0;
+  Standard_Real aMinDist = Precision::Infinite();
+  Standard_Integer j, nbFound = 0;
+  for (j = 1; j <= npt; j++) {
+    const gp_Pnt& pt = ptsSec(j);
+    // To evaluate mutual orientation and distance
+    dist = pt.Distance(ptsRef(j));
+    if(aMinDist > dist)
+      aMinDist = dist;
+    if (distFor < dist) distFor = dist;
+    dist = pt.Distance(ptsRef(npt-j+1));
+
+    if(aMinDist > dist)
+      aMinDist = dist;
+    if (distRev < dist) distRev = dist;
+
+    // Check that point lays between vertices of reference curve
+    const gp_Pnt &p11 = ptsRef(1);
+    const gp_Pnt &p12 = ptsRef(npt);
+    const gp_Vec aVec1(pt,p11);
+    const gp_Vec aVec2(pt,p12);
+    const gp_Vec aVecRef(p11,p12);
+    if((aVecRef * aVec1) * (aVecRef * aVec2) < 0.)
+      nbFound++;
+  }
+
+  theDistance.Length = aLenSec;
+  // Record mutual orientation
+  const Standard_Boolean isForward = (distFor < distRev); //szv debug: <=
+  theDistance.IsForward = isForward;
+  theDistance.Distance = -1.0;
+  theDistance.MinDistance = Precision::Infinite();
+
+  dist = (isForward? distFor : distRev);
+  if (dist < myTolerance && nbFound >= npt * 0.5)
+  {
+    theDistance.Distance = dist;
+    theDistance.MinDistance = aMinDist;
+  }
+  else
+  {
+    nbFound = 0, aMinDist = Precision::Infinite(), dist = -1;
+    TColgp_Array1OfPnt arrProj(1, npt);
+    TColStd_Array1OfReal arrDist(1, npt), arrPara(1, npt);
+    if( lenRef >= aLenSec)
+      ProjectPointsOnCurve(ptsSec,c3dRef,firstRef,lastRef,arrDist,arrPara,arrProj,Standard_False);
+    else
+      ProjectPointsOnCurve(ptsRef,c3d,first,last,arrDist,arrPara,arrProj,Standard_False);
+    for( j = 1; j <= npt; j++ )
+    {
+      if(arrDist(j) < 0.)
+        continue;
+      if(dist < arrDist(j))
+        dist = arrDist(j);
+      if( aMinDist > arrDist(j))
+        aMinDist = arrDist(j);
+      nbFound++;
+    }
+    if(nbFound > 1)
+    {
+      theDistance.Distance = dist;
+      theDistance.MinDistance = aMinDist;
+    }
+  }
+  return Standard_True;
+}
+
 //=======================================================================
 // function : EvaluateDistances
 // purpose  : internal use
@@ -1061,121 +1200,37 @@ void BRepBuilderAPI_Sewing::EvaluateDistances(TopTools_SequenceOfShape& sequence
   tabDst.Init(-1.0);
   arrLen.Init(0.);
   tabMinDist.Init(Precision::Infinite());
-  const Standard_Integer npt = 8; // Number of points for curve discretization
-  TColgp_Array1OfPnt ptsRef(1, npt), ptsSec(1, npt);
+  TColgp_Array1OfPnt ptsRef(1, THE_NB_SECTION_POINTS);
 
-  Standard_Integer i, j, lengSec = sequenceSec.Length();
-  TColgp_SequenceOfPnt seqSec;
+  Standard_Integer i, lengSec = sequenceSec.Length();
 
+  // reading of the reference edge
   Handle(Geom_Curve) c3dRef;
   Standard_Real firstRef=0., lastRef=0.;
-  
-  for (i = indRef; i <= lengSec; i++) {
-
-    // reading of the edge (attention for the first one: reference)
-    const TopoDS_Edge& sec = TopoDS::Edge(sequenceSec(i));
-
-    TopLoc_Location loc;
-    Standard_Real first, last;
-    Handle(Geom_Curve) c3d = BRep_Tool::Curve(sec, loc, first, last);
-    if (c3d.IsNull()) continue;
-    if (!loc.IsIdentity()) {
-      c3d = Handle(Geom_Curve)::DownCast(c3d->Copy());
-      c3d->Transform(loc.Transformation());
-    }
-
-    if (i == indRef) {
-      c3dRef = c3d; firstRef = first; lastRef = last;
-    }
+  if (!sectionCurve(TopoDS::Edge(sequenceSec(indRef)), c3dRef, firstRef, lastRef))
+    return;
+  arrLen(indRef) = sectionPoints(c3dRef, firstRef, lastRef, ptsRef);
+  secForward(indRef) = Standard_False;
 
-    Standard_Real dist = Precision::Infinite(), distFor = -1.0, distRev = -1.0;
-    Standard_Real aMinDist = Precision::Infinite();
+  // distances evaluated before merging
+  const DataMapOfShapeDistance* aDistances = mySectionDistances.Seek(sequenceSec(indRef));
 
-    Standard_Real T, deltaT = (last - first) / (npt - 1);
-    Standard_Real aLenSec2 = 0.;
-   
-    Standard_Integer nbFound = 0;
-    for (j = 1; j <= npt; j++) {
+  for (i = indRef + 1; i <= lengSec; i++) {
 
-      // Uniform parameter on curve
-      if (j == 1) T = first;
-      else if (j == npt) T = last;
-      else T = first + (j - 1) * deltaT;
-
-      // Take point on curve
-      gp_Pnt pt = c3d->Value(T);
-     
-      if (i == indRef) {
-        ptsRef(j) = pt;
-        if(j > 1)
-          aLenSec2 += pt.SquareDistance(ptsRef(j-1));
-      }
-      else {
-        ptsSec(j) = pt;
-        //protection to avoid merging with small sections
-        if(j > 1)
-          aLenSec2 += pt.SquareDistance(ptsSec(j-1));
-        // To evaluate mutual orientation and distance
-        dist = pt.Distance(ptsRef(j));
-        if(aMinDist > dist)
-          aMinDist = dist;
-        if (distFor < dist) distFor = dist;
-        dist = pt.Distance(ptsRef(npt-j+1));
-   
-        if(aMinDist > dist)
-          aMinDist = dist;
-        if (distRev < dist) distRev = dist;
-
-        // Check that point lays between vertices of reference curve
-        const gp_Pnt &p11 = ptsRef(1);
-        const gp_Pnt &p12 = ptsRef(npt);
-        const gp_Vec aVec1(pt,p11);
-        const gp_Vec aVec2(pt,p12);
-        const gp_Vec aVecRef(p11,p12);
-        if((aVecRef * aVec1) * (aVecRef * aVec2) < 0.)
-          nbFound++;
-      }
-    }
+    const TopoDS_Edge& sec = TopoDS::Edge(sequenceSec(i));
+    SectionDistance aDistance;
+    const SectionDistance* aKnownDistance = (aDistances ? aDistances->Seek(sec) : NULL);
+    if (aKnownDistance)
+      aDistance = *aKnownDistance;
+    else if (!EvaluateDistance(ptsRef, c3dRef, firstRef, lastRef, arrLen(indRef), sec, aDistance))
+      continue;
 
-    Standard_Real aLenSec = sqrt(aLenSec2);
-    
-    //if(aLenSec < myMinTolerance )
-     // continue;
-    arrLen.SetValue(i,aLenSec);
-    // Record mutual orientation
-    Standard_Boolean isForward = (distFor < distRev); //szv debug: <=
-    secForward(i) = isForward;
-
-    dist = (isForward? distFor : distRev);
-    if(i == indRef || (dist < myTolerance && nbFound >= npt * 0.5) )
+    arrLen.SetValue(i, aDistance.Length);
+    secForward(i) = aDistance.IsForward;
+    if (aDistance.Distance >= 0.)
     {
-      tabDst(i) = dist;
-      tabMinDist(i) = aMinDist;
-    }
-    else
-    {
-      nbFound = 0, aMinDist = Precision::Infinite(), dist = -1;
-      TColgp_Array1OfPnt arrProj(1, npt);
-      TColStd_Array1OfReal arrDist(1, npt), arrPara(1, npt);
-      if( arrLen(indRef) >= arrLen(i)) 
-        ProjectPointsOnCurve(ptsSec,c3dRef,firstRef,lastRef,arrDist,arrPara,arrProj,Standard_False);
-      else
-        ProjectPointsOnCurve(ptsRef,c3d,first,last,arrDist,arrPara,arrProj,Standard_False);
-      for( j = 1; j <= npt; j++ )
-      {
-        if(arrDist(j) < 0.)
-          continue;
-        if(dist < arrDist(j))
-          dist = arrDist(j);
-        if( aMinDist > arrDist(j))
-          aMinDist = arrDist(j);
-        nbFound++;
-      }
-      if(nbFound > 1)
-      {
-        tabDst(i) = dist;
-        tabMinDist(i) =  aMinDist;
-      }
+      tabDst(i) = aDistance.Distance;
+      tabMinDist(i) = aDistance.MinDistance;
     }
   }
 
@@ -1705,6 +1760,7 @@ BRepBuilderAPI_Sewing::BRepBuilderAPI_Sewing(const Standard_Real tolerance,
 				 const Standard_Boolean optionAnalysis,
 				 const Standard_Boolean optionCutting,
 				 const Standard_Boolean optionNonmanifold)
+: myRunParallel (Standard_False)
 {
   myReShape = new BRepTools_ReShape;
   Init(tolerance, optionSewing, optionAnalysis, optionCutting, optionNonmanifold);
@@ -3103,6 +3159,78 @@ static void ReplaceEdge(const TopoDS_Shape& oldEdge,
   }
 }
 
+//=======================================================================
+//class    : SectionDistanceFunctor
+//purpose  : Evaluates the distances from the section to its contiguous sections
+//=======================================================================
+
+class BRepBuilderAPI_Sewing::SectionDistanceFunctor
+{
+public:
+
+  SectionDistanceFunctor (const BRepBuilderAPI_Sewing& theSewing,
+                          NCollection_IndexedDataMap<TopoDS_Shape, DataMapOfShapeDistance, TopTools_ShapeMapHasher>& theDistances)
+  : mySewing (theSewing),
+    myDistances (theDistances)
+  {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    const TopoDS_Edge& aRef = TopoDS::Edge (myDistances.FindKey (theIndex));
+    Handle(Geom_Curve) aCurveRef;
+    Standard_Real aFirstRef, aLastRef;
+    if (!sectionCurve (aRef, aCurveRef, aFirstRef, aLastRef))
+      return;
+    TColgp_Array1OfPnt aPntsRef (1, THE_NB_SECTION_POINTS);
+    const Standard_Real aLengthRef = sectionPoints (aCurveRef, aFirstRef, aLastRef, aPntsRef);
+
+    TopTools_SequenceOfShape aSections;
+    mySewing.FindContiguousSections (aRef, aSections, Standard_False);
+    DataMapOfShapeDistance& aDistances = myDistances.ChangeFromIndex (theIndex);
+    for (Standard_Integer i = 2; i <= aSections.Length(); i++)
+    {
+      const TopoDS_Edge& aSection = TopoDS::Edge (aSections (i));
+      SectionDistance aDistance;
+      if (mySewing.EvaluateDistance (aPntsRef, aCurveRef, aFirstRef, aLastRef, aLengthRef,
+                                     aSection, aDistance))
+        aDistances.Bind (aSection, aDistance);
+    }
+  }
+
+private:
+  SectionDistanceFunctor& operator= (const SectionDistanceFunctor&);
+
+private:
+  const BRepBuilderAPI_Sewing& mySewing;
+  NCollection_IndexedDataMap<TopoDS_Shape, DataMapOfShapeDistance, TopTools_ShapeMapHasher>& myDistances;
+};
+
+//=======================================================================
+//function : PrepareSectionDistances
+//purpose  : Evaluates the distances from each bound and cutting section
+//           to its contiguous sections. The distances do not depend on the
+//           order of merging, thus they are computed in parallel for all
+//           sections and only looked up by EvaluateDistances().
+//=======================================================================
+
+void BRepBuilderAPI_Sewing::PrepareSectionDistances()
+{
+  mySectionDistances.Clear();
+  TopTools_IndexedDataMapOfShapeListOfShape::Iterator anIterB(myBoundFaces);
+  for (; anIterB.More(); anIterB.Next()) {
+    // Skip floating edges
+    if (!anIterB.Value().Extent()) continue;
+    const TopoDS_Shape& bound = anIterB.Key();
+    mySectionDistances.Add(bound, DataMapOfShapeDistance());
+    if (const TopTools_ListOfShape* aSections = myBoundSections.Seek(bound)) {
+      for (TopTools_ListIteratorOfListOfShape its(*aSections); its.More(); its.Next())
+        mySectionDistances.Add(its.Value(), DataMapOfShapeDistance());
+    }
+  }
+  SectionDistanceFunctor aFunctor (*this, mySectionDistances);
+  OSD_Parallel::For (1, mySectionDistances.Extent() + 1, aFunctor);
+}
+
 //=======================================================================
 //function : Merging
 //purpose  : Modifies :
@@ -3115,6 +3243,8 @@ void BRepBuilderAPI_Sewing::Merging(const Standard_Boolean /* firstTime */,
 {
   BRep_Builder B;
   //  TopTools_MapOfShape MergedEdges;
+  if (myRunParallel)
+    PrepareSectionDistances();
   Message_ProgressScope aPS (theProgress, "Merging bounds", myBoundFaces.Extent());
   TopTools_IndexedDataMapOfShapeListOfShape::Iterator anIterB(myBoundFaces);
   for (; anIterB.More() && aPS.More(); anIterB.Next(), aPS.Next()) {
@@ -3442,6 +3572,7 @@ void BRepBuilderAPI_Sewing::Merging(const Standard_Boolean /* firstTime */,
   }
 
   myNbVertices = myVertexNode.Extent() + myVertexNodeFree.Extent();
+  mySectionDistances.Clear();
   myNodeSections.Clear();
   myVertexNode.Clear();
   myVertexNodeFree.Clear();
@@ -3449,13 +3580,13 @@ void BRepBuilderAPI_Sewing::Merging(const Standard_Boolean /* firstTime */,
 }
 
 //=======================================================================
-//function : MergedNearestEdges
+//function : FindContiguousSections
 //purpose  : 
 //=======================================================================
 
-Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& edge,
-                                                           TopTools_SequenceOfShape& SeqMergedEdge,
-                                                           TColStd_SequenceOfBoolean& SeqMergedOri)
+void BRepBuilderAPI_Sewing::FindContiguousSections(const TopoDS_Shape& edge,
+                                                   TopTools_SequenceOfShape& seqEdges,
+                                                   const Standard_Boolean isRejectMerged) const
 {
   // Retrieve edge nodes
   TopoDS_Vertex no1, no2;
@@ -3503,7 +3634,6 @@ Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& e
   }
 
   // Find all possible contiguous edges
-  TopTools_SequenceOfShape seqEdges;
   seqEdges.Append(edge);
   TopTools_MapOfShape mapEdges;
   mapEdges.Add(edge);
@@ -3524,8 +3654,8 @@ Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& e
         (mapVert1.Contains(vs2n) && mapVert2.Contains(vs1n)))
         if (mapEdges.Add(sec)) {
           // Check for rejected cutting
-          Standard_Boolean isRejected = myMergedEdges.Contains(sec);
-          if(!isRejected && myBoundSections.IsBound(sec))
+          Standard_Boolean isRejected = isRejectMerged && myMergedEdges.Contains(sec);
+          if(isRejectMerged && !isRejected && myBoundSections.IsBound(sec))
           {
             TopTools_ListIteratorOfListOfShape its(myBoundSections(sec));
             for (; its.More() && !isRejected; its.Next()) {
@@ -3535,7 +3665,7 @@ Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& e
                 isRejected = Standard_True;
             }
           }
-          if( !isRejected && mySectionBound.IsBound(sec)) {
+          if(isRejectMerged && !isRejected && mySectionBound.IsBound(sec)) {
             const TopoDS_Shape& bnd = mySectionBound(sec);
             isRejected = (!myBoundSections.IsBound(bnd) ||
               myMergedEdges.Contains(bnd));
@@ -3545,8 +3675,20 @@ Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& e
         }
     }
   }
+}
 
-  mapEdges.Clear();
+//=======================================================================
+//function : MergedNearestEdges
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& edge,
+                                                           TopTools_SequenceOfShape& SeqMergedEdge,
+                                                           TColStd_SequenceOfBoolean& SeqMergedOri)
+{
+  // Find all possible contiguous edges
+  TopTools_SequenceOfShape seqEdges;
+  FindContiguousSections(edge, seqEdges, Standard_True);
 
   Standard_Boolean success = Standard_False;
 
@@ -3593,6 +3735,95 @@ Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& e
   return success;
 }
 
+namespace
+{
+  //! Vertices projected on the bound during cutting
+  struct BoundProjection
+  {
+    TopoDS_Vertex V1;                    //!< first vertex of the bound
+    TopoDS_Vertex V2;                    //!< last vertex of the bound
+    TopTools_IndexedMapOfShape Vertices; //!< candidate vertices
+    TColStd_Array1OfReal Dist;           //!< distances to the bound (-1 if not projected)
+    TColStd_Array1OfReal Para;           //!< parameters of the projections
+    TColgp_Array1OfPnt Proj;             //!< projection points
+  };
+}
+
+//=======================================================================
+//class    : BoundProjectionFunctor
+//purpose  : Projects the vertices close to the bound on its curve
+//=======================================================================
+
+class BRepBuilderAPI_Sewing::BoundProjectionFunctor
+{
+public:
+
+  BoundProjectionFunctor (const BRepBuilderAPI_Sewing& theSewing,
+                          const BRepBuilderAPI_BndBoxTree& theTree,
+                          NCollection_Array1<BoundProjection>& theProjections)
+  : mySewing (theSewing),
+    myTree (theTree),
+    myProjections (theProjections)
+  {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    const TopTools_IndexedDataMapOfShapeListOfShape& aBoundFaces = mySewing.myBoundFaces;
+    // Do not cut floating edges
+    if (!aBoundFaces (theIndex).Extent()) return;
+    const TopoDS_Edge& bound = TopoDS::Edge (aBoundFaces.FindKey (theIndex));
+    // Obtain bound curve
+    Handle(Geom_Curve) c3d;
+    Standard_Real first, last;
+    if (!sectionCurve (bound, c3d, first, last)) return;
+
+    BoundProjection& aProj = myProjections.ChangeValue (theIndex);
+    { //szv: Use brackets to destroy local variables
+      // Create bounding box around curve
+      Bnd_Box aGlobalBox;
+      GeomAdaptor_Curve adptC (c3d, first, last);
+      BndLib_Add3dCurve::Add (adptC, mySewing.myTolerance, aGlobalBox);
+      // Sort vertices to find candidates
+      BRepBuilderAPI_BndBoxTreeSelector aSelector;
+      aSelector.SetCurrent (aGlobalBox);
+      myTree.Select (aSelector);
+      // Skip bound if no node is in the boundind box
+      if (!aSelector.ResInd().Extent()) return;
+      // Retrieve bound nodes
+      TopExp::Vertices (bound, aProj.V1, aProj.V2);
+      const TopoDS_Shape& Node1 = mySewing.myVertexNode.FindFromKey (aProj.V1);
+      const TopoDS_Shape& Node2 = mySewing.myVertexNode.FindFromKey (aProj.V2);
+      // Fill map of candidate vertices
+      TColStd_ListIteratorOfListOfInteger itl (aSelector.ResInd());
+      for (; itl.More(); itl.Next()) {
+        const Standard_Integer index = itl.Value();
+        const TopoDS_Shape& Node = mySewing.myVertexNode.FindFromIndex (index);
+        if (!Node.IsSame (Node1) && !Node.IsSame (Node2))
+          aProj.Vertices.Add (mySewing.myVertexNode.FindKey (index));
+      }
+    }
+    const Standard_Integer nbCandidates = aProj.Vertices.Extent();
+    if (!nbCandidates) return;
+    // Project vertices on curve
+    aProj.Dist.Resize (1, nbCandidates, Standard_False);
+    aProj.Para.Resize (1, nbCandidates, Standard_False);
+    aProj.Proj.Resize (1, nbCandidates, Standard_False);
+    TColgp_Array1OfPnt arrPnt (1, nbCandidates);
+    for (Standard_Integer j = 1; j <= nbCandidates; j++)
+      arrPnt(j) = BRep_Tool::Pnt (TopoDS::Vertex (aProj.Vertices (j)));
+    mySewing.ProjectPointsOnCurve (arrPnt, c3d, first, last,
+                                   aProj.Dist, aProj.Para, aProj.Proj, Standard_True);
+  }
+
+private:
+  BoundProjectionFunctor& operator= (const BoundProjectionFunctor&);
+
+private:
+  const BRepBuilderAPI_Sewing& mySewing;
+  const BRepBuilderAPI_BndBoxTree& myTree;
+  NCollection_Array1<BoundProjection>& myProjections;
+};
+
 //=======================================================================
 //function : Cutting
 //purpose  : Modifies :
@@ -3609,7 +3840,6 @@ void BRepBuilderAPI_Sewing::Cutting(const Message_ProgressRange& theProgress)
   Standard_Real eps = myTolerance*0.5;
   BRepBuilderAPI_BndBoxTree aTree;
   NCollection_UBTreeFiller <Standard_Integer, Bnd_Box> aTreeFiller (aTree);
-  BRepBuilderAPI_BndBoxTreeSelector aSelector;
   for (i = 1; i <= nbVertices; i++) {
     gp_Pnt pt = BRep_Tool::Pnt(TopoDS::Vertex(myVertexNode.FindKey(i)));
     Bnd_Box aBox;
@@ -3619,69 +3849,30 @@ void BRepBuilderAPI_Sewing::Cutting(const Message_ProgressRange& theProgress)
   }
   aTreeFiller.Fill();
 
-  Handle(Geom_Curve) c3d;
-  TopLoc_Location loc;
-  Standard_Real first, last;
-  // Iterate on all boundaries
+  // Project candidate vertices on all boundaries
   Standard_Integer nbBounds = myBoundFaces.Extent();
-  Message_ProgressScope aPS (theProgress, "Cutting bounds", nbBounds);
-  TopTools_IndexedDataMapOfShapeListOfShape::Iterator anIterB(myBoundFaces);
-  for (; anIterB.More() && aPS.More(); anIterB.Next(), aPS.Next()) {
-    const TopoDS_Edge& bound = TopoDS::Edge(anIterB.Key());
-    // Do not cut floating edges
-    if (!anIterB.Value().Extent()) continue;
-    // Obtain bound curve
-    c3d = BRep_Tool::Curve(bound, loc, first, last);
-    if (c3d.IsNull()) continue;
-    if (!loc.IsIdentity()) {
-      c3d = Handle(Geom_Curve)::DownCast(c3d->Copy());
-      c3d->Transform(loc.Transformation());
-    }
+  Message_ProgressScope aPS (theProgress, "Cutting bounds", 2);
+  NCollection_Array1<BoundProjection> aProjections (1, Max (nbBounds, 1));
+  BoundProjectionFunctor aFunctor (*this, aTree, aProjections);
+  OSD_Parallel::For (1, nbBounds + 1, aFunctor, !myRunParallel);
+  aPS.Next();
+  if (!aPS.More())
+    return;
+
+  // Create cutting nodes and sections in the order of boundaries
+  Message_ProgressScope aPSCut (aPS.Next(), NULL, nbBounds);
+  for (i = 1; i <= nbBounds && aPSCut.More(); i++, aPSCut.Next()) {
+    const TopoDS_Edge& bound = TopoDS::Edge(myBoundFaces.FindKey(i));
+    const BoundProjection& aProj = aProjections(i);
+    if (aProj.Vertices.IsEmpty()) continue;
     // Create cutting sections
     TopTools_ListOfShape listSections;
     { //szv: Use brackets to destroy local variables
-      // Obtain candidate vertices
-      TopoDS_Vertex V1, V2;
-      TopTools_IndexedMapOfShape CandidateVertices;
-      { //szv: Use brackets to destroy local variables
-        // Create bounding box around curve
-        Bnd_Box aGlobalBox;
-        GeomAdaptor_Curve adptC(c3d,first,last);
-        BndLib_Add3dCurve::Add(adptC,myTolerance,aGlobalBox);
-        // Sort vertices to find candidates
-        aSelector.SetCurrent (aGlobalBox);
-        aTree.Select (aSelector); 
-        // Skip bound if no node is in the boundind box
-        if (!aSelector.ResInd().Extent()) continue;
-        // Retrieve bound nodes
-        TopExp::Vertices(bound,V1,V2);
-        const TopoDS_Shape& Node1 = myVertexNode.FindFromKey(V1);
-        const TopoDS_Shape& Node2 = myVertexNode.FindFromKey(V2);
-        // Fill map of candidate vertices
-        TColStd_ListIteratorOfListOfInteger itl(aSelector.ResInd());
-        for (; itl.More(); itl.Next()) {
-          const Standard_Integer index = itl.Value();
-          const TopoDS_Shape& Node = myVertexNode.FindFromIndex(index);
-          if (!Node.IsSame(Node1) && !Node.IsSame(Node2)) {
-            TopoDS_Shape vertex = myVertexNode.FindKey(index);
-            CandidateVertices.Add(vertex);
-          }
-        }
-        aSelector.ClearResList();
-      }
-      Standard_Integer nbCandidates = CandidateVertices.Extent();
-      if (!nbCandidates) continue;
-      // Project vertices on curve
-      TColStd_Array1OfReal arrPara(1,nbCandidates), arrDist(1,nbCandidates);
-      TColgp_Array1OfPnt arrPnt(1,nbCandidates), arrProj(1,nbCandidates);
-      for (Standard_Integer j = 1; j <= nbCandidates; j++)
-        arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(CandidateVertices(j)));
-      ProjectPointsOnCurve(arrPnt,c3d,first,last,arrDist,arrPara,arrProj,Standard_True);
       // Create cutting nodes
       TopTools_SequenceOfShape seqNode;
       TColStd_SequenceOfReal seqPara;
-      CreateCuttingNodes(CandidateVertices,bound,
-        V1,V2,arrDist,arrPara,arrProj,seqNode,seqPara);
+      CreateCuttingNodes(aProj.Vertices,bound,
+        aProj.V1,aProj.V2,aProj.Dist,aProj.Para,aProj.Proj,seqNode,seqPara);
       if (!seqPara.Length()) continue;
       // Create cutting sections
       CreateSections(bound, seqNode, seqPara, listSections);
@@ -38,6 +38,9 @@
 #include <TColStd_Array1OfReal.hxx>
 #include <TColgp_Array1OfPnt.hxx>
 #include <TColStd_SequenceOfReal.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_IndexedDataMap.hxx>
 
 #include <Message_ProgressRange.hxx>
 
@@ -229,15 +232,24 @@ public:
     void SetNonManifoldMode (const Standard_Boolean theNonManifoldMode);
   
   //! Gets mode for non-manifold sewing.
-  //!
-  //! INTERNAL FUNCTIONS ---
     Standard_Boolean NonManifoldMode() const;
 
+  //! Sets mode for parallel processing.
+  //! In this mode the vertices are projected on the bounds during cutting
+  //! and the distances between the contiguous sections are evaluated
+  //! before merging in parallel threads. The result does not depend on the mode.
+  //! By default - false.
+    void SetRunParallel (const Standard_Boolean theIsParallel);
+
+  //! Gets mode for parallel processing.
+    Standard_Boolean IsRunParallel() const;
+
 
 
 
   DEFINE_STANDARD_RTTIEXT(BRepBuilderAPI_Sewing,Standard_Transient)
 
+  //! INTERNAL FUNCTIONS ---
 protected:
 
   
@@ -362,6 +374,42 @@ protected:
 
 private:
 
+  //! Distance from the reference section to another section
+  //! as evaluated by EvaluateDistances().
+  struct SectionDistance
+  {
+    Standard_Real    Distance;    //!< maximal distance, -1 if the sections are not close
+    Standard_Real    MinDistance; //!< minimal distance
+    Standard_Real    Length;      //!< length of the polygon of the section
+    Standard_Boolean IsForward;   //!< mutual orientation of the sections
+  };
+
+  typedef NCollection_DataMap<TopoDS_Shape, SectionDistance, TopTools_ShapeMapHasher> DataMapOfShapeDistance;
+
+  class BoundProjectionFunctor;
+  class SectionDistanceFunctor;
+
+  //! Fills the sequence of sections contiguous to the given edge
+  //! (the edge itself is the first one). If isRejectMerged is true the
+  //! sections of the already merged bounds are skipped.
+  void FindContiguousSections (const TopoDS_Shape& theEdge,
+                               TopTools_SequenceOfShape& theSeqEdges,
+                               const Standard_Boolean isRejectMerged) const;
+
+  //! Evaluates the distance from the reference section given by its curve
+  //! and discretization points to the section theSection.
+  //! Returns false if the section has no 3D curve.
+  Standard_Boolean EvaluateDistance (const TColgp_Array1OfPnt& thePntsRef,
+                                     const Handle(Geom_Curve)& theCurveRef,
+                                     const Standard_Real theFirstRef,
+                                     const Standard_Real theLastRef,
+                                     const Standard_Real theLengthRef,
+                                     const TopoDS_Edge& theSection,
+                                     SectionDistance& theDistance) const;
+
+  //! Evaluates in parallel the distances between the contiguous sections
+  //! to be used by EvaluateDistances() during merging.
+  void PrepareSectionDistances();
 
   Standard_Boolean myFaceMode;
   Standard_Boolean myFloatingEdgesMode;
@@ -370,6 +418,8 @@ private:
   Standard_Real myMinTolerance;
   Standard_Real myMaxTolerance;
   TopTools_MapOfShape myMergedEdges;
+  Standard_Boolean myRunParallel;
+  NCollection_IndexedDataMap<TopoDS_Shape, DataMapOfShapeDistance, TopTools_ShapeMapHasher> mySectionDistances;
 
 
 };
@@ -16,6 +16,7 @@
 
 #include <BRepCheck_Analyzer.hxx>
 
+#include <BRep_Tool.hxx>
 #include <BRepCheck_Edge.hxx>
 #include <BRepCheck_Face.hxx>
 #include <BRepCheck_ListIteratorOfListOfStatus.hxx>
@@ -31,10 +32,13 @@
 #include <Standard_Failure.hxx>
 #include <Standard_Mutex.hxx>
 #include <Standard_NullObject.hxx>
+#include <TColStd_ListOfInteger.hxx>
+#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_MapOfShape.hxx>
 
 //! Functor for multi-threaded execution.
@@ -352,23 +356,176 @@ void BRepCheck_Analyzer::Init (const TopoDS_Shape& theShape,
   }
 
   myShape = theShape;
+  myGeomControls = B;
+  myNbReused = 0;
   myMap.Clear();
   Put (theShape, B);
-  Perform();
+
+  NCollection_Vector<TopoDS_Shape> aShapes;
+  for (Standard_Integer anI = 1; anI <= myMap.Extent(); ++anI)
+  {
+    aShapes.Append (myMap.FindKey (anI));
+  }
+  Perform (aShapes);
+  StoreTolerances();
 }
 
 //=======================================================================
-//function : Put
+//function : Update
 //purpose  :
 //=======================================================================
-void BRepCheck_Analyzer::Put (const TopoDS_Shape& theShape,
-                              const Standard_Boolean B)
+void BRepCheck_Analyzer::Update (const TopoDS_Shape& theShape)
 {
-  if (myMap.Contains (theShape))
+  if (theShape.IsNull())
+  {
+    throw Standard_NullObject ("BRepCheck_Analyzer::Update() - NULL shape");
+  }
+
+  if (myMap.IsEmpty())
   {
+    Init (theShape, myGeomControls);
     return;
   }
 
+  BRepCheck_IndexedDataMapOfShapeResult anOldMap;
+  anOldMap.Exchange (myMap);
+  NCollection_Vector<Standard_Real> anOldTols;
+  anOldTols.Assign (myTolerances, Standard_False);
+
+  // Sub-shapes of the new shape in the same order as they are put by Init()
+  TopTools_IndexedMapOfShape aSubShapes;
+  TopExp::MapShapes (theShape, aSubShapes);
+  const Standard_Integer aNbS = aSubShapes.Extent();
+
+  // Initially reuse the results of the shared sub-shapes with unchanged tolerance
+  NCollection_Array1<Standard_Integer> anOldIndices (1, aNbS);
+  NCollection_Array1<Standard_Boolean> aToReuse (1, aNbS);
+  for (Standard_Integer anI = 1; anI <= aNbS; ++anI)
+  {
+    const TopoDS_Shape& aS = aSubShapes (anI);
+    const Standard_Integer anOldIndex = anOldMap.FindIndex (aS);
+    anOldIndices (anI) = anOldIndex;
+    aToReuse (anI) = anOldIndex > 0
+                  && !anOldMap (anOldIndex).IsNull()
+                  && anOldMap.FindKey (anOldIndex).Orientation() == aS.Orientation();
+    if (aToReuse (anI))
+    {
+      switch (aS.ShapeType())
+      {
+        case TopAbs_VERTEX: aToReuse (anI) = BRep_Tool::Tolerance (TopoDS::Vertex (aS)) == anOldTols (anOldIndex - 1); break;
+        case TopAbs_EDGE:   aToReuse (anI) = BRep_Tool::Tolerance (TopoDS::Edge   (aS)) == anOldTols (anOldIndex - 1)
+                                          && Handle(BRepCheck_Edge)::DownCast (anOldMap (anOldIndex))->IsExactMethod() == myIsExact; break;
+        case TopAbs_FACE:   aToReuse (anI) = BRep_Tool::Tolerance (TopoDS::Face   (aS)) == anOldTols (anOldIndex - 1); break;
+        default: break;
+      }
+    }
+  }
+
+  // Ancestors in the context of which the sub-shapes are checked (see BRepCheck_ParallelAnalyzer)
+  NCollection_Array1<TColStd_ListOfInteger> aContexts (1, aNbS);
+  for (Standard_Integer anI = 1; anI <= aNbS; ++anI)
+  {
+    const TopoDS_Shape& aS = aSubShapes (anI);
+    switch (aS.ShapeType())
+    {
+      case TopAbs_EDGE:
+      {
+        for (TopExp_Explorer anExp (aS, TopAbs_VERTEX); anExp.More(); anExp.Next())
+        {
+          aContexts (aSubShapes.FindIndex (anExp.Current())).Append (anI);
+        }
+        break;
+      }
+      case TopAbs_FACE:
+      {
+        for (TopExp_Explorer anExp (aS, TopAbs_VERTEX); anExp.More(); anExp.Next())
+        {
+          aContexts (aSubShapes.FindIndex (anExp.Current())).Append (anI);
+        }
+        for (TopExp_Explorer anExp (aS, TopAbs_EDGE); anExp.More(); anExp.Next())
+        {
+          aContexts (aSubShapes.FindIndex (anExp.Current())).Append (anI);
+        }
+        for (TopExp_Explorer anExp (aS, TopAbs_WIRE); anExp.More(); anExp.Next())
+        {
+          aContexts (aSubShapes.FindIndex (anExp.Current())).Append (anI);
+        }
+        break;
+      }
+      case TopAbs_SOLID:
+      {
+        for (TopExp_Explorer anExp (aS, TopAbs_SHELL); anExp.More(); anExp.Next())
+        {
+          aContexts (aSubShapes.FindIndex (anExp.Current())).Append (anI);
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+
+  // The result can be reused only if all sub-shapes of the shape are reused and
+  // none of its contexts is a shape of the previous check which has to be checked again
+  // (the statuses in such context are stored in the result and would be outdated).
+  // Dropping a result may invalidate the others, thus iterate until no change.
+  for (Standard_Boolean isChanged = Standard_True; isChanged; )
+  {
+    isChanged = Standard_False;
+    for (Standard_Integer anI = 1; anI <= aNbS; ++anI)
+    {
+      if (!aToReuse (anI))
+      {
+        continue;
+      }
+
+      Standard_Boolean isToDrop = Standard_False;
+      for (TopoDS_Iterator anIt (aSubShapes (anI)); anIt.More() && !isToDrop; anIt.Next())
+      {
+        isToDrop = !aToReuse (aSubShapes.FindIndex (anIt.Value()));
+      }
+      for (TColStd_ListOfInteger::Iterator anIt (aContexts (anI)); anIt.More() && !isToDrop; anIt.Next())
+      {
+        isToDrop = !aToReuse (anIt.Value()) && anOldIndices (anIt.Value()) > 0;
+      }
+
+      if (isToDrop)
+      {
+        aToReuse (anI) = Standard_False;
+        isChanged = Standard_True;
+      }
+    }
+  }
+
+  myShape = theShape;
+  myNbReused = 0;
+  NCollection_Vector<TopoDS_Shape> aShapesToCheck;
+  for (Standard_Integer anI = 1; anI <= aNbS; ++anI)
+  {
+    const TopoDS_Shape& aS = aSubShapes (anI);
+    if (aToReuse (anI))
+    {
+      myMap.Add (aS, anOldMap (anOldIndices (anI)));
+      ++myNbReused;
+    }
+    else
+    {
+      myMap.Add (aS, NewResult (aS, myGeomControls));
+      aShapesToCheck.Append (aS);
+    }
+  }
+
+  Perform (aShapesToCheck);
+  StoreTolerances();
+}
+
+//=======================================================================
+//function : NewResult
+//purpose  :
+//=======================================================================
+Handle(BRepCheck_Result) BRepCheck_Analyzer::NewResult (const TopoDS_Shape& theShape,
+                                                        const Standard_Boolean B) const
+{
   Handle(BRepCheck_Result) HR;
   switch (theShape.ShapeType())
   {
@@ -405,7 +562,22 @@ void BRepCheck_Analyzer::Put (const TopoDS_Shape& theShape,
   {
     HR->SetParallel (myIsParallel);
   }
-  myMap.Add (theShape, HR);
+  return HR;
+}
+
+//=======================================================================
+//function : Put
+//purpose  :
+//=======================================================================
+void BRepCheck_Analyzer::Put (const TopoDS_Shape& theShape,
+                              const Standard_Boolean B)
+{
+  if (myMap.Contains (theShape))
+  {
+    return;
+  }
+
+  myMap.Add (theShape, NewResult (theShape, B));
 
   for (TopoDS_Iterator theIterator (theShape); theIterator.More(); theIterator.Next())
   {
@@ -413,13 +585,40 @@ void BRepCheck_Analyzer::Put (const TopoDS_Shape& theShape,
   }
 }
 
+//=======================================================================
+//function : StoreTolerances
+//purpose  :
+//=======================================================================
+void BRepCheck_Analyzer::StoreTolerances()
+{
+  myTolerances.Clear();
+  for (Standard_Integer anI = 1; anI <= myMap.Extent(); ++anI)
+  {
+    const TopoDS_Shape& aS = myMap.FindKey (anI);
+    Standard_Real aTol = -1.0;
+    switch (aS.ShapeType())
+    {
+      case TopAbs_VERTEX: aTol = BRep_Tool::Tolerance (TopoDS::Vertex (aS)); break;
+      case TopAbs_EDGE:   aTol = BRep_Tool::Tolerance (TopoDS::Edge   (aS)); break;
+      case TopAbs_FACE:   aTol = BRep_Tool::Tolerance (TopoDS::Face   (aS)); break;
+      default: break;
+    }
+    myTolerances.Append (aTol);
+  }
+}
+
 //=======================================================================
 //function : Perform
 //purpose  :
 //=======================================================================
-void BRepCheck_Analyzer::Perform()
+void BRepCheck_Analyzer::Perform (const NCollection_Vector<TopoDS_Shape>& theShapes)
 {
-  const Standard_Integer aMapSize = myMap.Size();
+  const Standard_Integer aMapSize = theShapes.Size();
+  if (aMapSize == 0)
+  {
+    return;
+  }
+
   const Standard_Integer aMinTaskSize = 10;
   const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
   const Standard_Integer aNbThreads = aThreadPool->NbThreads();
@@ -446,7 +645,7 @@ void BRepCheck_Analyzer::Perform()
       }
       aArrayOfArray[aVectIndex].Resize (0, aVectorSize - 1, Standard_False);
     }
-    aArrayOfArray[aVectIndex][aShapeIndex] = myMap.FindKey (anI);
+    aArrayOfArray[aVectIndex][aShapeIndex] = theShapes (anI - 1);
   }
 
   BRepCheck_ParallelAnalyzer aParallelAnalyzer (aArrayOfArray, myMap);
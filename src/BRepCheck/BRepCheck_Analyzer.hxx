@@ -24,6 +24,7 @@
 #include <TopoDS_Shape.hxx>
 #include <BRepCheck_IndexedDataMapOfShapeResult.hxx>
 #include <TopAbs_ShapeEnum.hxx>
+#include <NCollection_Vector.hxx>
 class BRepCheck_Result;
 
 //! A framework to check the overall
@@ -61,7 +62,9 @@ public:
                       const Standard_Boolean theIsParallel = Standard_False,
                       const Standard_Boolean theIsExact = Standard_False)
     : myIsParallel(theIsParallel),
-      myIsExact(theIsExact)
+      myIsExact(theIsExact),
+      myGeomControls(GeomControls),
+      myNbReused(0)
   {
     Init (S, GeomControls);
   }
@@ -85,6 +88,25 @@ public:
   Standard_EXPORT void Init (const TopoDS_Shape& S,
                              const Standard_Boolean GeomControls = Standard_True);
 
+  //! Re-initializes the analyzer by the new shape <S> keeping the results
+  //! computed for the previously checked shape.
+  //! The results are reused for the sub-shapes shared with the previous shape
+  //! (same TShape, location and orientation) if the sub-shape, all its sub-shapes
+  //! and all shapes in the context of which it has been checked are shared as well.
+  //! Only the new sub-shapes and the sub-shapes with changed ancestors are checked again.
+  //! Useful for checking the result of each step of a sequence of modeling
+  //! operations, which usually replace only a small part of the shape.
+  //! It is supposed that the shared sub-shapes have not been modified in place
+  //! between the calls, except for their tolerances which are compared.
+  //! The geometric controls flag of the last call of Init() is used.
+  Standard_EXPORT void Update (const TopoDS_Shape& S);
+
+  //! Returns the number of results reused by the last call of Update().
+  Standard_Integer NbReusedResults() const
+  {
+    return myNbReused;
+  }
+
   //! Sets method to calculate distance: Calculating in finite number of points (if theIsExact
   //! is false, faster, but possible not correct result) or exact calculating by using 
   //! BRepLib_CheckCurveOnSurface class (if theIsExact is true, slowly, but more correctly).
@@ -172,7 +194,15 @@ private:
   Standard_EXPORT void Put (const TopoDS_Shape& S,
                             const Standard_Boolean Gctrl);
 
-  Standard_EXPORT void Perform();
+  //! Creates the result for the shape of the checked type (null for compounds).
+  Standard_EXPORT Handle(BRepCheck_Result) NewResult (const TopoDS_Shape& S,
+                                                      const Standard_Boolean Gctrl) const;
+
+  //! Stores the tolerances of the sub-shapes to detect their modification in Update().
+  Standard_EXPORT void StoreTolerances();
+
+  //! Performs the checks in the context of the given shapes.
+  Standard_EXPORT void Perform (const NCollection_Vector<TopoDS_Shape>& theShapes);
 
   Standard_EXPORT Standard_Boolean ValidSub (const TopoDS_Shape& S, const TopAbs_ShapeEnum SubType) const;
 
@@ -182,6 +212,9 @@ private:
   BRepCheck_IndexedDataMapOfShapeResult myMap;
   Standard_Boolean myIsParallel;
   Standard_Boolean myIsExact;
+  Standard_Boolean myGeomControls;
+  Standard_Integer myNbReused;
+  NCollection_Vector<Standard_Real> myTolerances;
 
 };
 
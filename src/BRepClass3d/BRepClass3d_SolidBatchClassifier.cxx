@@ -0,0 +1,459 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepClass3d_SolidBatchClassifier.hxx>
+
+#include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BVH_Distance.hxx>
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
+#include <NCollection_Shared.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+namespace
+{
+  //! Relative tolerance for barycentric coordinates of the ray hits:
+  //! the hits closer to the edges of the triangles are considered ambiguous.
+  static const Standard_Real THE_BARYCENTRIC_TOL = 1.e-7;
+
+  //! Direction of the rays used for the parity test.
+  //! It is chosen not to be parallel to the coordinate planes
+  //! to avoid degenerated hits on the axis-aligned geometry.
+  static BVH_Vec3d rayDirection()
+  {
+    const BVH_Vec3d aDir (0.5301, 0.6227, 0.5755);
+    return aDir / aDir.Modulus();
+  }
+
+  //=======================================================================
+  //class    : PointTriangulationSqDistance
+  //purpose  : Computes the square distance from the point to the triangulation
+  //=======================================================================
+  class PointTriangulationSqDistance :
+    public BVH_Distance<Standard_Real, 3, BVH_Vec3d, BRepExtrema_TriangleSet>
+  {
+  public:
+
+    //! Constructor with the square distance to stop the descend
+    PointTriangulationSqDistance (const Standard_Real theSqStopDist)
+    : mySqStopDist (theSqStopDist)
+    {}
+
+    //! Computes the distance from the point to bounding box
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin,
+                                         const BVH_Vec3d& theCMax,
+                                         Standard_Real& theDistance) const Standard_OVERRIDE
+    {
+      theDistance = BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance (myObject, theCMin, theCMax);
+      return RejectMetric (theDistance);
+    }
+
+    //! Computes the distance from the point to triangle
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real&) Standard_OVERRIDE
+    {
+      BVH_Vec3d aV1, aV2, aV3;
+      myBVHSet->GetVertices (theIndex, aV1, aV2, aV3);
+      const Standard_Real aDist =
+        BVH_Tools<Standard_Real, 3>::PointTriangleSquareDistance (myObject, aV1, aV2, aV3);
+      if (aDist < myDistance)
+      {
+        myDistance = aDist;
+        return Standard_True;
+      }
+      return Standard_False;
+    }
+
+    //! Stops the descend as soon as the point is found to be close to the boundary
+    virtual Standard_Boolean Stop() const Standard_OVERRIDE
+    {
+      return myDistance <= mySqStopDist;
+    }
+
+  private:
+    Standard_Real mySqStopDist;
+  };
+
+  //=======================================================================
+  //class    : RayTriangulationParity
+  //purpose  : Counts the intersections of the ray with the triangulation
+  //=======================================================================
+  class RayTriangulationParity :
+    public BVH_Traverse<Standard_Real, 3, BRepExtrema_TriangleSet, Standard_Real>
+  {
+  public:
+
+    //! Constructor
+    RayTriangulationParity (const BVH_Vec3d& theOrigin,
+                            const BVH_Vec3d& theDirection)
+    : myOrigin (theOrigin),
+      myDirection (theDirection),
+      myNbHits (0),
+      myIsAmbiguous (Standard_False)
+    {}
+
+    //! Returns the number of intersections
+    Standard_Integer NbHits() const { return myNbHits; }
+
+    //! Returns true if the ray passes too close to the edges of triangles
+    Standard_Boolean IsAmbiguous() const { return myIsAmbiguous; }
+
+    //! Rejects the node not intersected by the ray
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin,
+                                         const BVH_Vec3d& theCMax,
+                                         Standard_Real&) const Standard_OVERRIDE
+    {
+      Standard_Real aTimeEnter = 0.0, aTimeLeave = 0.0;
+      return !BVH_Tools<Standard_Real, 3>::RayBoxIntersection (myOrigin, myDirection,
+                                                               theCMin, theCMax,
+                                                               aTimeEnter, aTimeLeave);
+    }
+
+    //! Intersects the ray with the triangle (Moller-Trumbore algorithm)
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real&) Standard_OVERRIDE
+    {
+      BVH_Vec3d aV1, aV2, aV3;
+      myBVHSet->GetVertices (theIndex, aV1, aV2, aV3);
+
+      const BVH_Vec3d anEdge1 = aV2 - aV1;
+      const BVH_Vec3d anEdge2 = aV3 - aV1;
+      const BVH_Vec3d aPVec = BVH_Vec3d::Cross (myDirection, anEdge2);
+      const Standard_Real aDet = anEdge1.Dot (aPVec);
+      const Standard_Real aScale = anEdge1.Modulus() * anEdge2.Modulus();
+      if (aScale == 0.0)
+      {
+        // degenerated triangle
+        return Standard_False;
+      }
+      if (Abs (aDet) <= THE_BARYCENTRIC_TOL * aScale)
+      {
+        // the ray is parallel to the triangle, it is ambiguous only if
+        // the ray is in the plane of the triangle (the origin is far from it)
+        const BVH_Vec3d aNorm = BVH_Vec3d::Cross (anEdge1, anEdge2);
+        if (Abs (aNorm.Dot (myOrigin - aV1)) <= THE_BARYCENTRIC_TOL * aScale * (myOrigin - aV1).Modulus())
+        {
+          myIsAmbiguous = Standard_True;
+        }
+        return Standard_False;
+      }
+
+      const Standard_Real anInvDet = 1.0 / aDet;
+      const BVH_Vec3d aTVec = myOrigin - aV1;
+      const Standard_Real aU = aTVec.Dot (aPVec) * anInvDet;
+      if (aU < -THE_BARYCENTRIC_TOL || aU > 1.0 + THE_BARYCENTRIC_TOL)
+      {
+        return Standard_False;
+      }
+
+      const BVH_Vec3d aQVec = BVH_Vec3d::Cross (aTVec, anEdge1);
+      const Standard_Real aV = myDirection.Dot (aQVec) * anInvDet;
+      if (aV < -THE_BARYCENTRIC_TOL || aU + aV > 1.0 + THE_BARYCENTRIC_TOL)
+      {
+        return Standard_False;
+      }
+
+      const Standard_Real aT = anEdge2.Dot (aQVec) * anInvDet;
+      if (aT < 0.0)
+      {
+        return Standard_False;
+      }
+
+      if (aU < THE_BARYCENTRIC_TOL || aV < THE_BARYCENTRIC_TOL || aU + aV > 1.0 - THE_BARYCENTRIC_TOL)
+      {
+        // the hit is close to the edge or vertex of the triangle,
+        // it may be counted twice or missed
+        myIsAmbiguous = Standard_True;
+        return Standard_False;
+      }
+
+      ++myNbHits;
+      return Standard_True;
+    }
+
+    //! Stops the descend if the result is ambiguous
+    virtual Standard_Boolean Stop() const Standard_OVERRIDE
+    {
+      return myIsAmbiguous;
+    }
+
+  private:
+    BVH_Vec3d        myOrigin;
+    BVH_Vec3d        myDirection;
+    Standard_Integer myNbHits;
+    Standard_Boolean myIsAmbiguous;
+  };
+
+  typedef NCollection_Shared<BRepClass3d_SolidClassifier> SharedSolidClassifier;
+
+  //=======================================================================
+  //class    : BatchClassifierFunctor
+  //purpose  : Classifies the points using the exact classifier
+  //           of the thread for the points close to the boundary
+  //=======================================================================
+  class BatchClassifierFunctor
+  {
+  public:
+
+    //! Constructor
+    BatchClassifierFunctor (const TopoDS_Shape&                     theShape,
+                            const TColgp_Array1OfPnt&               thePoints,
+                            const Standard_Real                     theTol,
+                            const Bnd_Box&                          theBox,
+                            const Handle(BRepExtrema_TriangleSet)&  theTriangles,
+                            const Standard_Real                     theBoundaryDist,
+                            const Standard_Integer                  theNbThreads,
+                            NCollection_Array1<TopAbs_State>&       theStates,
+                            NCollection_Array1<Standard_Boolean>&   theIsExact)
+    : myShape (theShape),
+      myPoints (thePoints),
+      myTol (theTol),
+      myBox (theBox),
+      myTriangles (theTriangles),
+      mySqBoundaryDist (theBoundaryDist * theBoundaryDist),
+      myDirection (rayDirection()),
+      myClassifiers (0, theNbThreads - 1),
+      myStates (theStates),
+      myIsExact (theIsExact)
+    {}
+
+    //! Classifies the point with the given index
+    void operator() (const Standard_Integer theThreadIndex,
+                     const Standard_Integer theIndex) const
+    {
+      const gp_Pnt& aP = myPoints.Value (theIndex);
+      myIsExact.ChangeValue (theIndex) = Standard_False;
+      if (myBox.IsOut (aP))
+      {
+        myStates.ChangeValue (theIndex) = TopAbs_OUT;
+        return;
+      }
+
+      if (!myTriangles.IsNull())
+      {
+        const BVH_Vec3d aPnt (aP.X(), aP.Y(), aP.Z());
+
+        PointTriangulationSqDistance aDistTool (mySqBoundaryDist);
+        aDistTool.SetObject (aPnt);
+        aDistTool.SetBVHSet (myTriangles.get());
+        aDistTool.ComputeDistance();
+        if (aDistTool.Distance() > mySqBoundaryDist)
+        {
+          RayTriangulationParity aRayTool (aPnt, myDirection);
+          aRayTool.SetBVHSet (myTriangles.get());
+          aRayTool.Select();
+          if (!aRayTool.IsAmbiguous())
+          {
+            myStates.ChangeValue (theIndex) = (aRayTool.NbHits() % 2) ? TopAbs_IN : TopAbs_OUT;
+            return;
+          }
+        }
+      }
+
+      // The point is close to the boundary or the triangulation cannot be used
+      Handle(SharedSolidClassifier)& aClassifier = myClassifiers.ChangeValue (theThreadIndex);
+      if (aClassifier.IsNull())
+      {
+        aClassifier = new SharedSolidClassifier (myShape);
+      }
+      aClassifier->Perform (aP, myTol);
+      myStates.ChangeValue (theIndex) = aClassifier->State();
+      myIsExact.ChangeValue (theIndex) = Standard_True;
+    }
+
+  private:
+    BatchClassifierFunctor& operator= (const BatchClassifierFunctor&);
+
+  private:
+    const TopoDS_Shape&                                 myShape;
+    const TColgp_Array1OfPnt&                           myPoints;
+    Standard_Real                                       myTol;
+    const Bnd_Box&                                      myBox;
+    Handle(BRepExtrema_TriangleSet)                     myTriangles;
+    Standard_Real                                       mySqBoundaryDist;
+    BVH_Vec3d                                           myDirection;
+    mutable NCollection_Array1<Handle(SharedSolidClassifier)> myClassifiers;
+    NCollection_Array1<TopAbs_State>&                   myStates;
+    NCollection_Array1<Standard_Boolean>&               myIsExact;
+  };
+}
+
+//=======================================================================
+//function : BRepClass3d_SolidBatchClassifier
+//purpose  :
+//=======================================================================
+BRepClass3d_SolidBatchClassifier::BRepClass3d_SolidBatchClassifier()
+: myDeflection (0.0),
+  myMaxTolerance (0.0),
+  myIsParallel (Standard_False),
+  myToUseTriangulation (Standard_True),
+  myIsDone (Standard_False),
+  myNbExact (0)
+{
+}
+
+//=======================================================================
+//function : BRepClass3d_SolidBatchClassifier
+//purpose  :
+//=======================================================================
+BRepClass3d_SolidBatchClassifier::BRepClass3d_SolidBatchClassifier (const TopoDS_Shape& theSolid)
+: myDeflection (0.0),
+  myMaxTolerance (0.0),
+  myIsParallel (Standard_False),
+  myToUseTriangulation (Standard_True),
+  myIsDone (Standard_False),
+  myNbExact (0)
+{
+  Load (theSolid);
+}
+
+//=======================================================================
+//function : Load
+//purpose  :
+//=======================================================================
+void BRepClass3d_SolidBatchClassifier::Load (const TopoDS_Shape& theSolid)
+{
+  myShape = theSolid;
+  myIsDone = Standard_False;
+  myNbExact = 0;
+  myStates = NCollection_Array1<TopAbs_State>();
+
+  myMaxTolerance = 0.0;
+  for (TopExp_Explorer anExp (myShape, TopAbs_VERTEX); anExp.More(); anExp.Next())
+  {
+    myMaxTolerance = Max (myMaxTolerance, BRep_Tool::Tolerance (TopoDS::Vertex (anExp.Current())));
+  }
+  for (TopExp_Explorer anExp (myShape, TopAbs_EDGE); anExp.More(); anExp.Next())
+  {
+    myMaxTolerance = Max (myMaxTolerance, BRep_Tool::Tolerance (TopoDS::Edge (anExp.Current())));
+  }
+  for (TopExp_Explorer anExp (myShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    myMaxTolerance = Max (myMaxTolerance, BRep_Tool::Tolerance (TopoDS::Face (anExp.Current())));
+  }
+
+  myBox.SetVoid();
+  BRepBndLib::Add (myShape, myBox);
+
+  prepareTriangulation();
+}
+
+//=======================================================================
+//function : prepareTriangulation
+//purpose  :
+//=======================================================================
+void BRepClass3d_SolidBatchClassifier::prepareTriangulation()
+{
+  myTriangles.Nullify();
+  myDeflection = 0.0;
+  if (myShape.IsNull())
+  {
+    return;
+  }
+
+  // The parity of the number of intersections with the boundary
+  // is valid only for closed shells without internal faces.
+  for (TopExp_Explorer anExp (myShape, TopAbs_SHELL); anExp.More(); anExp.Next())
+  {
+    if (!BRep_Tool::IsClosed (anExp.Current()))
+    {
+      return;
+    }
+  }
+
+  BRepExtrema_ShapeList aFaces;
+  for (TopExp_Explorer anExp (myShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face (anExp.Current());
+    if (aFace.Orientation() == TopAbs_INTERNAL
+     || aFace.Orientation() == TopAbs_EXTERNAL)
+    {
+      return;
+    }
+
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+    if (aTriangulation.IsNull() || aTriangulation->NbTriangles() == 0)
+    {
+      return;
+    }
+    myDeflection = Max (myDeflection, aTriangulation->Deflection());
+    aFaces.Append (aFace);
+  }
+
+  if (aFaces.IsEmpty())
+  {
+    return;
+  }
+
+  myTriangles = new BRepExtrema_TriangleSet (aFaces);
+  if (myTriangles->Size() == 0)
+  {
+    myTriangles.Nullify();
+    return;
+  }
+
+  // build the tree before the parallel access
+  myTriangles->BVH();
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void BRepClass3d_SolidBatchClassifier::Perform (const TColgp_Array1OfPnt& thePoints,
+                                                const Standard_Real       theTol)
+{
+  myIsDone = Standard_False;
+  myNbExact = 0;
+  if (myShape.IsNull() || thePoints.IsEmpty())
+  {
+    myStates = NCollection_Array1<TopAbs_State>();
+    return;
+  }
+
+  myStates.Resize (thePoints.Lower(), thePoints.Upper(), Standard_False);
+  NCollection_Array1<Standard_Boolean> anIsExact (thePoints.Lower(), thePoints.Upper());
+
+  // Points in this band around the triangulation are classified by exact algorithm.
+  // The triangulation may deviate from the surfaces more than its deflection
+  // (it is controlled only in the sampling points), thus it is doubled.
+  const Standard_Real aBoundaryDist = 2.0 * myDeflection + myMaxTolerance + theTol;
+
+  Bnd_Box aBox = myBox;
+  aBox.Enlarge (aBoundaryDist);
+
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = myIsParallel ? aThreadPool->NbDefaultThreadsToLaunch() : 1;
+  OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+
+  const Handle(BRepExtrema_TriangleSet) aTriangles =
+    myToUseTriangulation ? myTriangles : Handle(BRepExtrema_TriangleSet)();
+  BatchClassifierFunctor aFunctor (myShape, thePoints, theTol, aBox, aTriangles, aBoundaryDist,
+                                   aLauncher.NbThreads(), myStates, anIsExact);
+  aLauncher.Perform (thePoints.Lower(), thePoints.Upper() + 1, aFunctor);
+
+  for (Standard_Integer i = anIsExact.Lower(); i <= anIsExact.Upper(); ++i)
+  {
+    if (anIsExact (i))
+    {
+      ++myNbExact;
+    }
+  }
+  myIsDone = Standard_True;
+}
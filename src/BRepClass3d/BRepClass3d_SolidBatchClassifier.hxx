@@ -0,0 +1,117 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepClass3d_SolidBatchClassifier_HeaderFile
+#define _BRepClass3d_SolidBatchClassifier_HeaderFile
+
+#include <Bnd_Box.hxx>
+#include <BRepExtrema_TriangleSet.hxx>
+#include <NCollection_Array1.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TopAbs_State.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! Provides an algorithm to classify a large number of points
+//! relatively the same solid.
+//!
+//! The algorithm uses the triangulation of the faces of the solid (if all
+//! faces are triangulated and the shells are closed) to classify the points
+//! which are far from the boundary. For such points the BVH tree built on the
+//! triangles is used to check the distance to the boundary and to count the
+//! intersections of the ray started from the point with the triangulation.
+//! The points located closer to the boundary than the deflection of the
+//! triangulation (enlarged by the tolerances of the solid and the given
+//! tolerance), and the points for which the ray passes too close to the edges
+//! of the triangles, are classified by the exact BRepClass3d_SolidClassifier.
+//!
+//! The points are classified in parallel if requested.
+//! The result does not depend on the number of threads.
+class BRepClass3d_SolidBatchClassifier
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+public: //! @name Constructors
+
+  //! Empty constructor
+  Standard_EXPORT BRepClass3d_SolidBatchClassifier();
+
+  //! Constructor from the solid
+  Standard_EXPORT BRepClass3d_SolidBatchClassifier (const TopoDS_Shape& theSolid);
+
+public: //! @name Setting the data
+
+  //! Loads the solid and prepares the BVH tree of its triangulation.
+  Standard_EXPORT void Load (const TopoDS_Shape& theSolid);
+
+  //! Sets the flag of parallel processing of the points.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  Standard_Boolean IsRunParallel() const { return myIsParallel; }
+
+  //! Allows (default) or forbids using the triangulation of the solid.
+  //! If forbidden, all points are classified by the exact algorithm.
+  void SetUseTriangulation (const Standard_Boolean theToUse) { myToUseTriangulation = theToUse; }
+
+  //! Returns the flag of using the triangulation of the solid.
+  Standard_Boolean IsUseTriangulation() const { return myToUseTriangulation; }
+
+public: //! @name Performing classification
+
+  //! Classifies the points with the given tolerance.
+  Standard_EXPORT void Perform (const TColgp_Array1OfPnt& thePoints,
+                                const Standard_Real       theTol);
+
+public: //! @name Getting the results
+
+  //! Returns true if the classification has been performed
+  Standard_Boolean IsDone() const { return myIsDone; }
+
+  //! Returns the state of the point with the given index
+  //! (in the range of the array given to Perform()).
+  TopAbs_State State (const Standard_Integer theIndex) const { return myStates.Value (theIndex); }
+
+  //! Returns the states of all points.
+  const NCollection_Array1<TopAbs_State>& States() const { return myStates; }
+
+  //! Returns true if the triangulation of the solid has been used
+  //! for classification of the points far from the boundary.
+  Standard_Boolean HasTriangulation() const { return !myTriangles.IsNull(); }
+
+  //! Returns the number of points classified by the exact algorithm
+  //! during the last call of Perform().
+  Standard_Integer NbExactClassifications() const { return myNbExact; }
+
+private:
+
+  //! Checks whether the triangulation of the solid can be used
+  //! for the parity test and builds the BVH tree.
+  void prepareTriangulation();
+
+private:
+
+  TopoDS_Shape myShape;                            //!< Solid to classify the points in
+  Bnd_Box myBox;                                   //!< Bounding box of the solid
+  Handle(BRepExtrema_TriangleSet) myTriangles;     //!< Triangles of the faces of the solid
+  Standard_Real myDeflection;                      //!< Maximal deflection of the triangulation
+  Standard_Real myMaxTolerance;                    //!< Maximal tolerance of the sub-shapes
+  Standard_Boolean myIsParallel;                   //!< Parallel processing flag
+  Standard_Boolean myToUseTriangulation;           //!< Use of triangulation flag
+  Standard_Boolean myIsDone;                       //!< State of the algorithm
+  Standard_Integer myNbExact;                      //!< Number of exact classifications
+  NCollection_Array1<TopAbs_State> myStates;       //!< States of the points
+};
+
+#endif // _BRepClass3d_SolidBatchClassifier_HeaderFile
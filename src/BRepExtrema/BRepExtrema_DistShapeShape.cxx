@@ -33,6 +33,9 @@
 #include <BRepExtrema_UnCompatibleShape.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
+#include <Bnd_Tools.hxx>
+#include <BVH_BoxSet.hxx>
+#include <BVH_Traverse.hxx>
 #include <NCollection_Vector.hxx>
 #include <OSD_Parallel.hxx>
 #include <StdFail_NotDone.hxx>
@@ -95,11 +98,18 @@ namespace
       Distance (theDistance) {}
   };
 
-  // Used by std::sort function
+  // Used by std::sort function.
+  // The pairs with the same distance are ordered by indices of sub-shapes
+  // to keep the order independent on the way of selection of pairs.
   static Standard_Boolean BRepExtrema_CheckPair_Comparator (const BRepExtrema_CheckPair& theLeft,
                                                             const BRepExtrema_CheckPair& theRight)
   {
-    return (theLeft.Distance < theRight.Distance);
+    if (theLeft.Distance != theRight.Distance)
+    {
+      return theLeft.Distance < theRight.Distance;
+    }
+    return theLeft.Index1 < theRight.Index1
+       || (theLeft.Index1 == theRight.Index1 && theLeft.Index2 < theRight.Index2);
   }
 }
 
@@ -390,80 +400,91 @@ struct DistanceFunctor
 
 
 //=======================================================================
-//struct   : DistancePairFunctor
-//purpose  : 
+//class    : BRepExtrema_CheckPairSelector
+//purpose  : Selects the pairs of sub-shapes with the distance between
+//           bounding boxes not exceeding the reference distance
 //=======================================================================
-struct DistancePairFunctor
+class BRepExtrema_CheckPairSelector :
+  public BVH_PairTraverse<Standard_Real, 3, BVH_BoxSet<Standard_Real, 3, Standard_Integer> >
 {
-  DistancePairFunctor(NCollection_Array1<IndexBand>* theBandArray,
-                      const Message_ProgressRange& theRange):
-    BandArray(theBandArray),
-    PairList(0, theBandArray->Size() - 1),
-    LBox1(NULL),
-    LBox2(NULL),
-    Scope(theRange, "Boxes distances calculating", theBandArray->Size()),
-    Ranges(0, theBandArray->Size() - 1),
-    DistRef(0),
-    Eps(Precision::Confusion())
+public:
+
+  //! Constructor
+  BRepExtrema_CheckPairSelector (const Bnd_Array1OfBox& theLBox1,
+                                 const Bnd_Array1OfBox& theLBox2,
+                                 const Standard_Real    theDistRef,
+                                 const Standard_Real    theEps)
+  : myLBox1 (theLBox1),
+    myLBox2 (theLBox2),
+    myDistRef (theDistRef),
+    myEps (theEps)
+  {}
+
+  //! Returns the selected pairs
+  NCollection_Vector<BRepExtrema_CheckPair>& Pairs() { return myPairs; }
+
+  //! Rejects the pair of nodes if the distance between their boxes
+  //! (which is the lower bound for the distance between sub-shapes)
+  //! exceeds the reference distance
+  virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin1,
+                                       const BVH_Vec3d& theCMax1,
+                                       const BVH_Vec3d& theCMin2,
+                                       const BVH_Vec3d& theCMax2,
+                                       Standard_Real&) const Standard_OVERRIDE
   {
-    for (Standard_Integer i = 0; i < theBandArray->Size(); ++i)
+    Standard_Real aSqDist = 0.0;
+    for (Standard_Integer i = 0; i < 3; ++i)
     {
-      Ranges.SetValue(i, Scope.Next());
+      const Standard_Real aGap = Max (theCMin2[i] - theCMax1[i], theCMin1[i] - theCMax2[i]);
+      if (aGap > 0.0)
+      {
+        aSqDist += aGap * aGap;
+      }
     }
+    return Sqrt (aSqDist) - myDistRef > myEps;
   }
 
-  void operator() (const Standard_Integer theIndex) const
+  //! Accepts the pair of sub-shapes with the same criterion as for all pairs
+  virtual Standard_Boolean Accept (const Standard_Integer theIndex1,
+                                   const Standard_Integer theIndex2) Standard_OVERRIDE
   {
-    const Standard_Integer aFirst = BandArray->Value(theIndex).First;
-    const Standard_Integer aLast  = BandArray->Value(theIndex).Last;
-
-    Message_ProgressScope aScope(Ranges[theIndex], NULL, (double) aLast - aFirst);
-
-    for (Standard_Integer anIdx1 = aFirst; anIdx1 <= aLast; ++anIdx1)
+    const Standard_Integer anIdx1 = myBVHSet1->Element (theIndex1);
+    const Standard_Integer anIdx2 = myBVHSet2->Element (theIndex2);
+    const Standard_Real aDist = myLBox1.Value (anIdx1).Distance (myLBox2.Value (anIdx2));
+    if (aDist - myDistRef < myEps)
     {
-      if (!aScope.More())
-      {
-        break;
-      }
-      aScope.Next();
-
-      for (Standard_Integer anIdx2 = 1; anIdx2 <= LBox2->Size(); ++anIdx2)
-      {
-        const Bnd_Box& aBox1 = LBox1->Value(anIdx1);
-        const Bnd_Box& aBox2 = LBox2->Value(anIdx2);
-        if (aBox1.IsVoid() || aBox2.IsVoid())
-        {
-          continue;
-        }
-
-        const Standard_Real aDist = aBox1.Distance(aBox2);       
-        if (aDist - DistRef < Eps)
-        {
-          PairList[theIndex].Append(BRepExtrema_CheckPair(anIdx1, anIdx2, aDist));
-        }
-      }
+      myPairs.Append (BRepExtrema_CheckPair (anIdx1, anIdx2, aDist));
+      return Standard_True;
     }
+    return Standard_False;
   }
 
-  Standard_Integer ListSize()
+private:
+  const Bnd_Array1OfBox& myLBox1;
+  const Bnd_Array1OfBox& myLBox2;
+  Standard_Real myDistRef;
+  Standard_Real myEps;
+  NCollection_Vector<BRepExtrema_CheckPair> myPairs;
+};
+
+//=======================================================================
+//function : fillBoxSet
+//purpose  : 
+//=======================================================================
+static void fillBoxSet (const Bnd_Array1OfBox& theLBox,
+                        BVH_BoxSet<Standard_Real, 3, Standard_Integer>& theSet)
+{
+  theSet.SetSize (theLBox.Size());
+  for (Standard_Integer anIdx = theLBox.Lower(); anIdx <= theLBox.Upper(); ++anIdx)
   {
-    Standard_Integer aSize(0);
-    for (Standard_Integer anI = PairList.Lower(); anI <= PairList.Upper(); ++anI)
+    const Bnd_Box& aBox = theLBox.Value (anIdx);
+    if (!aBox.IsVoid())
     {
-      aSize += PairList[anI].Size();
+      theSet.Add (anIdx, Bnd_Tools::Bnd2BVH (aBox));
     }
-    return aSize;
   }
-
-  NCollection_Array1<IndexBand>*             BandArray;
-  mutable NCollection_Array1<NCollection_Vector<BRepExtrema_CheckPair> > PairList;
-  const Bnd_Array1OfBox*                     LBox1;
-  const Bnd_Array1OfBox*                     LBox2;
-  Message_ProgressScope                      Scope;
-  NCollection_Array1<Message_ProgressRange>  Ranges;
-  Standard_Real                              DistRef;
-  Standard_Real                              Eps;
-};
+  theSet.Build();
+}
 
 //=======================================================================
 //function : DistanceMapMap
@@ -488,57 +509,35 @@ Standard_Boolean BRepExtrema_DistShapeShape::DistanceMapMap (const TopTools_Inde
 
   const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
   const Standard_Integer aNbThreads = aThreadPool->NbThreads();
-  const Standard_Integer aMinPairTaskSize = aCount1 < 10 ? aCount1 : 10;
-  Standard_Integer aNbPairTasks = aNbThreads;
-  Standard_Integer aPairTaskSize = (Standard_Integer) Ceiling((double) aCount1 / aNbPairTasks);
-  if (aPairTaskSize < aMinPairTaskSize)
-  {
-    aPairTaskSize = aMinPairTaskSize;
-    aNbPairTasks = (Standard_Integer) Ceiling((double) aCount1 / aPairTaskSize);
-  }
-
-  Standard_Integer aFirstIndex(1);
-  NCollection_Array1<IndexBand> aBandArray(0, aNbPairTasks - 1);
-
-  for (Standard_Integer anI = 0; anI < aBandArray.Size(); ++anI)
-  {
-    if (aCount1 < aFirstIndex + aPairTaskSize - 1)
-    {
-      aPairTaskSize = aCount1 - aFirstIndex + 1;
-    }
-    aBandArray.SetValue(anI, IndexBand(aFirstIndex, aFirstIndex + aPairTaskSize - 1));
-    aFirstIndex += aPairTaskSize;
-  }
 
+  // Select the pairs of sub-shapes which may be closer than the reference distance
+  // by the simultaneous traverse of the BVH trees built on the bounding boxes
   aTwinScope.Next(0.15);
-  DistancePairFunctor aPairFunctor(&aBandArray, aTwinScope.Next(0.15));
-  aPairFunctor.LBox1 = &theLBox1;
-  aPairFunctor.LBox2 = &theLBox2;
-  aPairFunctor.DistRef = myDistRef;
-  aPairFunctor.Eps = myEps;
+  BVH_BoxSet<Standard_Real, 3, Standard_Integer> aBoxSet1, aBoxSet2;
+  fillBoxSet (theLBox1, aBoxSet1);
+  fillBoxSet (theLBox2, aBoxSet2);
 
-  OSD_Parallel::For(0, aNbPairTasks, aPairFunctor, !myIsMultiThread);
+  BRepExtrema_CheckPairSelector aSelector (theLBox1, theLBox2, myDistRef, myEps);
+  aSelector.SetBVHSets (&aBoxSet1, &aBoxSet2);
+  aSelector.Select();
+  aTwinScope.Next(0.15);
   if (!aTwinScope.More())
   {
     return Standard_False;
   }
-  Standard_Integer aListSize = aPairFunctor.ListSize();
-  if(aListSize == 0)
+  const NCollection_Vector<BRepExtrema_CheckPair>& aSelected = aSelector.Pairs();
+  if (aSelected.IsEmpty())
   {
     return Standard_True;
   }
-  NCollection_Array1<BRepExtrema_CheckPair> aPairList(0, aListSize-1);
+  NCollection_Array1<BRepExtrema_CheckPair> aPairList(0, aSelected.Size() - 1);
   Standard_Integer aListIndex(0);
-  for (Standard_Integer anI = 0; anI < aPairFunctor.PairList.Size(); ++anI)
+  for (NCollection_Vector<BRepExtrema_CheckPair>::Iterator anIt (aSelected); anIt.More(); anIt.Next())
   {
-    for (Standard_Integer aJ = 0; aJ < aPairFunctor.PairList[anI].Size(); ++aJ)
-    {
-      aPairList[aListIndex] = aPairFunctor.PairList[anI][aJ];
-      ++aListIndex;
-    }
+    aPairList[aListIndex++] = anIt.Value();
   }
 
-  std::stable_sort(aPairList.begin(), aPairList.end(), BRepExtrema_CheckPair_Comparator);
+  std::sort(aPairList.begin(), aPairList.end(), BRepExtrema_CheckPair_Comparator);
 
   const Standard_Integer aMapSize = aPairList.Size();
   Standard_Integer aNbTasks = aMapSize < aNbThreads ? aMapSize : aNbThreads;
@@ -547,7 +546,7 @@ Standard_Boolean BRepExtrema_DistShapeShape::DistanceMapMap (const TopTools_Inde
   NCollection_Array1<NCollection_Array1<BRepExtrema_CheckPair> > anArrayOfArray(0, aNbTasks - 1);
   // Since aPairList is sorted in ascending order of distances between Bnd_Boxes,
   // BRepExtrema_CheckPair are distributed to tasks one by one from smallest to largest,
-  // and not ranges, as for DistancePairFunctor.
+  // and not by ranges of indices.
   // Since aMapSize may not be divisible entirely by the number of tasks,
   // some tasks should receive one BRepExtrema_CheckPair less than the rest.
   // aLastRowLimit defines the task number from which to start tasks containing
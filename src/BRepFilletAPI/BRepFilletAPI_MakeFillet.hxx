@@ -73,6 +73,14 @@ public:
   //! and support'faces.
   Standard_EXPORT void SetContinuity (const GeomAbs_Shape InternalContinuity, const Standard_Real AngularTolerance);
   
+  //! Sets the flag of parallel processing.
+  //! In parallel mode the intersections between the fillets
+  //! of independent contours are checked simultaneously.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myBuilder.SetRunParallel (theIsParallel); }
+  
+  //! Returns the flag of parallel processing.
+  Standard_Boolean IsRunParallel() const { return myBuilder.IsRunParallel(); }
+  
   //! Adds a  fillet contour in  the  builder  (builds a
   //! contour  of tangent edges).
   //! The Radius must be set after.
@@ -27,6 +27,8 @@
 #include <BRep_Tool.hxx>  
 #include <TopTools_MapOfShape.hxx>
 #include <BRepCheck_Shell.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 
 #ifdef OCCT_DEBUG
 static Standard_Integer AffichEps = 0;
@@ -65,6 +67,149 @@ static gp_Pnt roughBaryCenter(const TopoDS_Shape& S){
   return gp_Pnt(xyz);
 }
 
+namespace
+{
+  //! Face to be integrated and its properties.
+  //! The properties of the faces are computed independently (possibly in parallel)
+  //! and then added to the global properties sequentially in the order of the faces,
+  //! so that the result does not depend on the number of threads.
+  struct BRepGProp_FaceTask
+  {
+    BRepGProp_FaceTask() : Index (0), UseMesh (Standard_False), Error (0.0) {}
+
+    BRepGProp_FaceTask (const TopoDS_Face&     theFace,
+                        const Standard_Integer theIndex,
+                        const Standard_Boolean theUseMesh)
+    : Face (theFace), Index (theIndex), UseMesh (theUseMesh), Error (0.0) {}
+
+    TopoDS_Face      Face;    //!< Face to integrate
+    Standard_Integer Index;   //!< Index of the face in the shape
+    Standard_Boolean UseMesh; //!< Use the triangulation of the face instead of the surface
+    GProp_GProps     Props;   //!< Properties of the face
+    Standard_Real    Error;   //!< Error of the integration
+  };
+
+  typedef NCollection_Vector<BRepGProp_FaceTask> BRepGProp_VectorOfFaceTask;
+
+  //=======================================================================
+  //class    : BRepGProp_InertFunctor
+  //purpose  : Computes surface or volume properties of the face
+  //           using the Gauss integration or the triangulation
+  //=======================================================================
+  template <class InertType>
+  class BRepGProp_InertFunctor
+  {
+  public:
+    BRepGProp_InertFunctor (BRepGProp_VectorOfFaceTask&        theTasks,
+                            const gp_Pnt&                      theLocation,
+                            const Standard_Real                theEps,
+                            const BRepGProp_MeshProps::BRepGProp_MeshObjType theMeshType)
+    : myTasks (theTasks), myLocation (theLocation), myEps (theEps), myMeshType (theMeshType) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      BRepGProp_FaceTask& aTask = myTasks.ChangeValue (theIndex);
+      const TopoDS_Face& F = aTask.Face;
+      if (aTask.UseMesh)
+      {
+        TopLoc_Location aLoc;
+        const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation (F, aLoc);
+        BRepGProp_MeshProps MG (myMeshType);
+        MG.SetLocation (myLocation);
+        MG.Perform (aTri, aLoc, F.Orientation());
+        aTask.Props = MG;
+        return;
+      }
+
+      InertType G;
+      G.SetLocation (myLocation);
+      BRepGProp_Face   BF;
+      BRepGProp_Domain BD;
+      BF.Load (F);
+      Standard_Boolean IsNatRestr = (F.NbChildren() == 0);
+      if (!IsNatRestr) BD.Init (F);
+      if (myEps < 1.0) {
+        G.Perform (BF, BD, myEps);
+        aTask.Error = G.GetEpsilon();
+      }
+      else {
+        if (IsNatRestr) G.Perform (BF);
+        else G.Perform (BF, BD);
+      }
+      aTask.Props = G;
+    }
+
+  private:
+    BRepGProp_InertFunctor& operator= (const BRepGProp_InertFunctor&);
+
+  private:
+    BRepGProp_VectorOfFaceTask& myTasks;
+    gp_Pnt                      myLocation;
+    Standard_Real               myEps;
+    BRepGProp_MeshProps::BRepGProp_MeshObjType myMeshType;
+  };
+
+  //=======================================================================
+  //class    : BRepGProp_VinertGKFunctor
+  //purpose  : Computes volume properties of the face
+  //           using the Gauss-Kronrod integration
+  //=======================================================================
+  class BRepGProp_VinertGKFunctor
+  {
+  public:
+    BRepGProp_VinertGKFunctor (BRepGProp_VectorOfFaceTask& theTasks,
+                               const gp_Pnt&               theLocation,
+                               const gp_Pln*               thePln,
+                               const Standard_Real         theTol,
+                               const Standard_Boolean      theIsUseSpan,
+                               const Standard_Boolean      theCGFlag,
+                               const Standard_Boolean      theIFlag)
+    : myTasks (theTasks), myLocation (theLocation), myPln (thePln), myTol (theTol),
+      myIsUseSpan (theIsUseSpan), myCGFlag (theCGFlag), myIFlag (theIFlag) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      BRepGProp_FaceTask& aTask = myTasks.ChangeValue (theIndex);
+      const TopoDS_Face& aFace = aTask.Face;
+
+      BRepGProp_VinertGK aVProps;
+      aVProps.SetLocation (myLocation);
+      BRepGProp_Face   aPropFace (myIsUseSpan);
+      BRepGProp_Domain aPropDomain;
+      aPropFace.Load (aFace);
+
+      Standard_Boolean IsNatRestr = (aFace.NbChildren () == 0);
+      if (!IsNatRestr)
+        aPropDomain.Init (aFace);
+      if (myPln != NULL)
+      {
+        aTask.Error = IsNatRestr
+                    ? aVProps.Perform (aPropFace, *myPln, myTol, myCGFlag, myIFlag)
+                    : aVProps.Perform (aPropFace, aPropDomain, *myPln, myTol, myCGFlag, myIFlag);
+      }
+      else
+      {
+        aTask.Error = IsNatRestr
+                    ? aVProps.Perform (aPropFace, myTol, myCGFlag, myIFlag)
+                    : aVProps.Perform (aPropFace, aPropDomain, myTol, myCGFlag, myIFlag);
+      }
+      aTask.Props = aVProps;
+    }
+
+  private:
+    BRepGProp_VinertGKFunctor& operator= (const BRepGProp_VinertGKFunctor&);
+
+  private:
+    BRepGProp_VectorOfFaceTask& myTasks;
+    gp_Pnt                      myLocation;
+    const gp_Pln*               myPln;
+    Standard_Real               myTol;
+    Standard_Boolean            myIsUseSpan;
+    Standard_Boolean            myCGFlag;
+    Standard_Boolean            myIFlag;
+  };
+}
+
 
 
 void  BRepGProp::LinearProperties(const TopoDS_Shape& S, GProp_GProps& SProps, const Standard_Boolean SkipShared,
@@ -111,7 +256,7 @@ void  BRepGProp::LinearProperties(const TopoDS_Shape& S, GProp_GProps& SProps, c
 }
 
 static Standard_Real surfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
-                                       const Standard_Boolean UseTriangulation)
+                                       const Standard_Boolean UseTriangulation, const Standard_Boolean RunParallel)
 {
   Standard_Integer i;
 #ifdef OCCT_DEBUG
@@ -120,12 +265,8 @@ static Standard_Real surfaceProperties(const TopoDS_Shape& S, GProp_GProps& Prop
   Standard_Real ErrorMax = 0.0, Error;
   TopExp_Explorer ex; 
   gp_Pnt P(roughBaryCenter(S));
-  BRepGProp_Sinert G;  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Sinert);  
-  MG.SetLocation(P);
 
-  BRepGProp_Face   BF;
-  BRepGProp_Domain BD;
+  BRepGProp_VectorOfFaceTask aTasks;
   TopTools_MapOfShape aFMap;
   TopLoc_Location aLocDummy;
 
@@ -154,37 +295,27 @@ static Standard_Real surfaceProperties(const TopoDS_Shape& S, GProp_GProps& Prop
       }
     }
 
-    if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
-    {
-      TopAbs_Orientation anOri = F.Orientation();
-      const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      MG.Perform(aTri, aLocDummy, anOri);
-      Props.Add(MG);
-    }
-    else
-    {
-      BF.Load(F);
-      Standard_Boolean IsNatRestr = (F.NbChildren() == 0);
-      if (!IsNatRestr) BD.Init(F);
-      if (Eps < 1.0) {
-        G.Perform(BF, BD, Eps);
-        Error = G.GetEpsilon();
-        if (ErrorMax < Error) {
-          ErrorMax = Error;
+    aTasks.Append (BRepGProp_FaceTask (F, i, (UseTriangulation && !NoTri) || (NoSurf && !NoTri)));
+  }
+
+  BRepGProp_InertFunctor<BRepGProp_Sinert> aFunctor (aTasks, P, Eps, BRepGProp_MeshProps::Sinert);
+  OSD_Parallel::For (0, aTasks.Length(), aFunctor, !RunParallel);
+
+  for (BRepGProp_VectorOfFaceTask::Iterator anIt (aTasks); anIt.More(); anIt.Next()) {
+    const BRepGProp_FaceTask& aTask = anIt.Value();
+    if (!aTask.UseMesh && Eps < 1.0) {
+      Error = aTask.Error;
+      if (ErrorMax < Error) {
+        ErrorMax = Error;
 #ifdef OCCT_DEBUG
-          iErrorMax = i;
+        iErrorMax = aTask.Index;
 #endif
-        }
       }
-      else {
-        if (IsNatRestr) G.Perform(BF);
-        else G.Perform(BF, BD);
-      }
-      Props.Add(G);
 #ifdef OCCT_DEBUG
-      if(AffichEps) std::cout<<"\n"<<i<<":\tEpsArea = "<< G.GetEpsilon();
+      if(AffichEps) std::cout<<"\n"<<aTask.Index<<":\tEpsArea = "<< Error;
 #endif
     }
+    Props.Add(aTask.Props);
   }
 #ifdef OCCT_DEBUG
   if(AffichEps) std::cout<<"\n-----------------\n"<<iErrorMax<<":\tMaxError = "<<ErrorMax<<"\n";
@@ -192,19 +323,20 @@ static Standard_Real surfaceProperties(const TopoDS_Shape& S, GProp_GProps& Prop
   return ErrorMax;
 }
 void  BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Boolean SkipShared,
-                                   const Standard_Boolean UseTriangulation)
+                                   const Standard_Boolean UseTriangulation, const Standard_Boolean RunParallel)
 {
   // find the origin
   gp_Pnt P(0,0,0);
   P.Transform(S.Location());
   Props = GProp_GProps(P);
-  surfaceProperties(S,Props,1.0, SkipShared, UseTriangulation);
+  surfaceProperties(S,Props,1.0, SkipShared, UseTriangulation, RunParallel);
 }
-Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared){ 
+Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
+                                           const Standard_Boolean RunParallel){ 
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
   Props = GProp_GProps(P);
-  Standard_Real ErrorMax = surfaceProperties(S,Props,Eps,SkipShared, Standard_False);
+  Standard_Real ErrorMax = surfaceProperties(S,Props,Eps,SkipShared, Standard_False, RunParallel);
   return ErrorMax;
 }
 
@@ -214,7 +346,7 @@ Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps&
 //=======================================================================
 
 static Standard_Real volumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
-                                      const Standard_Boolean UseTriangulation)
+                                      const Standard_Boolean UseTriangulation, const Standard_Boolean RunParallel)
 {
   Standard_Integer i;
 #ifdef OCCT_DEBUG
@@ -223,12 +355,8 @@ static Standard_Real volumeProperties(const TopoDS_Shape& S, GProp_GProps& Props
   Standard_Real ErrorMax = 0.0, Error = 0.0;
   TopExp_Explorer ex; 
   gp_Pnt P(roughBaryCenter(S)); 
-  BRepGProp_Vinert G;  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Vinert);
-  MG.SetLocation(P);
 
-  BRepGProp_Face   BF;
-  BRepGProp_Domain BD;
+  BRepGProp_VectorOfFaceTask aTasks;
   TopTools_MapOfShape aFwdFMap;
   TopTools_MapOfShape aRvsFMap;
   TopLoc_Location aLocDummy;
@@ -269,37 +397,28 @@ static Standard_Real volumeProperties(const TopoDS_Shape& S, GProp_GProps& Props
 
     if (isFwd || isRvs)
     {
-      if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
-      {
-        const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-        MG.Perform(aTri, aLocDummy, anOri);
-        Props.Add(MG);
-      }
-      else
-      {
-        BF.Load(F);
-        Standard_Boolean IsNatRestr = (F.NbChildren () == 0);
-        if (!IsNatRestr) BD.Init(F);
-        if (Eps < 1.0) {
-          G.Perform(BF, BD, Eps);
-          Error = G.GetEpsilon();
-          if (ErrorMax < Error) {
-            ErrorMax = Error;
+      aTasks.Append (BRepGProp_FaceTask (F, i, (UseTriangulation && !NoTri) || (NoSurf && !NoTri)));
+    }
+  }
+
+  BRepGProp_InertFunctor<BRepGProp_Vinert> aFunctor (aTasks, P, Eps, BRepGProp_MeshProps::Vinert);
+  OSD_Parallel::For (0, aTasks.Length(), aFunctor, !RunParallel);
+
+  for (BRepGProp_VectorOfFaceTask::Iterator anIt (aTasks); anIt.More(); anIt.Next()) {
+    const BRepGProp_FaceTask& aTask = anIt.Value();
+    if (!aTask.UseMesh && Eps < 1.0) {
+      Error = aTask.Error;
+      if (ErrorMax < Error) {
+        ErrorMax = Error;
 #ifdef OCCT_DEBUG
-            iErrorMax = i;
+        iErrorMax = aTask.Index;
 #endif
-          }
-        }
-        else {
-          if (IsNatRestr) G.Perform(BF);
-          else G.Perform(BF, BD);
-        }
-        Props.Add(G);
+      }
 #ifdef OCCT_DEBUG
-        if(AffichEps) std::cout<<"\n"<<i<<":\tEpsVolume = "<< G.GetEpsilon();
+      if(AffichEps) std::cout<<"\n"<<aTask.Index<<":\tEpsVolume = "<< Error;
 #endif
-      }
     }
+    Props.Add(aTask.Props);
   }
 #ifdef OCCT_DEBUG
   if(AffichEps) std::cout<<"\n-----------------\n"<<iErrorMax<<":\tMaxError = "<<ErrorMax<<"\n";
@@ -307,7 +426,7 @@ static Standard_Real volumeProperties(const TopoDS_Shape& S, GProp_GProps& Props
   return ErrorMax;
 }
 void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared,
-                                  const Standard_Boolean UseTriangulation)
+                                  const Standard_Boolean UseTriangulation, const Standard_Boolean RunParallel)
 {
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
@@ -321,9 +440,9 @@ void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, co
       {
         continue;
       }
-      if(BRep_Tool::IsClosed(Sh)) volumeProperties(Sh,Props,1.0,SkipShared, UseTriangulation);
+      if(BRep_Tool::IsClosed(Sh)) volumeProperties(Sh,Props,1.0,SkipShared, UseTriangulation, RunParallel);
     }
-  } else volumeProperties(S,Props,1.0,SkipShared, UseTriangulation);
+  } else volumeProperties(S,Props,1.0,SkipShared, UseTriangulation, RunParallel);
 }
 
 //=======================================================================
@@ -332,7 +451,8 @@ void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, co
 //=======================================================================
 
 Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, 
-  const Standard_Real Eps, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared)
+  const Standard_Real Eps, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared,
+  const Standard_Boolean RunParallel)
 { 
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
@@ -352,7 +472,7 @@ Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& P
         continue;
       }
       if(BRep_Tool::IsClosed(Sh)) {
-        Error = volumeProperties(Sh,Props,Eps,SkipShared, Standard_False);
+        Error = volumeProperties(Sh,Props,Eps,SkipShared, Standard_False, RunParallel);
         if(ErrorMax < Error) {
           ErrorMax = Error;
 #ifdef OCCT_DEBUG
@@ -361,7 +481,7 @@ Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& P
         }
       }
     }
-  } else ErrorMax = volumeProperties(S,Props,Eps,SkipShared, Standard_False);
+  } else ErrorMax = volumeProperties(S,Props,Eps,SkipShared, Standard_False, RunParallel);
 #ifdef OCCT_DEBUG
   if(AffichEps) std::cout<<"\n\n==================="<<iErrorMax<<":\tMaxEpsVolume = "<<ErrorMax<<"\n";
 #endif
@@ -378,10 +498,12 @@ Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& P
 
 static Standard_Real volumePropertiesGK(const TopoDS_Shape     &theShape,
   GProp_GProps     &theProps,
+  const gp_Pln*           thePln,
   const Standard_Real     theTol,
   const Standard_Boolean  IsUseSpan,
   const Standard_Boolean  CGFlag,
-  const Standard_Boolean  IFlag, const Standard_Boolean SkipShared)
+  const Standard_Boolean  IFlag, const Standard_Boolean SkipShared,
+  const Standard_Boolean  RunParallel)
 {
   TopExp_Explorer  anExp;
   anExp.Init(theShape, TopAbs_FACE);
@@ -390,18 +512,13 @@ static Standard_Real volumePropertiesGK(const TopoDS_Shape     &theShape,
 
   // Compute properties.
   gp_Pnt           aLoc(roughBaryCenter(theShape)); 
-  BRepGProp_VinertGK aVProps;
-  BRepGProp_Face   aPropFace(IsUseSpan);
-  BRepGProp_Domain aPropDomain;
-  Standard_Real    aLocalError;
   Standard_Real    anError = 0.;
+  BRepGProp_VectorOfFaceTask aTasks;
   TopTools_MapOfShape aFwdFMap;
   TopTools_MapOfShape aRvsFMap;
   TopLoc_Location aLocDummy;
 
-  aVProps.SetLocation(aLoc);
-
-  for (; anExp.More(); anExp.Next()) {
+  for (Standard_Integer i = 1; anExp.More(); anExp.Next(), i++) {
     TopoDS_Face aFace = TopoDS::Face(anExp.Current());
     TopAbs_Orientation anOri = aFace.Orientation();
     Standard_Boolean isFwd = anOri == TopAbs_FORWARD;
@@ -427,22 +544,20 @@ static Standard_Real volumePropertiesGK(const TopoDS_Shape     &theShape,
     }
 
     if (isFwd || isRvs){
-        aPropFace.Load(aFace);
-
-        Standard_Boolean IsNatRestr = (aFace.NbChildren () == 0);
-        if(IsNatRestr)
-          aLocalError = aVProps.Perform(aPropFace, aTol, CGFlag, IFlag);
-        else {
-          aPropDomain.Init(aFace);
-          aLocalError = aVProps.Perform(aPropFace, aPropDomain, aTol, CGFlag, IFlag);
-        }
+      aTasks.Append (BRepGProp_FaceTask (aFace, i, Standard_False));
+    }
+  }
 
-        if (aLocalError < 0.)
-          return aLocalError;
+  BRepGProp_VinertGKFunctor aFunctor (aTasks, aLoc, thePln, aTol, IsUseSpan, CGFlag, IFlag);
+  OSD_Parallel::For (0, aTasks.Length(), aFunctor, !RunParallel);
 
-        anError += aLocalError;
-        theProps.Add(aVProps);
-    }
+  for (BRepGProp_VectorOfFaceTask::Iterator anIt (aTasks); anIt.More(); anIt.Next()) {
+    const BRepGProp_FaceTask& aTask = anIt.Value();
+    if (aTask.Error < 0.)
+      return aTask.Error;
+
+    anError += aTask.Error;
+    theProps.Add(aTask.Props);
   }
 
   return anError;
@@ -459,7 +574,8 @@ Standard_Real BRepGProp::VolumePropertiesGK(const TopoDS_Shape     &S,
   const Standard_Boolean  OnlyClosed,
   const Standard_Boolean  IsUseSpan,
   const Standard_Boolean  CGFlag,
-  const Standard_Boolean  IFlag, const Standard_Boolean SkipShared)
+  const Standard_Boolean  IFlag, const Standard_Boolean SkipShared,
+  const Standard_Boolean  RunParallel)
 { 
   gp_Pnt        P(0,0,0);
   Standard_Real anError = 0.;
@@ -501,7 +617,7 @@ Standard_Real BRepGProp::VolumePropertiesGK(const TopoDS_Shape     &S,
     for (; anIter.More(); anIter.Next()) {
       const TopoDS_Shape &aShell = anIter.Value();
 
-      aLocalError = volumePropertiesGK(aShell, Props, aTol, IsUseSpan, CGFlag, IFlag,SkipShared);
+      aLocalError = volumePropertiesGK(aShell, Props, NULL, aTol, IsUseSpan, CGFlag, IFlag, SkipShared, RunParallel);
 
       if (aLocalError < 0)
         return aLocalError;
@@ -510,7 +626,7 @@ Standard_Real BRepGProp::VolumePropertiesGK(const TopoDS_Shape     &S,
     }
 
   } else
-    anError = volumePropertiesGK(S, Props, Eps, IsUseSpan, CGFlag, IFlag,SkipShared);
+    anError = volumePropertiesGK(S, Props, NULL, Eps, IsUseSpan, CGFlag, IFlag, SkipShared, RunParallel);
 
   Standard_Real vol = Props.Mass();
   if(vol > Epsilon(1.)) anError /= vol;
@@ -522,84 +638,6 @@ Standard_Real BRepGProp::VolumePropertiesGK(const TopoDS_Shape     &S,
 //purpose  : 
 //=======================================================================
 
-static Standard_Real volumePropertiesGK(const TopoDS_Shape     &theShape,
-  GProp_GProps     &theProps,
-  const gp_Pln           &thePln,
-  const Standard_Real     theTol,
-  const Standard_Boolean  IsUseSpan,
-  const Standard_Boolean  CGFlag,
-  const Standard_Boolean  IFlag, const Standard_Boolean SkipShared)
-{
-  TopExp_Explorer  anExp;
-  anExp.Init(theShape, TopAbs_FACE);
-
-  Standard_Real aTol = theTol;
-
-  // Compute properties.
-  gp_Pnt           aLoc(roughBaryCenter(theShape)); 
-  BRepGProp_VinertGK aVProps;
-  BRepGProp_Face   aPropFace(IsUseSpan);
-  BRepGProp_Domain aPropDomain;
-  Standard_Real    aLocalError;
-  Standard_Real    anError = 0.;
-  TopTools_MapOfShape aFwdFMap;
-  TopTools_MapOfShape aRvsFMap;
-  TopLoc_Location aLocDummy;
-
-  aVProps.SetLocation(aLoc);
-
-  for (; anExp.More(); anExp.Next()) {
-    TopoDS_Face aFace = TopoDS::Face(anExp.Current());
-    TopAbs_Orientation anOri = aFace.Orientation();
-    Standard_Boolean isFwd = anOri == TopAbs_FORWARD;
-    Standard_Boolean isRvs = Standard_False;
-    if(!isFwd)
-    {
-      isRvs = anOri == TopAbs_REVERSED;
-    }
-    if(SkipShared)
-    {
-      if((isFwd && !aFwdFMap.Add(aFace)) || (isRvs && !aRvsFMap.Add(aFace)))
-      {
-        continue;
-      }
-    }
-    {
-      const Handle(Geom_Surface)& aSurf = BRep_Tool::Surface (aFace, aLocDummy);
-      if (aSurf.IsNull())
-      {
-        // skip faces without geometry
-        continue;
-      }
-    }
-
-    if (isFwd || isRvs){
-        aPropFace.Load(aFace);
-
-        Standard_Boolean IsNatRestr = (aFace.NbChildren () == 0);
-        if(IsNatRestr)
-          aLocalError = aVProps.Perform(aPropFace, thePln, aTol, CGFlag, IFlag);
-        else {
-          aPropDomain.Init(aFace);
-          aLocalError = aVProps.Perform(aPropFace, aPropDomain, thePln, aTol, CGFlag, IFlag);
-        }
-
-        if (aLocalError < 0.)
-          return aLocalError;
-
-        anError += aLocalError;
-        theProps.Add(aVProps);
-    }
-  }
-
-  return anError;
-}
-
-//=======================================================================
-//function : VolumeProperties
-//purpose  : 
-//=======================================================================
-
 Standard_Real BRepGProp::VolumePropertiesGK(const TopoDS_Shape     &S,
   GProp_GProps     &Props,
   const gp_Pln           &thePln,
@@ -607,7 +645,8 @@ Standard_Real BRepGProp::VolumePropertiesGK(const TopoDS_Shape     &S,
   const Standard_Boolean  OnlyClosed,
   const Standard_Boolean  IsUseSpan,
   const Standard_Boolean  CGFlag,
-  const Standard_Boolean  IFlag, const Standard_Boolean SkipShared)
+  const Standard_Boolean  IFlag, const Standard_Boolean SkipShared,
+  const Standard_Boolean  RunParallel)
 { 
   gp_Pnt        P(0,0,0);
   Standard_Real anError = 0.;
@@ -649,7 +688,7 @@ Standard_Real BRepGProp::VolumePropertiesGK(const TopoDS_Shape     &S,
     for (; anIter.More(); anIter.Next()) {
       const TopoDS_Shape &aShell = anIter.Value();
 
-      aLocalError = volumePropertiesGK(aShell, Props, thePln, aTol, IsUseSpan, CGFlag, IFlag,SkipShared);
+      aLocalError = volumePropertiesGK(aShell, Props, &thePln, aTol, IsUseSpan, CGFlag, IFlag, SkipShared, RunParallel);
 
       if (aLocalError < 0)
         return aLocalError;
@@ -657,7 +696,7 @@ Standard_Real BRepGProp::VolumePropertiesGK(const TopoDS_Shape     &S,
       anError += aLocalError;
     }
   } else
-    anError = volumePropertiesGK(S, Props, thePln, Eps, IsUseSpan, CGFlag, IFlag,SkipShared);
+    anError = volumePropertiesGK(S, Props, &thePln, Eps, IsUseSpan, CGFlag, IFlag, SkipShared, RunParallel);
 
   Standard_Real vol = Props.Mass();
   if(vol > Epsilon(1.)) anError /= vol;
@@ -131,9 +131,12 @@ public:
   //! source of geometry data. If UseTriangulation = Standard_False,
   //! exact geometry objects (surfaces) are used, 
   //! otherwise face triangulations are used first.
+  //! RunParallel is a flag to compute the properties of the faces in parallel.
+  //! The result does not depend on the number of threads.
   Standard_EXPORT static void SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& SProps, 
                                          const Standard_Boolean SkipShared = Standard_False,
-                                  const Standard_Boolean UseTriangulation = Standard_False);
+                                  const Standard_Boolean UseTriangulation = Standard_False,
+                                  const Standard_Boolean RunParallel = Standard_False);
   
   //! Updates <SProps> with the shape <S>, that contains its principal properties.
   //! The surface properties of all the faces in <S> are computed.
@@ -147,8 +150,10 @@ public:
   //! shared topological entities or not
   //! For ex., if SkipShared = True, faces, shared by two or more shells, 
   //! are taken into calculation only once.
+  //! RunParallel is a flag to compute the properties of the faces in parallel.
   Standard_EXPORT static Standard_Real SurfaceProperties (const TopoDS_Shape& S, GProp_GProps& SProps,
-                        const Standard_Real Eps, const Standard_Boolean SkipShared = Standard_False);
+                        const Standard_Real Eps, const Standard_Boolean SkipShared = Standard_False,
+                        const Standard_Boolean RunParallel = Standard_False);
   //!
   //! Computes the global volume properties of the solid
   //! S, and brings them together with the global
@@ -191,10 +196,13 @@ public:
   //! source of geometry data. If UseTriangulation = Standard_False,
   //! exact geometry objects (surfaces) are used, 
   //! otherwise face triangulations are used first.
+  //! RunParallel is a flag to compute the properties of the faces in parallel.
+  //! The result does not depend on the number of threads.
   Standard_EXPORT static void VolumeProperties(const TopoDS_Shape& S, GProp_GProps& VProps, 
                                         const Standard_Boolean OnlyClosed = Standard_False, 
                                         const Standard_Boolean SkipShared = Standard_False,
-                                 const Standard_Boolean UseTriangulation = Standard_False);
+                                 const Standard_Boolean UseTriangulation = Standard_False,
+                                 const Standard_Boolean RunParallel = Standard_False);
   
   //! Updates <VProps> with the shape <S>, that contains its principal properties.
   //! The volume properties of all the FORWARD and REVERSED faces in <S> are computed.
@@ -210,9 +218,11 @@ public:
   //! For ex., if SkipShared = True, the volumes formed by the equal 
   //! (the same TShape, location and orientation) 
   //! faces are taken into calculation only once.
+  //! RunParallel is a flag to compute the properties of the faces in parallel.
   Standard_EXPORT static Standard_Real VolumeProperties (const TopoDS_Shape& S, GProp_GProps& VProps, 
                          const Standard_Real Eps, const Standard_Boolean OnlyClosed = Standard_False, 
-                                                 const Standard_Boolean SkipShared = Standard_False);
+                                                 const Standard_Boolean SkipShared = Standard_False,
+                                                 const Standard_Boolean RunParallel = Standard_False);
   
   //! Updates <VProps> with the shape <S>, that contains its principal properties.
   //! The volume properties of all the FORWARD and REVERSED faces in <S> are computed.
@@ -229,6 +239,8 @@ public:
   //! shared topological entities or not.
   //! For ex., if SkipShared = True, the volumes formed by the equal 
   //! (the same TShape, location and orientation) faces are taken into calculation only once.
+  //! RunParallel is a flag to compute the properties of the faces in parallel.
+  //! The result does not depend on the number of threads.
   Standard_EXPORT static Standard_Real VolumePropertiesGK (const TopoDS_Shape& S, 
     GProp_GProps& VProps, 
     const Standard_Real Eps = 0.001, 
@@ -236,7 +248,8 @@ public:
     const Standard_Boolean IsUseSpan = Standard_False, 
     const Standard_Boolean CGFlag = Standard_False, 
     const Standard_Boolean IFlag = Standard_False, 
-    const Standard_Boolean SkipShared = Standard_False);
+    const Standard_Boolean SkipShared = Standard_False,
+    const Standard_Boolean RunParallel = Standard_False);
   
   Standard_EXPORT static Standard_Real VolumePropertiesGK (const TopoDS_Shape& S, 
     GProp_GProps& VProps, 
@@ -245,7 +258,8 @@ public:
     const Standard_Boolean IsUseSpan = Standard_False, 
     const Standard_Boolean CGFlag = Standard_False, 
     const Standard_Boolean IFlag = Standard_False, 
-    const Standard_Boolean SkipShared = Standard_False);
+    const Standard_Boolean SkipShared = Standard_False,
+    const Standard_Boolean RunParallel = Standard_False);
 
 };
 
@@ -54,6 +54,8 @@
 #include <gp.hxx>
 #include <gp_Ax2.hxx>
 #include <gp_Pln.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <Poly_PolygonOnTriangulation.hxx>
 #include <Poly_Triangulation.hxx>
 #include <Precision.hxx>
@@ -478,26 +480,103 @@ Standard_Boolean  BRepLib::BuildCurves3d(const TopoDS_Shape& S)
 //purpose  : 
 //=======================================================================
 
+namespace
+{
+  //! Computes the 3d curves of the edges.
+  class BRepLib_BuildCurve3dFunctor
+  {
+  public:
+
+    BRepLib_BuildCurve3dFunctor (const NCollection_Vector<TopoDS_Edge>& theEdges,
+                                 NCollection_Array1<Standard_Boolean>& theStatuses,
+                                 const Standard_Real theTolerance,
+                                 const GeomAbs_Shape theContinuity,
+                                 const Standard_Integer theMaxDegree,
+                                 const Standard_Integer theMaxSegment)
+    : myEdges (theEdges),
+      myStatuses (theStatuses),
+      myTolerance (theTolerance),
+      myContinuity (theContinuity),
+      myMaxDegree (theMaxDegree),
+      myMaxSegment (theMaxSegment)
+    {
+    }
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      myStatuses (theIndex) = BRepLib::BuildCurve3d (myEdges (theIndex), myTolerance,
+                                                     myContinuity, myMaxDegree, myMaxSegment);
+    }
+
+  private:
+
+    BRepLib_BuildCurve3dFunctor& operator= (const BRepLib_BuildCurve3dFunctor&);
+
+  private:
+
+    const NCollection_Vector<TopoDS_Edge>& myEdges;
+    NCollection_Array1<Standard_Boolean>& myStatuses;
+    Standard_Real myTolerance;
+    GeomAbs_Shape myContinuity;
+    Standard_Integer myMaxDegree;
+    Standard_Integer myMaxSegment;
+  };
+}
+
 Standard_Boolean  BRepLib::BuildCurves3d(const TopoDS_Shape& S,
   const Standard_Real Tolerance,
   const GeomAbs_Shape Continuity,
   const Standard_Integer MaxDegree,
-  const Standard_Integer MaxSegment)
+  const Standard_Integer MaxSegment,
+  const Standard_Boolean theIsParallel)
 {
   Standard_Boolean boolean_value,
     ok = Standard_True;
   TopTools_MapOfShape a_counter ;
   TopExp_Explorer ex(S,TopAbs_EDGE);
 
-  while (ex.More()) {
+  if (!theIsParallel) {
+    while (ex.More()) {
+      if (a_counter.Add(ex.Current())) {
+        boolean_value = 
+          BuildCurve3d(TopoDS::Edge(ex.Current()),
+          Tolerance, Continuity,
+          MaxDegree, MaxSegment);
+        ok = ok && boolean_value ;
+      }
+      ex.Next();
+    }
+    return ok;
+  }
+
+  // The edges sharing the TShape with the previous ones are
+  // processed after the others, as they modify the same data
+  TColStd_MapOfTransient aTShapes;
+  NCollection_Vector<TopoDS_Edge> anEdges, aSharedEdges;
+  for (; ex.More(); ex.Next()) {
     if (a_counter.Add(ex.Current())) {
-      boolean_value = 
-        BuildCurve3d(TopoDS::Edge(ex.Current()),
-        Tolerance, Continuity,
-        MaxDegree, MaxSegment);
-      ok = ok && boolean_value ;
+      if (aTShapes.Add(ex.Current().TShape()))
+        anEdges.Append(TopoDS::Edge(ex.Current()));
+      else
+        aSharedEdges.Append(TopoDS::Edge(ex.Current()));
     }
-    ex.Next();
+  }
+  if (anEdges.IsEmpty())
+    return ok;
+
+  NCollection_Array1<Standard_Boolean> aStatuses(0, anEdges.Length() - 1);
+  BRepLib_BuildCurve3dFunctor aFunctor(anEdges, aStatuses, Tolerance,
+                                       Continuity, MaxDegree, MaxSegment);
+  OSD_Parallel::For(0, anEdges.Length(), aFunctor);
+  for (Standard_Integer i = aStatuses.Lower(); i <= aStatuses.Upper(); i++)
+    ok = ok && aStatuses(i);
+
+  for (NCollection_Vector<TopoDS_Edge>::Iterator anIt(aSharedEdges); anIt.More(); anIt.Next()) {
+    boolean_value = 
+      BuildCurve3d(anIt.Value(),
+      Tolerance, Continuity,
+      MaxDegree, MaxSegment);
+    ok = ok && boolean_value ;
   }
   return ok;
 }
@@ -904,58 +983,186 @@ static void UpdShTol(const TopTools_DataMapOfShapeReal& theShToTol,
   }
 }
 
+namespace
+{
+  //! Edge to be made same parameter.
+  struct BRepLib_SameParameterEdge
+  {
+    TopoDS_Edge      Edge;       //!< Original edge
+    TopoDS_Edge      NewEdge;    //!< Edge to process (original or its substitution)
+    TopoDS_Edge      Result;     //!< Resulting edge
+    Standard_Real    NewTol;     //!< New tolerance of the vertices
+    Standard_Boolean UseOldEdge; //!< Flag of modification of the edge in place
+
+    BRepLib_SameParameterEdge() : NewTol (-1.), UseOldEdge (Standard_False) {}
+  };
+
+  //! Makes the edges same parameter.
+  class BRepLib_SameParameterFunctor
+  {
+  public:
+
+    BRepLib_SameParameterFunctor (NCollection_Vector<BRepLib_SameParameterEdge>& theEdges,
+                                  const Standard_Real theTolerance)
+    : myEdges (theEdges),
+      myTolerance (theTolerance)
+    {
+    }
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      BRepLib_SameParameterEdge& anEdge = myEdges.ChangeValue (theIndex);
+      anEdge.Result = BRepLib::SameParameter (anEdge.NewEdge, myTolerance,
+                                              anEdge.NewTol, anEdge.UseOldEdge);
+    }
+
+  private:
+
+    BRepLib_SameParameterFunctor& operator= (const BRepLib_SameParameterFunctor&);
+
+  private:
+
+    NCollection_Vector<BRepLib_SameParameterEdge>& myEdges;
+    Standard_Real myTolerance;
+  };
+
+  //! Edge on planar face to compute the tolerance.
+  struct BRepLib_EdgeOnPlane
+  {
+    TopoDS_Edge   Edge;    //!< Edge of the face
+    TopoDS_Edge   NewEdge; //!< Substitution of the edge
+    TopoDS_Face   Face;    //!< Planar face
+    Standard_Real NewTol;  //!< Computed tolerance of the edge
+
+    BRepLib_EdgeOnPlane() : NewTol (-1.) {}
+  };
+
+  //! Computes the tolerances of the edges on planar faces.
+  class BRepLib_EdgeTolFunctor
+  {
+  public:
+
+    BRepLib_EdgeTolFunctor (NCollection_Vector<BRepLib_EdgeOnPlane>& theEdges)
+    : myEdges (theEdges)
+    {
+    }
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      BRepLib_EdgeOnPlane& anEdge = myEdges.ChangeValue (theIndex);
+      GetEdgeTol (anEdge.NewEdge, anEdge.Face, anEdge.NewTol);
+    }
+
+  private:
+
+    BRepLib_EdgeTolFunctor& operator= (const BRepLib_EdgeTolFunctor&);
+
+  private:
+
+    NCollection_Vector<BRepLib_EdgeOnPlane>& myEdges;
+  };
+}
+
+//=======================================================================
+//function : prepareSameParameter
+//purpose  : Finds the edge to process and resets its flags if forced
+//=======================================================================
+static void prepareSameParameter(BRepLib_SameParameterEdge& theEdge, BRepTools_ReShape& theReshaper,
+  const Standard_Boolean IsForced, const Standard_Boolean IsMutableInput)
+{
+  BRep_Builder aB;
+  const TopoDS_Edge& aCE = theEdge.Edge;
+  TopoDS_Edge aNE = TopoDS::Edge(theReshaper.Value(aCE));
+  Standard_Boolean UseOldEdge = IsMutableInput || theReshaper.IsNewShape(aCE) || !aNE.IsSame(aCE);
+  if (IsForced && (BRep_Tool::SameRange(aCE) || BRep_Tool::SameParameter(aCE)))
+  {
+    if (!UseOldEdge)
+    {
+      aNE = TopoDS::Edge(aCE.EmptyCopied());
+      TopoDS_Iterator sit(aCE);
+      for (;sit.More();sit.Next())
+        aB.Add(aNE, sit.Value());
+      theReshaper.Replace(aCE, aNE);
+      UseOldEdge = Standard_True;
+    }
+    aB.SameRange(aNE, Standard_False);
+    aB.SameParameter(aNE, Standard_False);
+  }
+  theEdge.NewEdge = aNE;
+  theEdge.UseOldEdge = UseOldEdge;
+}
+
+//=======================================================================
+//function : applySameParameter
+//purpose  : Records the result of the edge and the tolerances of its vertices
+//=======================================================================
+static void applySameParameter(const BRepLib_SameParameterEdge& theEdge, BRepTools_ReShape& theReshaper,
+  TopTools_DataMapOfShapeReal& theShToTol)
+{
+  if (!theEdge.UseOldEdge && !theEdge.Result.IsNull())
+    //NE have been empty-copied
+    theReshaper.Replace(theEdge.NewEdge, theEdge.Result);
+  if (theEdge.NewTol > 0)
+  {
+    TopoDS_Vertex aV1, aV2;
+    TopExp::Vertices(theEdge.Edge,aV1,aV2);
+    if (!aV1.IsNull())
+      UpdTolMap(aV1, theEdge.NewTol, theShToTol);
+    if (!aV2.IsNull()) 
+      UpdTolMap(aV2, theEdge.NewTol, theShToTol);
+  }
+}
+
 //=======================================================================
 //function : InternalSameParameter
 //purpose  : 
 //=======================================================================
 static void InternalSameParameter(const TopoDS_Shape& theSh, BRepTools_ReShape& theReshaper,
-  const Standard_Real theTol, const Standard_Boolean IsForced, const Standard_Boolean IsMutableInput ) 
+  const Standard_Real theTol, const Standard_Boolean IsForced, const Standard_Boolean IsMutableInput,
+  const Standard_Boolean theIsParallel)
 {
   TopExp_Explorer ex(theSh,TopAbs_EDGE);
   TopTools_MapOfShape  Done;
-  BRep_Builder aB;
   TopTools_DataMapOfShapeReal aShToTol;
- 
-  while (ex.More()) 
+
+  // The edges are made same parameter in parallel, the tolerances of the
+  // vertices are accumulated in the map and applied at the end.
+  // The edges sharing the TShape with the previous ones are processed
+  // after the others, as they modify the same data.
+  TColStd_MapOfTransient aTShapes;
+  NCollection_Vector<BRepLib_SameParameterEdge> anEdges;
+  NCollection_Vector<TopoDS_Edge> aSharedEdges;
+  for (; ex.More(); ex.Next())
   {
     const TopoDS_Edge& aCE = TopoDS::Edge(ex.Current());
-    if (Done.Add(aCE))
+    if (!Done.Add(aCE))
+      continue;
+    if (!aTShapes.Add(aCE.TShape()))
     {
-      TopoDS_Edge aNE = TopoDS::Edge(theReshaper.Value(aCE));
-      Standard_Boolean UseOldEdge = IsMutableInput || theReshaper.IsNewShape(aCE) || !aNE.IsSame(aCE);
-      if (IsForced && (BRep_Tool::SameRange(aCE) || BRep_Tool::SameParameter(aCE)))
-      {
-        if (!UseOldEdge)
-        {
-          aNE = TopoDS::Edge(aCE.EmptyCopied());
-          TopoDS_Iterator sit(aCE);
-          for (;sit.More();sit.Next())
-            aB.Add(aNE, sit.Value());
-          theReshaper.Replace(aCE, aNE);
-          UseOldEdge = Standard_True;
-        }
-        aB.SameRange(aNE, Standard_False);
-        aB.SameParameter(aNE, Standard_False);
-      }
-      Standard_Real aNewTol = -1;
-      TopoDS_Edge aResEdge = BRepLib::SameParameter(aNE, theTol, aNewTol, UseOldEdge);
-      if (!UseOldEdge && !aResEdge.IsNull())
-        //NE have been empty-copied
-        theReshaper.Replace(aNE, aResEdge);
-      if (aNewTol > 0)
-      {
-        TopoDS_Vertex aV1, aV2;
-        TopExp::Vertices(aCE,aV1,aV2);
-        if (!aV1.IsNull())
-          UpdTolMap(aV1, aNewTol, aShToTol);
-        if (!aV2.IsNull()) 
-          UpdTolMap(aV2, aNewTol, aShToTol);
-      }
+      aSharedEdges.Append(aCE);
+      continue;
     }
-    ex.Next();
+    BRepLib_SameParameterEdge& anEdge = anEdges.Appended();
+    anEdge.Edge = aCE;
+    prepareSameParameter(anEdge, theReshaper, IsForced, IsMutableInput);
+  }
+
+  BRepLib_SameParameterFunctor aSPFunctor(anEdges, theTol);
+  OSD_Parallel::For(0, anEdges.Length(), aSPFunctor, !theIsParallel);
+  for (NCollection_Vector<BRepLib_SameParameterEdge>::Iterator anIt(anEdges); anIt.More(); anIt.Next())
+    applySameParameter(anIt.Value(), theReshaper, aShToTol);
+
+  for (NCollection_Vector<TopoDS_Edge>::Iterator anIt(aSharedEdges); anIt.More(); anIt.Next())
+  {
+    BRepLib_SameParameterEdge anEdge;
+    anEdge.Edge = anIt.Value();
+    prepareSameParameter(anEdge, theReshaper, IsForced, IsMutableInput);
+    anEdge.Result = BRepLib::SameParameter(anEdge.NewEdge, theTol, anEdge.NewTol, anEdge.UseOldEdge);
+    applySameParameter(anEdge, theReshaper, aShToTol);
   }
  
   Done.Clear();
+  NCollection_Vector<BRepLib_EdgeOnPlane> anEdgesOnPlane;
   BRepAdaptor_Surface BS;
   for(ex.Init(theSh,TopAbs_FACE); ex.More(); ex.Next()){
     const TopoDS_Face& curface = TopoDS::Face(ex.Current());
@@ -964,14 +1171,21 @@ static void InternalSameParameter(const TopoDS_Shape& theSh, BRepTools_ReShape&
     if(BS.GetType() != GeomAbs_Plane) continue;
     TopExp_Explorer ex2;
     for(ex2.Init(curface,TopAbs_EDGE); ex2.More(); ex2.Next()){
-      const TopoDS_Edge& E = TopoDS::Edge(ex2.Current());
-      TopoDS_Shape aNe = theReshaper.Value(E);
-      Standard_Real aNewEtol = -1;
-      GetEdgeTol(TopoDS::Edge(aNe), curface, aNewEtol);
-      if (aNewEtol >= 0) //not equal to -1
-        UpdTolMap(E, aNewEtol, aShToTol);
+      BRepLib_EdgeOnPlane& anEdge = anEdgesOnPlane.Appended();
+      anEdge.Edge = TopoDS::Edge(ex2.Current());
+      anEdge.NewEdge = TopoDS::Edge(theReshaper.Value(anEdge.Edge));
+      anEdge.Face = curface;
     }
   }
+
+  BRepLib_EdgeTolFunctor anETFunctor(anEdgesOnPlane);
+  OSD_Parallel::For(0, anEdgesOnPlane.Length(), anETFunctor, !theIsParallel);
+  for (NCollection_Vector<BRepLib_EdgeOnPlane>::Iterator anIt(anEdgesOnPlane); anIt.More(); anIt.Next())
+  {
+    const BRepLib_EdgeOnPlane& anEdge = anIt.Value();
+    if (anEdge.NewTol >= 0) //not equal to -1
+      UpdTolMap(anEdge.Edge, anEdge.NewTol, aShToTol);
+  }
  
   //
   UpdShTol(aShToTol, IsMutableInput, theReshaper, Standard_False );
@@ -987,10 +1201,11 @@ static void InternalSameParameter(const TopoDS_Shape& theSh, BRepTools_ReShape&
 //================================================================
 void  BRepLib::SameParameter(const TopoDS_Shape& S,
   const Standard_Real Tolerance,
-  const Standard_Boolean forced)
+  const Standard_Boolean forced,
+  const Standard_Boolean theIsParallel)
 {
   BRepTools_ReShape reshaper;
-  InternalSameParameter( S, reshaper, Tolerance, forced, Standard_True);
+  InternalSameParameter( S, reshaper, Tolerance, forced, Standard_True, theIsParallel);
 }
 
 //=======================================================================
@@ -998,9 +1213,10 @@ void  BRepLib::SameParameter(const TopoDS_Shape& S,
 //purpose  : 
 //=======================================================================
 void BRepLib::SameParameter(const TopoDS_Shape& S, BRepTools_ReShape& theReshaper,
-  const Standard_Real Tolerance, const Standard_Boolean forced ) 
+  const Standard_Real Tolerance, const Standard_Boolean forced,
+  const Standard_Boolean theIsParallel)
 {
-  InternalSameParameter( S, theReshaper, Tolerance, forced, Standard_False);
+  InternalSameParameter( S, theReshaper, Tolerance, forced, Standard_False, theIsParallel);
 }
 
 //=======================================================================
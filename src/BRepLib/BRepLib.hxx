@@ -95,7 +95,8 @@ public:
   //! Computes  the 3d curves  for all the  edges of <S>
   //! return False if one of the computation failed.
   //! <MaxSegment> >= 30 in approximation
-  Standard_EXPORT static Standard_Boolean BuildCurves3d (const TopoDS_Shape& S, const Standard_Real Tolerance, const GeomAbs_Shape Continuity = GeomAbs_C1, const Standard_Integer MaxDegree = 14, const Standard_Integer MaxSegment = 0);
+  //! If <theIsParallel> is true the edges are processed in parallel.
+  Standard_EXPORT static Standard_Boolean BuildCurves3d (const TopoDS_Shape& S, const Standard_Real Tolerance, const GeomAbs_Shape Continuity = GeomAbs_C1, const Standard_Integer MaxDegree = 14, const Standard_Integer MaxSegment = 0, const Standard_Boolean theIsParallel = Standard_False);
   
   //! Computes  the 3d curves  for all the  edges of <S>
   //! return False if one of the computation failed.
@@ -162,9 +163,12 @@ public:
   //! Computes new 2d curve(s) for all the edges of  <S>
   //! to have the same parameter  as  the  3d curve.
   //! The algorithm is not done if the flag SameParameter
-  //! was True  on an  Edge.
+  //! was True  on an  Edge.<br>
+  //! If <theIsParallel> is true the edges are processed in parallel,
+  //! the tolerances of the vertices are updated at the end.
   Standard_EXPORT static void SameParameter(const TopoDS_Shape& S,
-    const Standard_Real Tolerance = 1.0e-5, const Standard_Boolean forced = Standard_False);
+    const Standard_Real Tolerance = 1.0e-5, const Standard_Boolean forced = Standard_False,
+    const Standard_Boolean theIsParallel = Standard_False);
 
   //! Computes new 2d curve(s) for all the edges of  <S>
   //! to have the same parameter  as  the  3d curve.
@@ -173,9 +177,11 @@ public:
   //! theReshaper is used to record the modifications of input shape <S> to prevent any 
   //! modifications on the shape itself.
   //! Thus the input shape (and its subshapes) will not be modified, instead the reshaper will 
-  //! contain a modified empty-copies of original subshapes as substitutions.
+  //! contain a modified empty-copies of original subshapes as substitutions.<br>
+  //! If <theIsParallel> is true the edges are processed in parallel.
   Standard_EXPORT static void SameParameter(const TopoDS_Shape& S, BRepTools_ReShape& theReshaper,
-    const Standard_Real Tolerance = 1.0e-5, const Standard_Boolean forced = Standard_False );
+    const Standard_Real Tolerance = 1.0e-5, const Standard_Boolean forced = Standard_False,
+    const Standard_Boolean theIsParallel = Standard_False);
  
   //! Replaces tolerance   of  FACE EDGE VERTEX  by  the
   //! tolerance Max of their connected handling shapes.
@@ -15,11 +15,39 @@
 // commercial license or contractual agreement.
 
 #include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepBndLib.hxx>
 #include <BRepMesh_Context.hxx>
+#include <BRepMesh_Deflection.hxx>
+#include <BRepMesh_ModelBuilder.hxx>
 #include <BRepMesh_PluginMacro.hxx>
+#include <BRepMesh_ShapeTool.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_TFace.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepTools_History.hxx>
+#include <BRepMeshData_Model.hxx>
+#include <IMeshData_Edge.hxx>
 #include <IMeshData_Face.hxx>
 #include <IMeshData_Wire.hxx>
 #include <IMeshTools_MeshBuilder.hxx>
+#include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Poly_ListOfTriangulation.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_IncrementalMesh, BRepMesh_DiscretRoot)
 
@@ -28,6 +56,345 @@ namespace
   //! Default flag to control parallelization for BRepMesh_IncrementalMesh
   //! tool returned for Mesh Factory
   static Standard_Boolean IS_IN_PARALLEL = Standard_False;
+
+  //! Builds discrete model of a part of the shape keeping the size of the whole
+  //! shape used to compute relative deflection of edges.
+  class BRepMesh_PartModelBuilder : public BRepMesh_ModelBuilder
+  {
+  public:
+
+    //! Constructor.
+    BRepMesh_PartModelBuilder (const Standard_Real theMaxSize)
+    : myMaxSize (theMaxSize)
+    {
+    }
+
+  protected:
+
+    //! Builds the model and overrides its size.
+    virtual Handle(IMeshData_Model) performInternal (const TopoDS_Shape&          theShape,
+                                                     const IMeshTools_Parameters& theParameters) Standard_OVERRIDE
+    {
+      Handle(IMeshData_Model) aModel = BRepMesh_ModelBuilder::performInternal (theShape, theParameters);
+      Handle(BRepMeshData_Model) aDataModel = Handle(BRepMeshData_Model)::DownCast (aModel);
+      if (!aDataModel.IsNull() && theParameters.Relative)
+      {
+        aDataModel->SetMaxSize (myMaxSize);
+      }
+      return aModel;
+    }
+
+  private:
+
+    Standard_Real myMaxSize;
+  };
+
+  //! Collects parts of the shape, i.e. its sub-shapes other than compounds,
+  //! without locations ignoring repeated occurrences.
+  static void collectParts (const TopoDS_Shape&         theShape,
+                            TopTools_MapOfShape&        theVisited,
+                            TopTools_IndexedMapOfShape& theParts)
+  {
+    const TopoDS_Shape aShape = theShape.Located (TopLoc_Location()).Oriented (TopAbs_FORWARD);
+    if (aShape.ShapeType() == TopAbs_COMPOUND)
+    {
+      if (theVisited.Add (aShape))
+      {
+        for (TopoDS_Iterator aSubIt (aShape); aSubIt.More(); aSubIt.Next())
+        {
+          collectParts (aSubIt.Value(), theVisited, theParts);
+        }
+      }
+    }
+    else if (aShape.ShapeType() != TopAbs_VERTEX)
+    {
+      theParts.Add (aShape);
+    }
+  }
+
+  //! Returns the root of the group in disjoint set.
+  static Standard_Integer findGroup (NCollection_Array1<Standard_Integer>& theGroups,
+                                     Standard_Integer                      theIndex)
+  {
+    while (theGroups (theIndex) != theIndex)
+    {
+      theGroups (theIndex) = theGroups (theGroups (theIndex));
+      theIndex = theGroups (theIndex);
+    }
+    return theIndex;
+  }
+
+  //! Splits the shape into unique parts to be meshed independently.
+  //! Parts sharing edges or vertices are combined into one compound.
+  static void splitIntoParts (const TopoDS_Shape&               theShape,
+                              NCollection_Vector<TopoDS_Shape>& theParts)
+  {
+    TopTools_MapOfShape aVisited;
+    TopTools_IndexedMapOfShape aParts;
+    collectParts (theShape, aVisited, aParts);
+    if (aParts.IsEmpty())
+    {
+      return;
+    }
+
+    NCollection_Array1<Standard_Integer> aGroups (1, aParts.Extent());
+    TopTools_DataMapOfShapeInteger aSubShapeParts;
+    for (Standard_Integer aPartIt = 1; aPartIt <= aParts.Extent(); ++aPartIt)
+    {
+      aGroups (aPartIt) = aPartIt;
+      for (Standard_Integer aTypeIt = 0; aTypeIt < 2; ++aTypeIt)
+      {
+        const TopAbs_ShapeEnum aType = aTypeIt == 0 ? TopAbs_EDGE : TopAbs_VERTEX;
+        for (TopExp_Explorer aSubExp (aParts (aPartIt), aType); aSubExp.More(); aSubExp.Next())
+        {
+          const TopoDS_Shape aSubShape = aSubExp.Current().Located (TopLoc_Location());
+          if (const Standard_Integer* anOwner = aSubShapeParts.Seek (aSubShape))
+          {
+            const Standard_Integer aGroup1 = findGroup (aGroups, *anOwner);
+            const Standard_Integer aGroup2 = findGroup (aGroups, aPartIt);
+            aGroups (Max (aGroup1, aGroup2)) = Min (aGroup1, aGroup2);
+          }
+          else
+          {
+            aSubShapeParts.Bind (aSubShape, aPartIt);
+          }
+        }
+      }
+    }
+
+    BRep_Builder aBuilder;
+    NCollection_Array1<Standard_Integer> aGroupParts (1, aParts.Extent());
+    for (Standard_Integer aPartIt = 1; aPartIt <= aParts.Extent(); ++aPartIt)
+    {
+      const Standard_Integer aGroup = findGroup (aGroups, aPartIt);
+      if (aGroup == aPartIt)
+      {
+        aGroupParts (aPartIt) = theParts.Length();
+        theParts.Append (aParts (aPartIt));
+        continue;
+      }
+
+      TopoDS_Shape& aGroupShape = theParts.ChangeValue (aGroupParts (aGroup));
+      if (aGroupShape.ShapeType() != TopAbs_COMPOUND)
+      {
+        TopoDS_Compound aCompound;
+        aBuilder.MakeCompound (aCompound);
+        aBuilder.Add (aCompound, aGroupShape);
+        aGroupShape = aCompound;
+      }
+      aBuilder.Add (aGroupShape, aParts (aPartIt));
+    }
+  }
+
+  //! Meshes parts of the shape in parallel threads.
+  class BRepMesh_PartsMesher
+  {
+  public:
+
+    //! Constructor.
+    BRepMesh_PartsMesher (const NCollection_Vector<TopoDS_Shape>&   theParts,
+                          const IMeshTools_Parameters&              theParameters,
+                          const std::vector<Message_ProgressRange>& theRanges,
+                          NCollection_Array1<Standard_Integer>&     theStatuses)
+    : myParts      (theParts),
+      myParameters (theParameters),
+      myRanges     (theRanges),
+      myStatuses   (theStatuses)
+    {
+    }
+
+    //! Meshes the part with the given index.
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const Message_ProgressRange& aRange = myRanges[theIndex];
+      if (!aRange.More())
+      {
+        myStatuses (theIndex) = IMeshData_UserBreak;
+        return;
+      }
+
+      BRepMesh_IncrementalMesh aMesher;
+      aMesher.SetShape (myParts (theIndex));
+      aMesher.ChangeParameters() = myParameters;
+      aMesher.Perform (aRange);
+      myStatuses (theIndex) = aMesher.GetStatusFlags();
+    }
+
+  private:
+
+    BRepMesh_PartsMesher& operator= (const BRepMesh_PartsMesher& );
+
+  private:
+
+    const NCollection_Vector<TopoDS_Shape>&   myParts;
+    const IMeshTools_Parameters&              myParameters;
+    const std::vector<Message_ProgressRange>& myRanges;
+    NCollection_Array1<Standard_Integer>&     myStatuses;
+  };
+
+  //! Discretization of the edge on the finest level of detail
+  //! used to derive discretization of the edge on the coarser levels.
+  struct BRepMesh_EdgeLodNodes
+  {
+    std::vector<gp_Pnt>                      Points;
+    std::vector<Standard_Real>               Parameters;
+    std::vector< std::vector<gp_Pnt2d> >      PCurvePoints;
+    std::vector< std::vector<Standard_Real> > PCurveParameters;
+  };
+
+  //! Saves the current discretization of the edge.
+  static void saveEdgeNodes (const IMeshData::IEdgeHandle& theDEdge,
+                             BRepMesh_EdgeLodNodes&        theNodes)
+  {
+    const IMeshData::ICurveHandle& aCurve = theDEdge->GetCurve();
+    for (Standard_Integer aNodeIt = 0; aNodeIt < aCurve->ParametersNb(); ++aNodeIt)
+    {
+      theNodes.Points    .push_back (aCurve->GetPoint     (aNodeIt));
+      theNodes.Parameters.push_back (aCurve->GetParameter (aNodeIt));
+    }
+
+    theNodes.PCurvePoints    .resize (theDEdge->PCurvesNb());
+    theNodes.PCurveParameters.resize (theDEdge->PCurvesNb());
+    for (Standard_Integer aPCurveIt = 0; aPCurveIt < theDEdge->PCurvesNb(); ++aPCurveIt)
+    {
+      const IMeshData::IPCurveHandle& aPCurve = theDEdge->GetPCurve (aPCurveIt);
+      for (Standard_Integer aNodeIt = 0; aNodeIt < aPCurve->ParametersNb(); ++aNodeIt)
+      {
+        theNodes.PCurvePoints    [aPCurveIt].push_back (aPCurve->GetPoint     (aNodeIt));
+        theNodes.PCurveParameters[aPCurveIt].push_back (aPCurve->GetParameter (aNodeIt));
+      }
+    }
+  }
+
+  //! Checks that the chord between two nodes approximates the polyline of the nodes
+  //! between them within the given linear and angular deflections.
+  static Standard_Boolean isChordFitting (const std::vector<gp_Pnt>& thePoints,
+                                          const size_t               theFirst,
+                                          const size_t               theLast,
+                                          const Standard_Real        theDeflection,
+                                          const Standard_Real        theAngle)
+  {
+    const gp_Vec aChord (thePoints[theFirst], thePoints[theLast]);
+    const Standard_Real aSqLength = aChord.SquareMagnitude();
+    if (aSqLength < gp::Resolution())
+    {
+      return Standard_False;
+    }
+
+    const Standard_Real aSqDeflection = theDeflection * theDeflection;
+    for (size_t aNodeIt = theFirst; aNodeIt < theLast; ++aNodeIt)
+    {
+      const gp_Vec aSegment (thePoints[aNodeIt], thePoints[aNodeIt + 1]);
+      if (aSegment.SquareMagnitude() > gp::Resolution()
+       && aSegment.Angle (aChord) > theAngle)
+      {
+        return Standard_False;
+      }
+      if (aNodeIt == theFirst)
+      {
+        continue;
+      }
+
+      // distance from the node to the chord
+      const gp_Vec aVec (thePoints[theFirst], thePoints[aNodeIt]);
+      const Standard_Real aParam = Max (0.0, Min (1.0, aVec.Dot (aChord) / aSqLength));
+      if ((aVec - aChord * aParam).SquareMagnitude() > aSqDeflection)
+      {
+        return Standard_False;
+      }
+    }
+    return Standard_True;
+  }
+
+  //! Sets discretization of the edge to the nodes of the finest level of detail
+  //! necessary to fit the current deflection of the edge and the given angular deflection.
+  //! The nodes of free edges and edges whose pcurves do not follow the nodes of the 3d curve
+  //! are all kept.
+  static void decimateEdgeNodes (const IMeshData::IEdgeHandle& theDEdge,
+                                 const BRepMesh_EdgeLodNodes&  theNodes,
+                                 const Standard_Real           theAngle)
+  {
+    const size_t aNbNodes = theNodes.Points.size();
+    Standard_Boolean toDecimate = !theDEdge->IsFree() && !theDEdge->GetDegenerated() && aNbNodes > 2;
+    for (size_t aPCurveIt = 0; aPCurveIt < theNodes.PCurvePoints.size() && toDecimate; ++aPCurveIt)
+    {
+      toDecimate = theNodes.PCurvePoints[aPCurveIt].size() == aNbNodes;
+    }
+
+    std::vector<size_t> aKept;
+    aKept.reserve (aNbNodes);
+    if (aNbNodes != 0)
+    {
+      aKept.push_back (0);
+    }
+    for (size_t aFirst = 0; aFirst + 1 < aNbNodes; )
+    {
+      size_t aLast = aFirst + 1;
+      while (toDecimate
+          && aLast + 1 < aNbNodes
+          && isChordFitting (theNodes.Points, aFirst, aLast + 1, theDEdge->GetDeflection(), theAngle))
+      {
+        ++aLast;
+      }
+      aKept.push_back (aLast);
+      aFirst = aLast;
+    }
+
+    const IMeshData::ICurveHandle& aCurve = theDEdge->GetCurve();
+    aCurve->Clear (Standard_False);
+    for (std::vector<size_t>::const_iterator aNodeIt = aKept.begin(); aNodeIt != aKept.end(); ++aNodeIt)
+    {
+      aCurve->AddPoint (theNodes.Points[*aNodeIt], theNodes.Parameters[*aNodeIt]);
+    }
+
+    for (Standard_Integer aPCurveIt = 0; aPCurveIt < theDEdge->PCurvesNb(); ++aPCurveIt)
+    {
+      const IMeshData::IPCurveHandle& aPCurve = theDEdge->GetPCurve (aPCurveIt);
+      const std::vector<gp_Pnt2d>&      aPoints = theNodes.PCurvePoints    [aPCurveIt];
+      const std::vector<Standard_Real>& aParams = theNodes.PCurveParameters[aPCurveIt];
+      aPCurve->Clear (Standard_False);
+      if (!toDecimate)
+      {
+        for (size_t aNodeIt = 0; aNodeIt < aPoints.size(); ++aNodeIt)
+        {
+          aPCurve->AddPoint (aPoints[aNodeIt], aParams[aNodeIt]);
+        }
+        continue;
+      }
+
+      for (std::vector<size_t>::const_iterator aNodeIt = aKept.begin(); aNodeIt != aKept.end(); ++aNodeIt)
+      {
+        aPCurve->AddPoint (aPoints[*aNodeIt], aParams[*aNodeIt]);
+      }
+    }
+  }
+
+  //! Adds the faces sharing edges with the given face and not contained
+  //! in any of the given maps to the resulting map.
+  static void addNeighbours (const TopoDS_Shape&                              theFace,
+                             const TopTools_IndexedDataMapOfShapeListOfShape& theEdgeFaces,
+                             const TopTools_IndexedMapOfShape&                theExcluded1,
+                             const TopTools_IndexedMapOfShape&                theExcluded2,
+                             TopTools_IndexedMapOfShape&                      theNeighbours)
+  {
+    for (TopExp_Explorer anEdgeExp (theFace, TopAbs_EDGE); anEdgeExp.More(); anEdgeExp.Next())
+    {
+      const TopTools_ListOfShape* aFaces = theEdgeFaces.Seek (anEdgeExp.Current());
+      if (aFaces == NULL)
+      {
+        continue;
+      }
+
+      for (TopTools_ListOfShape::Iterator aFaceIt (*aFaces); aFaceIt.More(); aFaceIt.Next())
+      {
+        if (!theExcluded1.Contains (aFaceIt.Value())
+         && !theExcluded2.Contains (aFaceIt.Value()))
+        {
+          theNeighbours.Add (aFaceIt.Value());
+        }
+      }
+    }
+  }
 }
 
 //=======================================================================
@@ -36,7 +403,8 @@ namespace
 //=======================================================================
 BRepMesh_IncrementalMesh::BRepMesh_IncrementalMesh()
 : myModified(Standard_False),
-  myStatus(IMeshData_NoError)
+  myStatus(IMeshData_NoError),
+  myUpdateMaxSize(-1.0)
 {
 }
 
@@ -50,7 +418,8 @@ BRepMesh_IncrementalMesh::BRepMesh_IncrementalMesh( const TopoDS_Shape&    theSh
                                                     const Standard_Real    theAngDeflection,
                                                     const Standard_Boolean isInParallel)
 : myModified(Standard_False),
-  myStatus(IMeshData_NoError)
+  myStatus(IMeshData_NoError),
+  myUpdateMaxSize(-1.0)
 {
   myParameters.Deflection = theLinDeflection;
   myParameters.Angle      = theAngDeflection;
@@ -69,7 +438,8 @@ BRepMesh_IncrementalMesh::BRepMesh_IncrementalMesh(
   const TopoDS_Shape&          theShape,
   const IMeshTools_Parameters& theParameters,
   const Message_ProgressRange& theRange)
-  : myParameters(theParameters)
+  : myParameters(theParameters),
+    myUpdateMaxSize(-1.0)
 {
   myShape = theShape;
   Perform(theRange);
@@ -89,6 +459,12 @@ BRepMesh_IncrementalMesh::~BRepMesh_IncrementalMesh()
 //=======================================================================
 void BRepMesh_IncrementalMesh::Perform(const Message_ProgressRange& theRange)
 {
+  if (myParameters.ShareInstances)
+  {
+    performInstances (Handle(IMeshTools_Context)(), theRange);
+    return;
+  }
+
   Handle(BRepMesh_Context) aContext = new BRepMesh_Context (myParameters.MeshAlgo);
   Perform (aContext, theRange);
 }
@@ -98,10 +474,491 @@ void BRepMesh_IncrementalMesh::Perform(const Message_ProgressRange& theRange)
 //purpose  : 
 //=======================================================================
 void BRepMesh_IncrementalMesh::Perform(const Handle(IMeshTools_Context)& theContext, const Message_ProgressRange& theRange)
+{
+  if (myParameters.ShareInstances)
+  {
+    performInstances (theContext, theRange);
+    return;
+  }
+
+  perform (theContext, Shape(), theRange);
+}
+
+//=======================================================================
+//function : performInstances
+//purpose  : 
+//=======================================================================
+void BRepMesh_IncrementalMesh::performInstances (const Handle(IMeshTools_Context)& theContext,
+                                                 const Message_ProgressRange&      theRange)
+{
+  initParameters();
+
+  NCollection_Vector<TopoDS_Shape> aParts;
+  if (!Shape().IsNull())
+  {
+    splitIntoParts (Shape(), aParts);
+  }
+
+  myStatus = IMeshData_NoError;
+  if (myParameters.InParallel
+   && theContext.IsNull()
+   && aParts.Length() > 1)
+  {
+    // Parallelize over parts, each part is meshed with its own context. While the parts
+    // do not occupy all threads of the pool, each part is meshed in parallel mode as well
+    // taking the threads left free, otherwise in a single thread.
+    IMeshTools_Parameters aParameters = myParameters;
+    aParameters.InParallel     = aParts.Length() < OSD_ThreadPool::DefaultPool()->NbDefaultThreadsToLaunch();
+    aParameters.ShareInstances = Standard_False;
+
+    Message_ProgressScope aPS (theRange, "Perform incmesh", aParts.Length());
+    std::vector<Message_ProgressRange> aRanges;
+    aRanges.reserve (aParts.Length());
+    for (Standard_Integer aPartIt = 0; aPartIt < aParts.Length(); ++aPartIt)
+    {
+      aRanges.push_back (aPS.Next());
+    }
+
+    NCollection_Array1<Standard_Integer> aStatuses (0, aParts.Length() - 1);
+    aStatuses.Init (IMeshData_NoError);
+    OSD_Parallel::For (0, aParts.Length(), BRepMesh_PartsMesher (aParts, aParameters, aRanges, aStatuses));
+    for (Standard_Integer aPartIt = aStatuses.Lower(); aPartIt <= aStatuses.Upper(); ++aPartIt)
+    {
+      myStatus |= aStatuses (aPartIt);
+    }
+    if (!aPS.More())
+    {
+      myStatus |= IMeshData_UserBreak;
+      return;
+    }
+    setDone();
+    return;
+  }
+
+  Message_ProgressScope aPS (theRange, "Perform incmesh", Max (aParts.Length(), 1));
+  Standard_Integer aStatus = IMeshData_NoError;
+  for (NCollection_Vector<TopoDS_Shape>::Iterator aPartIt (aParts); aPartIt.More(); aPartIt.Next())
+  {
+    Handle(IMeshTools_Context) aContext = theContext;
+    if (aContext.IsNull())
+    {
+      aContext = new BRepMesh_Context (myParameters.MeshAlgo);
+    }
+    if (!perform (aContext, aPartIt.Value(), aPS.Next()))
+    {
+      return;
+    }
+    aStatus |= myStatus;
+  }
+  myStatus = aStatus;
+  setDone();
+}
+
+//=======================================================================
+//function : PerformLods
+//purpose  : 
+//=======================================================================
+void BRepMesh_IncrementalMesh::PerformLods (const TColStd_SequenceOfReal& theDeflections,
+                                            const Message_ProgressRange&  theRange)
 {
   initParameters();
 
-  theContext->SetShape(Shape());
+  // Levels are ordered from the coarsest one, but meshed from the finest one:
+  // edges are discretized once on the finest level and the coarser levels take a part of its nodes.
+  std::vector<Standard_Real> aDeflections;
+  for (TColStd_SequenceOfReal::Iterator aDeflIt (theDeflections); aDeflIt.More(); aDeflIt.Next())
+  {
+    if (aDeflIt.Value() < Precision::Confusion())
+    {
+      throw Standard_NumericError ("BRepMesh_IncrementalMesh::PerformLods : invalid parameter value");
+    }
+    aDeflections.push_back (aDeflIt.Value());
+  }
+  std::sort (aDeflections.begin(), aDeflections.end(), std::greater<Standard_Real>());
+  aDeflections.erase (std::unique (aDeflections.begin(), aDeflections.end()), aDeflections.end());
+  const Standard_Integer aNbLevels = static_cast<Standard_Integer> (aDeflections.size());
+
+  Handle(BRepMesh_Context) aContext = new BRepMesh_Context (myParameters.MeshAlgo);
+  aContext->SetShape (Shape());
+  aContext->ChangeParameters()            = myParameters;
+  aContext->ChangeParameters().CleanModel = Standard_False;
+
+  myStatus = IMeshData_NoError;
+  Message_ProgressScope aPS (theRange, "Perform incmesh LODs", Standard_Real (aNbLevels + 1));
+  if (!aContext->BuildModel())
+  {
+    setDone();
+    return;
+  }
+  aPS.Next();
+
+  const Handle(IMeshData_Model)& aModel = aContext->GetModel();
+  BRep_Builder aBuilder;
+
+  // Remove existing triangulations together with polygons of edges to mesh all levels from scratch.
+  for (Standard_Integer aFaceIt = 0; aFaceIt < aModel->FacesNb(); ++aFaceIt)
+  {
+    const TopoDS_Face& aFace = aModel->GetFace (aFaceIt)->GetFace();
+    const Handle(BRep_TFace)& aTFace = Handle(BRep_TFace)::DownCast (aFace.TShape());
+    for (Poly_ListOfTriangulation::Iterator aTriIt (aTFace->Triangulations()); aTriIt.More(); aTriIt.Next())
+    {
+      for (TopExp_Explorer anEdgeExp (aFace, TopAbs_EDGE); anEdgeExp.More(); anEdgeExp.Next())
+      {
+        BRepMesh_ShapeTool::NullifyEdge (TopoDS::Edge (anEdgeExp.Current()), aTriIt.Value(), aFace.Location());
+      }
+    }
+    BRepMesh_ShapeTool::NullifyFace (aFace);
+  }
+
+  // Triangulations of each face per level, null for the levels where the face has not been meshed.
+  NCollection_IndexedDataMap<TopoDS_Shape, std::vector<Handle(Poly_Triangulation)>, TopTools_ShapeMapHasher> aFaceLods;
+  std::vector<BRepMesh_EdgeLodNodes> anEdgeNodes;
+  Standard_Integer aCoarsestLevel = aNbLevels;
+  for (Standard_Integer aLevel = aNbLevels - 1; aLevel >= 0; --aLevel)
+  {
+    const Standard_Boolean isFinest = aLevel == aNbLevels - 1;
+    const Standard_Real aRatio = aDeflections[aLevel] / myParameters.Deflection;
+    IMeshTools_Parameters& aParameters = aContext->ChangeParameters();
+    aParameters.Deflection         = aDeflections[aLevel];
+    aParameters.DeflectionInterior = myParameters.DeflectionInterior * aRatio;
+    aParameters.MinSize            = myParameters.MinSize * aRatio;
+    if (!isFinest)
+    {
+      // Reset statuses left by the previous level and take the nodes of the finest level
+      // fitting the deflection of this level as discretization of edges.
+      for (Standard_Integer aEdgeIt = 0; aEdgeIt < aModel->EdgesNb(); ++aEdgeIt)
+      {
+        const IMeshData::IEdgeHandle& aDEdge = aModel->GetEdge (aEdgeIt);
+        aDEdge->UnsetStatus (IMeshData_Status (aDEdge->GetStatusMask()));
+        BRepMesh_Deflection::ComputeDeflection (aDEdge, aModel->GetMaxSize(), aParameters);
+        decimateEdgeNodes (aDEdge, anEdgeNodes[aEdgeIt], aParameters.Angle);
+      }
+      for (Standard_Integer aFaceIt = 0; aFaceIt < aModel->FacesNb(); ++aFaceIt)
+      {
+        const IMeshData::IFaceHandle& aDFace = aModel->GetFace (aFaceIt);
+        aDFace->UnsetStatus (IMeshData_Status (aDFace->GetStatusMask()));
+        for (Standard_Integer aWireIt = 0; aWireIt < aDFace->WiresNb(); ++aWireIt)
+        {
+          const IMeshData::IWireHandle& aDWire = aDFace->GetWire (aWireIt);
+          aDWire->UnsetStatus (IMeshData_Status (aDWire->GetStatusMask()));
+        }
+      }
+    }
+
+    if ((isFinest && !aContext->DiscretizeEdges())
+     || !aContext->HealModel()
+     || !aContext->PreProcessModel()
+     || !aContext->DiscretizeFaces (aPS.Next())
+     || !aContext->PostProcessModel())
+    {
+      // Drop the incomplete level together with polygons of edges on it,
+      // the faces receive the levels finished before.
+      for (Standard_Integer aFaceIt = 0; aFaceIt < aModel->FacesNb(); ++aFaceIt)
+      {
+        TopLoc_Location aLoc;
+        const TopoDS_Face& aFace = aModel->GetFace (aFaceIt)->GetFace();
+        const Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+        if (aTriangulation.IsNull())
+        {
+          continue;
+        }
+
+        for (TopExp_Explorer anEdgeExp (aFace, TopAbs_EDGE); anEdgeExp.More(); anEdgeExp.Next())
+        {
+          BRepMesh_ShapeTool::NullifyEdge (TopoDS::Edge (anEdgeExp.Current()), aTriangulation, aLoc);
+        }
+        aBuilder.UpdateFace (aFace, Handle(Poly_Triangulation)());
+      }
+
+      if (!aPS.More())
+      {
+        myStatus |= IMeshData_UserBreak;
+      }
+      break;
+    }
+
+    if (isFinest)
+    {
+      anEdgeNodes.resize (aModel->EdgesNb());
+      for (Standard_Integer aEdgeIt = 0; aEdgeIt < aModel->EdgesNb(); ++aEdgeIt)
+      {
+        saveEdgeNodes (aModel->GetEdge (aEdgeIt), anEdgeNodes[aEdgeIt]);
+      }
+    }
+
+    // Detach triangulations of the level from the faces keeping polygons of edges on them,
+    // so that the next level is not affected by the existing mesh.
+    for (Standard_Integer aFaceIt = 0; aFaceIt < aModel->FacesNb(); ++aFaceIt)
+    {
+      const IMeshData::IFaceHandle& aDFace = aModel->GetFace (aFaceIt);
+      myStatus |= aDFace->GetStatusMask();
+      for (Standard_Integer aWireIt = 0; aWireIt < aDFace->WiresNb(); ++aWireIt)
+      {
+        myStatus |= aDFace->GetWire (aWireIt)->GetStatusMask();
+      }
+
+      const TopoDS_Face& aFace = aDFace->GetFace();
+      const TopoDS_Shape aKey = aFace.Located (TopLoc_Location());
+      std::vector<Handle(Poly_Triangulation)>* aLods = aFaceLods.ChangeSeek (aKey);
+      if (aLods == NULL)
+      {
+        aLods = &aFaceLods.ChangeFromIndex (aFaceLods.Add (aKey, std::vector<Handle(Poly_Triangulation)> (aNbLevels)));
+      }
+
+      // the face sharing the TFace with another one has been processed with it
+      TopLoc_Location aLoc;
+      const Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+      if (!aTriangulation.IsNull())
+      {
+        aTriangulation->SetMeshPurpose (Poly_MeshPurpose_Presentation);
+        (*aLods)[aLevel] = aTriangulation;
+        aBuilder.UpdateFace (aFace, Handle(Poly_Triangulation)());
+      }
+    }
+    aCoarsestLevel = aLevel;
+  }
+
+  // The face which has not been meshed on some of the completed levels receives
+  // the triangulation of the nearest finer (or coarser, if none) level instead,
+  // so that all faces have the same number of levels.
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aFaceLods.Extent(); ++aFaceIt)
+  {
+    std::vector<Handle(Poly_Triangulation)>& aLevels = aFaceLods.ChangeFromIndex (aFaceIt);
+    Handle(Poly_Triangulation) aNearest;
+    for (Standard_Integer aLevel = aNbLevels - 1; aLevel >= aCoarsestLevel; --aLevel)
+    {
+      if (!aLevels[aLevel].IsNull())
+      {
+        aNearest = aLevels[aLevel];
+      }
+      else if (!aNearest.IsNull())
+      {
+        aLevels[aLevel] = aNearest;
+        myStatus |= IMeshData_Failure;
+      }
+    }
+    if (aNearest.IsNull())
+    {
+      // the face has not been meshed at all
+      continue;
+    }
+
+    Poly_ListOfTriangulation aLods;
+    for (Standard_Integer aLevel = aCoarsestLevel; aLevel < aNbLevels; ++aLevel)
+    {
+      if (!aLevels[aLevel].IsNull())
+      {
+        aNearest = aLevels[aLevel];
+      }
+      else
+      {
+        aLevels[aLevel] = aNearest;
+        myStatus |= IMeshData_Failure;
+      }
+      aLods.Append (aLevels[aLevel]);
+    }
+
+    const Handle(Poly_Triangulation)& aFinest = aLods.Last();
+    aFinest->SetMeshPurpose (Poly_MeshPurpose_Calculation | Poly_MeshPurpose_Presentation);
+
+    const TopoDS_Shape& aFace = aFaceLods.FindKey (aFaceIt);
+    Handle(BRep_TFace)::DownCast (aFace.TShape())->Triangulations (aLods, aFinest);
+    aFace.TShape()->Modified (Standard_True);
+  }
+
+  if ((myStatus & IMeshData_UserBreak) != 0)
+  {
+    return;
+  }
+  setDone();
+}
+
+//=======================================================================
+//function : Update
+//purpose  : 
+//=======================================================================
+void BRepMesh_IncrementalMesh::Update (const TopTools_IndexedMapOfShape& theModifiedShapes,
+                                       const Standard_Boolean            theToMeshUntriangulated,
+                                       const Message_ProgressRange&      theRange)
+{
+  initUpdateMaps();
+  const TopTools_IndexedDataMapOfShapeListOfShape& anEdgeFaces = myUpdateEdgeFaces;
+
+  // Collect faces to be remeshed.
+  TopTools_IndexedMapOfShape aModifiedFaces;
+  for (Standard_Integer aShapeIt = 1; aShapeIt <= theModifiedShapes.Extent(); ++aShapeIt)
+  {
+    const TopoDS_Shape& aShape = theModifiedShapes (aShapeIt);
+    if (aShape.ShapeType() == TopAbs_EDGE)
+    {
+      const TopTools_ListOfShape* anEdgeFacesList = anEdgeFaces.Seek (aShape);
+      if (anEdgeFacesList != NULL)
+      {
+        for (TopTools_ListOfShape::Iterator aFaceIt (*anEdgeFacesList); aFaceIt.More(); aFaceIt.Next())
+        {
+          aModifiedFaces.Add (aFaceIt.Value());
+        }
+      }
+      continue;
+    }
+
+    for (TopExp_Explorer aFaceExp (aShape, TopAbs_FACE); aFaceExp.More(); aFaceExp.Next())
+    {
+      if (myUpdateFaces.Contains (aFaceExp.Current()))
+      {
+        aModifiedFaces.Add (aFaceExp.Current());
+      }
+    }
+  }
+
+  if (theToMeshUntriangulated)
+  {
+    for (Standard_Integer aFaceIt = 1; aFaceIt <= myUpdateFaces.Extent(); ++aFaceIt)
+    {
+      TopLoc_Location aLoc;
+      if (BRep_Tool::Triangulation (TopoDS::Face (myUpdateFaces (aFaceIt)), aLoc).IsNull())
+      {
+        aModifiedFaces.Add (myUpdateFaces (aFaceIt));
+      }
+    }
+  }
+
+  Message_ProgressScope aPS (theRange, "Update incmesh", 1, Standard_True);
+  Standard_Integer aStatus = IMeshData_NoError;
+  while (!aModifiedFaces.IsEmpty())
+  {
+    // Remove triangulations of modified faces together with polygons of their edges
+    // and collect neighbouring faces to take discretization of shared edges from them.
+    BRep_Builder aBuilder;
+    TopoDS_Compound aCompound;
+    aBuilder.MakeCompound (aCompound);
+
+    TopTools_IndexedMapOfShape aNeighbours;
+    for (Standard_Integer aFaceIt = 1; aFaceIt <= aModifiedFaces.Extent(); ++aFaceIt)
+    {
+      const TopoDS_Face& aFace = TopoDS::Face (aModifiedFaces (aFaceIt));
+      TopLoc_Location aLoc;
+      const Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+      if (!aTriangulation.IsNull())
+      {
+        for (TopExp_Explorer anEdgeExp (aFace, TopAbs_EDGE); anEdgeExp.More(); anEdgeExp.Next())
+        {
+          BRepMesh_ShapeTool::NullifyEdge (TopoDS::Edge (anEdgeExp.Current()), aTriangulation, aLoc);
+        }
+        BRepMesh_ShapeTool::NullifyFace (aFace);
+      }
+
+      addNeighbours (aFace, anEdgeFaces, aModifiedFaces, aModifiedFaces, aNeighbours);
+      aBuilder.Add (aCompound, aFace);
+    }
+
+    for (Standard_Integer aFaceIt = 1; aFaceIt <= aNeighbours.Extent(); ++aFaceIt)
+    {
+      aBuilder.Add (aCompound, aNeighbours (aFaceIt));
+    }
+
+    Handle(BRepMesh_Context) aContext = new BRepMesh_Context (myParameters.MeshAlgo);
+    aContext->SetModelBuilder (new BRepMesh_PartModelBuilder (myUpdateMaxSize));
+    if (!perform (aContext, aCompound, aPS.Next()))
+    {
+      return;
+    }
+    aStatus |= myStatus;
+
+    // Neighbours whose triangulations do not fit the parameters have been remeshed,
+    // thus the faces sharing edges with them should follow.
+    TopTools_IndexedMapOfShape aNextFaces;
+    const Handle(IMeshData_Model)& aModel = aContext->GetModel();
+    for (Standard_Integer aFaceIt = 0; !aModel.IsNull() && aFaceIt < aModel->FacesNb(); ++aFaceIt)
+    {
+      const IMeshData::IFaceHandle& aDFace = aModel->GetFace (aFaceIt);
+      if (!aDFace->IsSet (IMeshData_Reused)
+        && aNeighbours.Contains (aDFace->GetFace()))
+      {
+        addNeighbours (aDFace->GetFace(), anEdgeFaces, aModifiedFaces, aNeighbours, aNextFaces);
+      }
+    }
+    aModifiedFaces.Exchange (aNextFaces);
+  }
+
+  myStatus = aStatus;
+  setDone();
+}
+
+//=======================================================================
+//function : Update
+//purpose  : 
+//=======================================================================
+void BRepMesh_IncrementalMesh::Update (const Handle(BRepTools_History)& theHistory,
+                                       const TopoDS_Shape&              theInitialShape,
+                                       const Message_ProgressRange&     theRange)
+{
+  TopTools_IndexedMapOfShape aModifiedShapes;
+  if (!theHistory.IsNull())
+  {
+    TopTools_IndexedMapOfShape anInitialShapes;
+    TopExp::MapShapes (theInitialShape, TopAbs_FACE, anInitialShapes);
+    TopExp::MapShapes (theInitialShape, TopAbs_EDGE, anInitialShapes);
+    for (Standard_Integer aShapeIt = 1; aShapeIt <= anInitialShapes.Extent(); ++aShapeIt)
+    {
+      const TopoDS_Shape& anInitialShape = anInitialShapes (aShapeIt);
+      for (TopTools_ListOfShape::Iterator anImageIt (theHistory->Modified (anInitialShape));
+           anImageIt.More(); anImageIt.Next())
+      {
+        aModifiedShapes.Add (anImageIt.Value());
+      }
+      for (TopTools_ListOfShape::Iterator anImageIt (theHistory->Generated (anInitialShape));
+           anImageIt.More(); anImageIt.Next())
+      {
+        aModifiedShapes.Add (anImageIt.Value());
+      }
+    }
+  }
+
+  Update (aModifiedShapes, Standard_False, theRange);
+}
+
+//=======================================================================
+//function : initUpdateMaps
+//purpose  : 
+//=======================================================================
+void BRepMesh_IncrementalMesh::initUpdateMaps()
+{
+  if (!myUpdateShape.IsEqual (Shape()))
+  {
+    myUpdateShape = Shape();
+    myUpdateFaces.Clear();
+    myUpdateEdgeFaces.Clear();
+    myUpdateMaxSize = -1.0;
+    TopExp::MapShapes (Shape(), TopAbs_FACE, myUpdateFaces);
+    TopExp::MapShapesAndAncestors (Shape(), TopAbs_EDGE, TopAbs_FACE, myUpdateEdgeFaces);
+  }
+
+  // Relative deflection of edges depends on the size of the whole shape.
+  if (myParameters.Relative
+   && myUpdateMaxSize < 0.0)
+  {
+    Bnd_Box aBox;
+    BRepBndLib::Add (Shape(), aBox, Standard_False);
+    myUpdateMaxSize = 0.0;
+    if (!aBox.IsVoid())
+    {
+      BRepMesh_ShapeTool::BoxMaxDimension (aBox, myUpdateMaxSize);
+    }
+  }
+}
+
+//=======================================================================
+//function : perform
+//purpose  : 
+//=======================================================================
+Standard_Boolean BRepMesh_IncrementalMesh::perform (const Handle(IMeshTools_Context)& theContext,
+                                                    const TopoDS_Shape&               theShape,
+                                                    const Message_ProgressRange&      theRange)
+{
+  initParameters();
+
+  theContext->SetShape(theShape);
   theContext->ChangeParameters()            = myParameters;
   theContext->ChangeParameters().CleanModel = Standard_False;
 
@@ -111,7 +968,7 @@ void BRepMesh_IncrementalMesh::Perform(const Handle(IMeshTools_Context)& theCont
   if (!aPS.More())
   {
     myStatus = IMeshData_UserBreak;
-    return;
+    return Standard_False;
   }
   myStatus = IMeshData_NoError;
   const Handle(IMeshData_Model)& aModel = theContext->GetModel();
@@ -131,6 +988,7 @@ void BRepMesh_IncrementalMesh::Perform(const Handle(IMeshTools_Context)& theCont
   }
   aPS.Next(1);
   setDone();
+  return Standard_True;
 }
 
 //=======================================================================
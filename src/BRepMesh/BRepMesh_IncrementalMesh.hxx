@@ -17,6 +17,11 @@
 #include <BRepMesh_DiscretRoot.hxx>
 #include <IMeshTools_Context.hxx>
 #include <Standard_NumericError.hxx>
+#include <TColStd_SequenceOfReal.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+class BRepTools_History;
 
 //! Builds the mesh of a shape with respect of their 
 //! correctly triangulated parts 
@@ -59,6 +64,60 @@ public: //! @name mesher API
   //! Performs meshing using custom context;
   Standard_EXPORT void Perform(const Handle(IMeshTools_Context)& theContext,
                                const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Performs meshing of the shape generating several levels of detail.
+  //! Each face receives the list of triangulations, one per linear deflection from the
+  //! given list, ordered from the coarsest to the finest one; the finest triangulation
+  //! becomes active and is marked for calculation, all levels are marked for presentation.
+  //! Other parameters are taken from Parameters(), interior deflection and minimum size
+  //! are scaled proportionally to the deflection of the level.
+  //! The discrete model of the shape (topology, pcurves and surface adaptors) is built once
+  //! and shared by all levels. Edges are discretized once on the finest level, which is the same
+  //! as the result of meshing with its deflection alone; on each coarser level the edges keep
+  //! only the nodes of the finest level needed to fit the deflections of the level,
+  //! and the faces are meshed anew.
+  //! Edges keep polygons on triangulations of each level, so every level is watertight.
+  //! Existing triangulations of the faces are replaced by the generated ones.
+  //! The levels are meshed from the finest one, in case of user break the faces
+  //! receive the levels completed before it.
+  //! If meshing of a face fails on some level, IMeshData_Failure is reported and the face
+  //! receives the triangulation of the nearest finer (or coarser) level for it,
+  //! so that all faces have the same number of levels.
+  //! @param theDeflections linear deflections of the levels.
+  //! @param theRange progress indicator.
+  Standard_EXPORT void PerformLods (const TColStd_SequenceOfReal& theDeflections,
+                                    const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Updates the mesh of already meshed shape after modification of some of its faces.
+  //! Only the modified faces (and, on request, faces having no triangulation) are meshed anew;
+  //! the faces sharing edges with them are included into the meshing model in order to
+  //! reuse discretization of the shared edges, their triangulations are kept as is.
+  //! Triangulations of all other faces and polygons of their edges are not touched.
+  //! In case if triangulation of a neighbouring face does not fit the parameters
+  //! (e.g. the shape has been meshed with a different deflection) the face is
+  //! remeshed as well and the update is propagated further to its neighbours.
+  //! Free edges and vertices of the shape are not processed.
+  //! The map of edges to faces of the shape and, for relative deflection, the size of the shape
+  //! are computed by the first call and reused by the next calls while the shape is the same.
+  //! @param theModifiedShapes modified sub-shapes of the shape; edges designate
+  //!        all faces containing them, shapes of other types - all their faces.
+  //! @param theToMeshUntriangulated if TRUE, the shape is searched for the faces having
+  //!        no triangulation to mesh them as well; otherwise such faces should be given
+  //!        in theModifiedShapes.
+  //! @param theRange progress indicator.
+  Standard_EXPORT void Update (const TopTools_IndexedMapOfShape& theModifiedShapes,
+                               const Standard_Boolean theToMeshUntriangulated = Standard_False,
+                               const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Updates the mesh of already meshed shape obtained by modification of the initial shape.
+  //! The faces of the shape modified or generated from the sub-shapes of the initial shape
+  //! according to the history are remeshed, see Update() above for details.
+  //! @param theHistory history of modification of the initial shape into the meshed one.
+  //! @param theInitialShape the shape before modification.
+  //! @param theRange progress indicator.
+  Standard_EXPORT void Update (const Handle(BRepTools_History)& theHistory,
+                               const TopoDS_Shape& theInitialShape,
+                               const Message_ProgressRange& theRange = Message_ProgressRange());
   
 public: //! @name accessing to parameters.
 
@@ -88,6 +147,22 @@ public: //! @name accessing to parameters.
   
 private:
 
+  //! Performs meshing of each part of the shape once (see IMeshTools_Parameters::ShareInstances).
+  //! Parts are meshed in parallel if the context is not specified; each part is meshed
+  //! in parallel mode as well while the number of parts is less than the number of threads.
+  void performInstances (const Handle(IMeshTools_Context)& theContext,
+                         const Message_ProgressRange& theRange);
+
+  //! Computes the maps of faces and edges to faces of the shape and its size
+  //! used by Update(), if they have not been computed for the current shape yet.
+  void initUpdateMaps();
+
+  //! Performs meshing of the given shape using custom context.
+  //! @return FALSE if the meshing has been interrupted by the user.
+  Standard_Boolean perform (const Handle(IMeshTools_Context)& theContext,
+                            const TopoDS_Shape& theShape,
+                            const Message_ProgressRange& theRange);
+
   //! Initializes specific parameters
   void initParameters()
   {
@@ -146,6 +221,13 @@ protected:
   IMeshTools_Parameters myParameters;
   Standard_Boolean      myModified;
   Standard_Integer      myStatus;
+
+private:
+
+  TopoDS_Shape                              myUpdateShape;     //!< shape the maps below are computed for
+  TopTools_IndexedMapOfShape                myUpdateFaces;     //!< faces of the shape
+  TopTools_IndexedDataMapOfShapeListOfShape myUpdateEdgeFaces; //!< edges of the shape with their faces
+  Standard_Real                             myUpdateMaxSize;   //!< size of the shape, negative if not computed
 };
 
 #endif
@@ -30,6 +30,11 @@
 #include <BRepOffset_Offset.hxx>
 #include <BRepOffset_Tool.hxx>
 #include <GeomAPI_ProjectPointOnCurve.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <TColStd_ListOfInteger.hxx>
+#include <TColStd_MapOfInteger.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -55,7 +60,8 @@ BRepOffset_Inter3d::BRepOffset_Inter3d(const Handle(BRepAlgo_AsDes)& AsDes,
                                        const Standard_Real           Tol)
 :myAsDes(AsDes),
 mySide(Side),
-myTol(Tol)
+myTol(Tol),
+myIsParallel(Standard_False)
 {
 }
 
@@ -95,6 +101,363 @@ static void ExtentEdge(const TopoDS_Face& /*F*/,
 
 }
 
+namespace
+{
+  //! Ways of intersection of the pair of offset faces
+  enum BRepOffset_FacesInterType
+  {
+    BRepOffset_FacesInterType_Skip,  //!< the pair is not to be treated at all
+    BRepOffset_FacesInterType_None,  //!< the pair is treated, but not intersected
+    BRepOffset_FacesInterType_Faces, //!< the faces are intersected
+    BRepOffset_FacesInterType_Pipes  //!< the pipes are intersected
+  };
+
+  //! Pair of faces to be intersected and the results of their intersection.
+  struct BRepOffset_FacesInter
+  {
+    TopoDS_Face F1;
+    TopoDS_Face F2;
+    BRepOffset_FacesInterType Type;
+    TopAbs_State Side;
+    TopoDS_Edge RefEdge;
+    TopoDS_Face RefFace1;
+    TopoDS_Face RefFace2;
+    TopTools_ListOfShape LInt1;
+    TopTools_ListOfShape LInt2;
+
+    BRepOffset_FacesInter()
+    : Type (BRepOffset_FacesInterType_Faces),
+      Side (TopAbs_UNKNOWN)
+    {}
+
+    //! Intersects the faces
+    void Perform()
+    {
+      if (Type == BRepOffset_FacesInterType_Faces)
+      {
+        BRepOffset_Tool::Inter3D (F1, F2, LInt1, LInt2, Side, RefEdge, RefFace1, RefFace2);
+      }
+      else if (Type == BRepOffset_FacesInterType_Pipes)
+      {
+        BRepOffset_Tool::PipeInter (F1, F2, LInt1, LInt2, Side);
+      }
+    }
+  };
+
+  typedef NCollection_Vector<BRepOffset_FacesInter> BRepOffset_VectorOfFacesInter;
+
+  //! Functor for parallel intersection of the pairs of faces of the same round
+  class BRepOffset_FacesInterFunctor
+  {
+  public:
+    BRepOffset_FacesInterFunctor (BRepOffset_VectorOfFacesInter& thePairs,
+                                  const NCollection_Vector<Standard_Integer>& theRound)
+    : myPairs (thePairs),
+      myRound (theRound)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      myPairs.ChangeValue (myRound.Value (theIndex)).Perform();
+    }
+
+  private:
+    BRepOffset_FacesInterFunctor& operator= (const BRepOffset_FacesInterFunctor&);
+
+  private:
+    BRepOffset_VectorOfFacesInter& myPairs;
+    const NCollection_Vector<Standard_Integer>& myRound;
+  };
+
+  //=======================================================================
+  //function : addSubShapes
+  //purpose  : Adds the face and its sub-shapes into the map and returns
+  //           the list of their indices
+  //=======================================================================
+  const TColStd_ListOfInteger& addSubShapes
+    (const TopoDS_Face& theF,
+     TopTools_IndexedMapOfShape& theMS,
+     NCollection_DataMap<TopoDS_Shape, TColStd_ListOfInteger, TopTools_ShapeMapHasher>& theMFS)
+  {
+    TColStd_ListOfInteger* pLIds = theMFS.ChangeSeek (theF);
+    if (pLIds)
+    {
+      return *pLIds;
+    }
+    pLIds = theMFS.Bound (theF, TColStd_ListOfInteger());
+    pLIds->Append (theMS.Add (theF));
+    for (TopExp_Explorer anExpE (theF, TopAbs_EDGE); anExpE.More(); anExpE.Next())
+    {
+      pLIds->Append (theMS.Add (anExpE.Current()));
+    }
+    for (TopExp_Explorer anExpV (theF, TopAbs_VERTEX); anExpV.More(); anExpV.Next())
+    {
+      pLIds->Append (theMS.Add (anExpV.Current()));
+    }
+    return *pLIds;
+  }
+
+  //=======================================================================
+  //function : performIntersections
+  //purpose  : Intersects the pairs of faces in parallel.
+  //           The intersection updates the faces (3D curves of the edges,
+  //           tolerances of the sub-shapes), thus the pairs sharing any
+  //           sub-shape are intersected in different rounds. Each pair is
+  //           intersected after all preceding pairs sharing sub-shapes with it,
+  //           so the updates of the shared sub-shapes are made in the same
+  //           order as in sequential mode.
+  //=======================================================================
+  Standard_Boolean performIntersections (BRepOffset_VectorOfFacesInter& thePairs,
+                                                const Message_ProgressRange& theRange)
+  {
+    const Standard_Integer aNbPairs = thePairs.Length();
+    Message_ProgressScope aPS (theRange, NULL, Max (aNbPairs, 1));
+
+    TopTools_IndexedMapOfShape aMS;
+    NCollection_DataMap<TopoDS_Shape, TColStd_ListOfInteger, TopTools_ShapeMapHasher> aMFS;
+
+    NCollection_Vector<Standard_Integer> aPending;
+    for (Standard_Integer i = 0; i < aNbPairs; ++i)
+    {
+      aPending.Append (i);
+    }
+
+    while (!aPending.IsEmpty())
+    {
+      if (!aPS.More())
+      {
+        return Standard_False;
+      }
+      // Select the pairs having no common sub-shapes with the preceding pending ones,
+      // selected or postponed
+      NCollection_Vector<Standard_Integer> aRound, aNext;
+      TColStd_MapOfInteger aMLocked;
+      for (NCollection_Vector<Standard_Integer>::Iterator aItP (aPending); aItP.More(); aItP.Next())
+      {
+        const Standard_Integer iPair = aItP.Value();
+        const BRepOffset_FacesInter& aPair = thePairs.Value (iPair);
+        const TColStd_ListOfInteger& aLIds1 = addSubShapes (aPair.F1, aMS, aMFS);
+        const TColStd_ListOfInteger& aLIds2 = addSubShapes (aPair.F2, aMS, aMFS);
+
+        Standard_Boolean isFree = Standard_True;
+        for (Standard_Integer j = 0; j < 2 && isFree; ++j)
+        {
+          TColStd_ListOfInteger::Iterator aItId (!j ? aLIds1 : aLIds2);
+          for (; aItId.More(); aItId.Next())
+          {
+            if (aMLocked.Contains (aItId.Value()))
+            {
+              isFree = Standard_False;
+              break;
+            }
+          }
+        }
+
+        for (Standard_Integer j = 0; j < 2; ++j)
+        {
+          TColStd_ListOfInteger::Iterator aItId (!j ? aLIds1 : aLIds2);
+          for (; aItId.More(); aItId.Next())
+          {
+            aMLocked.Add (aItId.Value());
+          }
+        }
+
+        if (isFree)
+        {
+          aRound.Append (iPair);
+        }
+        else
+        {
+          aNext.Append (iPair);
+        }
+      }
+
+      BRepOffset_FacesInterFunctor aFunctor (thePairs, aRound);
+      OSD_Parallel::For (0, aRound.Length(), aFunctor, aRound.Length() < 2);
+      aPS.Next (aRound.Length());
+
+      aPending = aNext;
+    }
+    return Standard_True;
+  }
+
+  //=======================================================================
+  //function : faceInterType
+  //purpose  : Defines the way of intersection of the offset faces
+  //=======================================================================
+  BRepOffset_FacesInterType faceInterType (const TopoDS_Face& F1,
+                                                  const TopoDS_Face& F2,
+                                                  const BRepAlgo_Image& InitOffsetFace,
+                                                  const Handle(BRepAlgo_AsDes)& theAsDes)
+  {
+    const TopoDS_Shape& InitF1 = InitOffsetFace.ImageFrom(F1);
+    const TopoDS_Shape& InitF2 = InitOffsetFace.ImageFrom(F2);
+    if (InitF1.IsSame(InitF2)) return BRepOffset_FacesInterType_Skip;
+
+    Standard_Boolean InterPipes = (InitF2.ShapeType() == TopAbs_EDGE &&
+                                   InitF1.ShapeType() == TopAbs_EDGE );
+    Standard_Boolean InterFaces = (InitF1.ShapeType() == TopAbs_FACE && 
+                                   InitF2.ShapeType() == TopAbs_FACE);
+    TopTools_ListOfShape LE,LV;
+    if (BRepOffset_Tool::FindCommonShapes(F1,F2,LE,LV) ||
+        theAsDes->HasCommonDescendant(F1,F2,LE)) {
+      //-------------------------------------------------
+      // F1 and F2 share shapes.
+      //-------------------------------------------------
+      if ( LE.IsEmpty() && !LV.IsEmpty()) {
+        if (InterPipes) {
+          //----------------------
+          // tubes share a vertex.
+          //----------------------
+          const TopoDS_Edge& EE1 = TopoDS::Edge(InitF1);
+          const TopoDS_Edge& EE2 = TopoDS::Edge(InitF2);
+          TopoDS_Vertex VE1[2],VE2[2];
+          TopExp::Vertices(EE1,VE1[0],VE1[1]);
+          TopExp::Vertices(EE2,VE2[0],VE2[1]);
+          TopoDS_Vertex V;
+          for (Standard_Integer i = 0 ; i < 2; i++) {
+            for (Standard_Integer j = 0 ; j < 2; j++) {
+              if (VE1[i].IsSame(VE2[j])) {
+                V = VE1[i];
+              }
+            }
+          }
+          if (!InitOffsetFace.HasImage(V)) { //no sphere
+            return BRepOffset_FacesInterType_Pipes;
+          }                
+        }
+        else {
+          //--------------------------------------------------------
+          // Intersection having only common vertices
+          // and supports having common edges.
+          // UNSUFFICIENT, but a larger criterion shakes too
+          // many sections.
+          //--------------------------------------------------------
+          if (InterFaces) {
+            if (BRepOffset_Tool::FindCommonShapes(TopoDS::Face(InitF1),
+                                                  TopoDS::Face(InitF2),LE,LV)) {
+              if (!LE.IsEmpty()) {
+                return BRepOffset_FacesInterType_Faces;
+              }
+            }
+            else {
+              return BRepOffset_FacesInterType_Faces;
+            }
+          }
+        }
+      }
+      return BRepOffset_FacesInterType_None;
+    }
+    return InterPipes ? BRepOffset_FacesInterType_Pipes : BRepOffset_FacesInterType_Faces;
+  }
+
+  //=======================================================================
+  //function : connexFaces
+  //purpose  : Returns the pairs of faces to be intersected through the
+  //           given edge or vertex and the side of intersection
+  //=======================================================================
+  Standard_Boolean connexFaces (const TopoDS_Shape& theS,
+                                const BRepOffset_Analyse& theAnalyse,
+                                const TopTools_DataMapOfShapeListOfShape& theDMVLF1,
+                                const TopTools_DataMapOfShapeListOfShape& theDMVLF2,
+                                const TopAbs_State theDefSide,
+                                TopoDS_Edge& theE,
+                                TopAbs_State& theSide,
+                                TopTools_ListOfShape& theLF1,
+                                TopTools_ListOfShape& theLF2)
+  {
+    if (theS.ShapeType() == TopAbs_EDGE) {
+      // faces connected by the edge
+      theE = TopoDS::Edge (theS);
+      //
+      const BRepOffset_ListOfInterval& L = theAnalyse.Type(theE);
+      if (L.IsEmpty()) {
+        return Standard_False;
+      }
+      //
+      ChFiDS_TypeOfConcavity OT   = L.First().Type();
+      if (OT != ChFiDS_Convex && OT != ChFiDS_Concave) {
+        return Standard_False;
+      }
+      //
+      if (OT == ChFiDS_Concave) theSide = TopAbs_IN;
+      else                      theSide = TopAbs_OUT;
+      //-----------------------------------------------------------
+      // edge is of the proper type, return adjacent faces.
+      //-----------------------------------------------------------
+      const TopTools_ListOfShape& Anc = theAnalyse.Ancestors(theE);
+      if (Anc.Extent() != 2) {
+        return Standard_False;
+      }
+      //
+      theLF1.Append(Anc.First());
+      theLF2.Append(Anc.Last ());
+    }
+    else {
+      if (!theDMVLF1.IsBound(theS)) {
+        return Standard_False;
+      }
+      //
+      theLF1 = theDMVLF1.Find(theS);
+      theLF2 = theDMVLF2.Find(theS);
+      //
+      theSide = theDefSide;
+    }
+    return Standard_True;
+  }
+
+  //=======================================================================
+  //function : enlargedFace
+  //purpose  : Returns the extended offset face for the given initial face
+  //=======================================================================
+  TopoDS_Face enlargedFace (const TopoDS_Face& theF,
+                            const BRepOffset_DataMapOfShapeOffset& theMapSF,
+                            const BRepOffset_Analyse& theAnalyse,
+                            TopTools_DataMapOfShapeShape& theMES)
+  {
+    const TopoDS_Face& OF = TopoDS::Face(theMapSF(theF).Face());
+    if (const TopoDS_Shape* pNF = theMES.Seek(OF)) {
+      return TopoDS::Face(*pNF);
+    }
+    TopoDS_Face NF;
+    Standard_Boolean enlargeU = Standard_True;
+    Standard_Boolean enlargeVfirst = Standard_True, enlargeVlast = Standard_True;
+    BRepOffset_Tool::CheckBounds( theF, theAnalyse, enlargeU, enlargeVfirst, enlargeVlast );
+    BRepOffset_Tool::EnLargeFace(OF,NF,Standard_True,Standard_True,enlargeU,enlargeVfirst,enlargeVlast);
+    theMES.Bind(OF,NF);
+    return NF;
+  }
+
+  //=======================================================================
+  //function : addPair
+  //purpose  : Adds the pair of faces into the map of pairs;
+  //           returns false if the pair is already there
+  //=======================================================================
+  Standard_Boolean addPair (const TopoDS_Face& theF1,
+                            const TopoDS_Face& theF2,
+                            TopTools_DataMapOfShapeListOfShape& thePairs)
+  {
+    TopTools_ListOfShape* pLF1 = thePairs.ChangeSeek (theF1);
+    if (pLF1 && pLF1->Contains (theF2))
+    {
+      return Standard_False;
+    }
+    if (!pLF1)
+    {
+      pLF1 = thePairs.Bound (theF1, TopTools_ListOfShape());
+    }
+    pLF1->Append (theF2);
+    //
+    TopTools_ListOfShape* pLF2 = thePairs.ChangeSeek (theF2);
+    if (!pLF2)
+    {
+      pLF2 = thePairs.Bound (theF2, TopTools_ListOfShape());
+    }
+    pLF2->Append (theF1);
+    return Standard_True;
+  }
+}
+
 //=======================================================================
 //function : CompletInt
 //purpose  : 
@@ -142,6 +505,49 @@ void BRepOffset_Inter3d::CompletInt (const TopTools_ListOfShape& SetOfFaces,
   const std::vector<BOPTools_BoxPairSelector::PairIDs>& aPairs = aSelector.Pairs();
   const Standard_Integer aNbPairs = static_cast<Standard_Integer> (aPairs.size());
   Message_ProgressScope aPS(theRange, "Complete intersection", aNbPairs);
+  if (myIsParallel)
+  {
+    // The way of intersection of each pair depends only on the results of
+    // the previous steps, thus it may be defined before intersection.
+    // Intersect the pairs in parallel and store the results in the order of pairs.
+    BRepOffset_VectorOfFacesInter aVInter;
+    for (Standard_Integer iPair = 0; iPair < aNbPairs; ++iPair)
+    {
+      const BOPTools_BoxPairSelector::PairIDs& aPair = aPairs[iPair];
+
+      const TopoDS_Face& aF1 = TopoDS::Face (aMFaces.FindKey (Min (aPair.ID1, aPair.ID2)));
+      const TopoDS_Face& aF2 = TopoDS::Face (aMFaces.FindKey (Max (aPair.ID1, aPair.ID2)));
+      if (aF1.IsSame (aF2) || IsDone (aF1, aF2))
+      {
+        continue;
+      }
+
+      const BRepOffset_FacesInterType aType = faceInterType (aF1, aF2, InitOffsetFace, myAsDes);
+      if (aType == BRepOffset_FacesInterType_Skip)
+      {
+        continue;
+      }
+
+      BRepOffset_FacesInter& anInter = aVInter.Appended();
+      anInter.F1 = aF1;
+      anInter.F2 = aF2;
+      anInter.Type = aType;
+      anInter.Side = mySide;
+    }
+
+    if (!performIntersections (aVInter, aPS.Next (aNbPairs)))
+    {
+      return;
+    }
+
+    for (BRepOffset_VectorOfFacesInter::Iterator aItI (aVInter); aItI.More(); aItI.Next())
+    {
+      const BRepOffset_FacesInter& anInter = aItI.Value();
+      Store (anInter.F1, anInter.F2, anInter.LInt1, anInter.LInt2);
+    }
+    return;
+  }
+
   for (Standard_Integer iPair = 0; iPair < aNbPairs; ++iPair, aPS.Next())
   {
     if (!aPS.More())
@@ -167,80 +573,18 @@ void BRepOffset_Inter3d::FaceInter(const TopoDS_Face& F1,
                                    const TopoDS_Face& F2,
                                    const BRepAlgo_Image&     InitOffsetFace)
 {
-  TopTools_ListOfShape LInt1, LInt2;
-  TopoDS_Edge NullEdge;
-  TopoDS_Face NullFace;
-
   if (F1.IsSame(F2)) return;
   if (IsDone(F1,F2)) return;
 
-  const TopoDS_Shape& InitF1 = InitOffsetFace.ImageFrom(F1);
-  const TopoDS_Shape& InitF2 = InitOffsetFace.ImageFrom(F2);
-  if (InitF1.IsSame(InitF2)) return;
-
-  Standard_Boolean InterPipes = (InitF2.ShapeType() == TopAbs_EDGE &&
-                                 InitF1.ShapeType() == TopAbs_EDGE );
-  Standard_Boolean InterFaces = (InitF1.ShapeType() == TopAbs_FACE && 
-                                 InitF2.ShapeType() == TopAbs_FACE);
-  TopTools_ListOfShape LE,LV;
-  LInt1.Clear(); LInt2.Clear(); 
-  if (BRepOffset_Tool::FindCommonShapes(F1,F2,LE,LV) ||
-      myAsDes->HasCommonDescendant(F1,F2,LE)) {
-    //-------------------------------------------------
-    // F1 and F2 share shapes.
-    //-------------------------------------------------
-    if ( LE.IsEmpty() && !LV.IsEmpty()) {
-      if (InterPipes) {
-        //----------------------
-        // tubes share a vertex.
-        //----------------------
-        const TopoDS_Edge& EE1 = TopoDS::Edge(InitF1);
-        const TopoDS_Edge& EE2 = TopoDS::Edge(InitF2);
-        TopoDS_Vertex VE1[2],VE2[2];
-        TopExp::Vertices(EE1,VE1[0],VE1[1]);
-        TopExp::Vertices(EE2,VE2[0],VE2[1]);
-        TopoDS_Vertex V;
-        for (Standard_Integer i = 0 ; i < 2; i++) {
-          for (Standard_Integer j = 0 ; j < 2; j++) {
-            if (VE1[i].IsSame(VE2[j])) {
-              V = VE1[i];
-            }
-          }
-        }
-        if (!InitOffsetFace.HasImage(V)) { //no sphere
-          BRepOffset_Tool::PipeInter(F1,F2,LInt1,LInt2,mySide);
-        }                
-      }
-      else {
-        //--------------------------------------------------------
-        // Intersection having only common vertices
-        // and supports having common edges.
-        // UNSUFFICIENT, but a larger criterion shakes too
-        // many sections.
-        //--------------------------------------------------------
-        if (InterFaces) {
-          if (BRepOffset_Tool::FindCommonShapes(TopoDS::Face(InitF1),
-                                                TopoDS::Face(InitF2),LE,LV)) {
-            if (!LE.IsEmpty()) {
-              BRepOffset_Tool::Inter3D (F1,F2,LInt1,LInt2,mySide,NullEdge,NullFace,NullFace);
-            }
-          }
-          else {
-            BRepOffset_Tool::Inter3D(F1,F2,LInt1,LInt2,mySide,NullEdge,NullFace,NullFace);
-          }
-        }
-      }
-    }
-  }
-  else {
-    if (InterPipes) {
-      BRepOffset_Tool::PipeInter(F1,F2,LInt1,LInt2,mySide);
-    }
-    else {
-      BRepOffset_Tool::Inter3D (F1,F2,LInt1,LInt2,mySide,NullEdge,NullFace,NullFace);
-    }
-  }
-  Store (F1,F2,LInt1,LInt2);
+  BRepOffset_FacesInter aPair;
+  aPair.Type = faceInterType (F1, F2, InitOffsetFace, myAsDes);
+  if (aPair.Type == BRepOffset_FacesInterType_Skip) return;
+
+  aPair.F1 = F1;
+  aPair.F2 = F2;
+  aPair.Side = mySide;
+  aPair.Perform();
+  Store (F1,F2,aPair.LInt1,aPair.LInt2);
 }
 
 
@@ -416,10 +760,9 @@ void BRepOffset_Inter3d::ConnexIntByInt
  const Standard_Boolean                 bIsPlanar)
 {
   TopTools_IndexedMapOfShape VEmap;
-  TopoDS_Face     F1,F2,OF1,OF2,NF1,NF2;
+  TopoDS_Face     F1,F2,NF1,NF2;
   TopAbs_State    CurSide = mySide;
   BRep_Builder    B;
-  Standard_Boolean bEdge;
   Standard_Integer i, aNb = 0;
   TopTools_ListIteratorOfListOfShape it, it1, itF1, itF2;
   //
@@ -576,7 +919,49 @@ void BRepOffset_Inter3d::ConnexIntByInt
   }
   //
   aNb = VEmap.Extent();
-  Message_ProgressScope aPSInter(aPSOuter.Next(8), "Intersecting offset faces", aNb);
+  //
+  // In parallel mode, prepare the extended faces and intersect the pairs
+  // of faces in advance, in the same order as they are met below.
+  BRepOffset_VectorOfFacesInter aVInter;
+  Standard_Integer iInter = 0;
+  if (myIsParallel) {
+    TopTools_DataMapOfShapeListOfShape aMPairs;
+    for (i = 1; i <= aNb; ++i) {
+      const TopoDS_Shape& aS = VEmap(i);
+      //
+      TopoDS_Edge E;
+      TopTools_ListOfShape aLF1, aLF2;
+      if (!connexFaces (aS, Analyse, aDMVLF1, aDMVLF2, mySide, E, CurSide, aLF1, aLF2)) {
+        continue;
+      }
+      //
+      itF1.Initialize(aLF1);
+      itF2.Initialize(aLF2);
+      for (; itF1.More() && itF2.More(); itF1.Next(), itF2.Next()) {
+        F1 = TopoDS::Face(itF1.Value());
+        F2 = TopoDS::Face(itF2.Value());
+        //
+        NF1 = enlargedFace (F1, MapSF, Analyse, MES);
+        NF2 = enlargedFace (F2, MapSF, Analyse, MES);
+        //
+        if (!IsDone(NF1,NF2) && addPair (NF1, NF2, aMPairs)) {
+          BRepOffset_FacesInter& anInter = aVInter.Appended();
+          anInter.F1 = NF1;
+          anInter.F2 = NF2;
+          anInter.Side = CurSide;
+          anInter.RefEdge = E;
+          anInter.RefFace1 = F1;
+          anInter.RefFace2 = F2;
+        }
+      }
+    }
+    //
+    if (!performIntersections (aVInter, aPSOuter.Next(6))) {
+      return;
+    }
+  }
+  //
+  Message_ProgressScope aPSInter(aPSOuter.Next(myIsParallel ? 2 : 8), "Intersecting offset faces", aNb);
   for (i = 1; i <= aNb; ++i, aPSInter.Next()) {
     if (!aPSInter.More())
     {
@@ -586,47 +971,8 @@ void BRepOffset_Inter3d::ConnexIntByInt
     //
     TopoDS_Edge E;
     TopTools_ListOfShape aLF1, aLF2;
-    //
-    bEdge = (aS.ShapeType() == TopAbs_EDGE);
-    if (bEdge) {
-      // faces connected by the edge
-      E = *(TopoDS_Edge*)&aS;
-      //
-      const BRepOffset_ListOfInterval& L = Analyse.Type(E);
-      if (L.IsEmpty()) {
-        continue;
-      }
-      //
-      ChFiDS_TypeOfConcavity OT   = L.First().Type();
-      if (OT != ChFiDS_Convex && OT != ChFiDS_Concave) {
-        continue;
-      }
-      //
-      if (OT == ChFiDS_Concave) CurSide = TopAbs_IN;
-      else                      CurSide = TopAbs_OUT;
-      //-----------------------------------------------------------
-      // edge is of the proper type, return adjacent faces.
-      //-----------------------------------------------------------
-      const TopTools_ListOfShape& Anc = Analyse.Ancestors(E);
-      if (Anc.Extent() != 2) {
-        continue;
-      }
-      //
-      F1  = TopoDS::Face(Anc.First());
-      F2  = TopoDS::Face(Anc.Last ());
-      //
-      aLF1.Append(F1);
-      aLF2.Append(F2);
-    }
-    else {
-      if (!aDMVLF1.IsBound(aS)) {
-        continue;
-      }
-      //
-      aLF1 = aDMVLF1.Find(aS);
-      aLF2 = aDMVLF2.Find(aS);
-      //
-      CurSide = mySide;
+    if (!connexFaces (aS, Analyse, aDMVLF1, aDMVLF2, mySide, E, CurSide, aLF1, aLF2)) {
+      continue;
     }
     //
     itF1.Initialize(aLF1);
@@ -635,33 +981,19 @@ void BRepOffset_Inter3d::ConnexIntByInt
       F1 = TopoDS::Face(itF1.Value());
       F2 = TopoDS::Face(itF2.Value());
       //
-      OF1 = TopoDS::Face(MapSF(F1).Face());
-      OF2 = TopoDS::Face(MapSF(F2).Face());
-      if (!MES.IsBound(OF1)) {
-        Standard_Boolean enlargeU = Standard_True;
-        Standard_Boolean enlargeVfirst = Standard_True, enlargeVlast = Standard_True;
-        BRepOffset_Tool::CheckBounds( F1, Analyse, enlargeU, enlargeVfirst, enlargeVlast );
-        BRepOffset_Tool::EnLargeFace(OF1,NF1,Standard_True,Standard_True,enlargeU,enlargeVfirst,enlargeVlast);
-        MES.Bind(OF1,NF1);
-      }
-      else {
-        NF1 = TopoDS::Face(MES(OF1));
-      }
-      //
-      if (!MES.IsBound(OF2)) {
-        Standard_Boolean enlargeU = Standard_True;
-        Standard_Boolean enlargeVfirst = Standard_True, enlargeVlast = Standard_True;
-        BRepOffset_Tool::CheckBounds( F2, Analyse, enlargeU, enlargeVfirst, enlargeVlast );
-        BRepOffset_Tool::EnLargeFace(OF2,NF2,Standard_True,Standard_True,enlargeU,enlargeVfirst,enlargeVlast);
-        MES.Bind(OF2,NF2); 
-      }
-      else {
-        NF2 = TopoDS::Face(MES(OF2));
-      }
+      NF1 = enlargedFace (F1, MapSF, Analyse, MES);
+      NF2 = enlargedFace (F2, MapSF, Analyse, MES);
       //
       if (!IsDone(NF1,NF2)) {
         TopTools_ListOfShape LInt1,LInt2;
-        BRepOffset_Tool::Inter3D (NF1,NF2,LInt1,LInt2,CurSide,E,F1,F2);
+        if (myIsParallel) {
+          const BRepOffset_FacesInter& anInter = aVInter (iInter++);
+          LInt1 = anInter.LInt1;
+          LInt2 = anInter.LInt2;
+        }
+        else {
+          BRepOffset_Tool::Inter3D (NF1,NF2,LInt1,LInt2,CurSide,E,F1,F2);
+        }
         SetDone(NF1,NF2);
         if (!LInt1.IsEmpty()) {
           Store (NF1,NF2,LInt1,LInt2);
@@ -51,6 +51,15 @@ public:
                                       const TopAbs_State Side,
                                       const Standard_Real Tol);
 
+  //! Sets the flag of parallel intersection of the pairs of faces.
+  //! The pairs of faces sharing no sub-shapes are intersected simultaneously;
+  //! each pair is intersected after all preceding pairs sharing sub-shapes with it
+  //! and the results are stored in the same order as in sequential mode.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of parallel intersection of the pairs of faces.
+  Standard_Boolean IsRunParallel() const { return myIsParallel; }
+
   // Computes intersection of the given faces among each other
   Standard_EXPORT void CompletInt (const TopTools_ListOfShape& SetOfFaces,
                                    const BRepAlgo_Image& InitOffsetFace,
@@ -129,5 +138,6 @@ private:
   TopTools_IndexedMapOfShape myNewEdges;
   TopAbs_State mySide;
   Standard_Real myTol;
+  Standard_Boolean myIsParallel;
 };
 #endif // _BRepOffset_Inter3d_HeaderFile
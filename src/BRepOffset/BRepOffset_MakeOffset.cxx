@@ -95,6 +95,7 @@
 #include <Geom_Line.hxx>
 #include <NCollection_Vector.hxx>
 #include <NCollection_IncAllocator.hxx>
+#include <OSD_Parallel.hxx>
 //
 #include <BOPAlgo_MakerVolume.hxx>
 #include <BOPTools_AlgoTools.hxx>
@@ -591,6 +592,7 @@ static void FillContours(const TopoDS_Shape& aShape,
 //=======================================================================
 
 BRepOffset_MakeOffset::BRepOffset_MakeOffset()
+: myIsParallel (Standard_False)
 {
   myAsDes = new BRepAlgo_AsDes();
 }
@@ -622,7 +624,8 @@ mySelfInter  (SelfInter),
 myJoin       (Join),
 myThickening    (Thickening),
 myRemoveIntEdges(RemoveIntEdges),
-myDone     (Standard_False)
+myDone     (Standard_False),
+myIsParallel (Standard_False)
 {
   myAsDes = new BRepAlgo_AsDes();
   myIsLinearizationAllowed = Standard_True;
@@ -941,6 +944,7 @@ void BRepOffset_MakeOffset::MakeOffsetShape(const Message_ProgressRange& theRang
                                              "Connect offset faces by intersection");
 
   BRepOffset_Inter3d Inter(myAsDes,Side,myTol);
+  Inter.SetRunParallel (myIsParallel);
   Intersection3D (Inter, aPSInter.Next(90));
   if (myError != BRepOffset_NoError)
   {
@@ -1195,13 +1199,54 @@ const TopoDS_Shape&  BRepOffset_MakeOffset::Shape() const
   return myOffsetShape;
 }
 
+namespace
+{
+  //! Functor for parallel building of the offset faces not connected
+  //! to the other faces by tangential edges.
+  class BRepOffset_OffsetFaceFunctor
+  {
+  public:
+    BRepOffset_OffsetFaceFunctor (const NCollection_Array1<TopoDS_Face>& theFaces,
+                                  const NCollection_Array1<Standard_Real>& theOffsets,
+                                  const NCollection_Vector<Standard_Integer>& theIndices,
+                                  const Standard_Boolean theOffsetOutside,
+                                  const GeomAbs_JoinType theJoin,
+                                  NCollection_Array1<BRepOffset_Offset>& theOffsetFaces)
+    : myFaces (theFaces),
+      myOffsets (theOffsets),
+      myIndices (theIndices),
+      myOffsetOutside (theOffsetOutside),
+      myJoin (theJoin),
+      myOffsetFaces (theOffsetFaces)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const Standard_Integer i = myIndices.Value (theIndex);
+      // no shapes shared with the other offset faces
+      const TopTools_DataMapOfShapeShape aCreated;
+      myOffsetFaces.ChangeValue (i).Init (myFaces (i), myOffsets (i), aCreated, myOffsetOutside, myJoin);
+    }
+
+  private:
+    BRepOffset_OffsetFaceFunctor& operator= (const BRepOffset_OffsetFaceFunctor&);
+
+  private:
+    const NCollection_Array1<TopoDS_Face>& myFaces;
+    const NCollection_Array1<Standard_Real>& myOffsets;
+    const NCollection_Vector<Standard_Integer>& myIndices;
+    Standard_Boolean myOffsetOutside;
+    GeomAbs_JoinType myJoin;
+    NCollection_Array1<BRepOffset_Offset>& myOffsetFaces;
+  };
+}
+
 //=======================================================================
 //function : MakeOffsetFaces
 //purpose  : 
 //=======================================================================
 void BRepOffset_MakeOffset::MakeOffsetFaces(BRepOffset_DataMapOfShapeOffset& theMapSF, const Message_ProgressRange& theRange)
 {
-  Standard_Real aCurOffset;
   TopTools_ListOfShape aLF;
   TopTools_DataMapOfShapeShape ShapeTgt;
   TopTools_ListIteratorOfListOfShape aItLF;
@@ -1210,19 +1255,47 @@ void BRepOffset_MakeOffset::MakeOffsetFaces(BRepOffset_DataMapOfShapeOffset& the
   //
   BRepLib::SortFaces(myFaceComp, aLF);
   //
-  Message_ProgressScope aPS(theRange, "Making offset faces", aLF.Size());
-  aItLF.Initialize(aLF);
-  for (; aItLF.More(); aItLF.Next(), aPS.Next()) {
+  const Standard_Integer aNbF = aLF.Extent();
+  NCollection_Array1<TopoDS_Face> aFaces (1, Max (aNbF, 1));
+  NCollection_Array1<Standard_Real> anOffsets (1, Max (aNbF, 1));
+  NCollection_Array1<TopTools_ListOfShape> aTgtEdges (1, Max (aNbF, 1));
+  NCollection_Array1<BRepOffset_Offset> anOffsetFaces (1, Max (aNbF, 1));
+  //
+  // Faces without tangential edges neither use nor share the offset
+  // sub-shapes with the other faces, thus may be offset independently
+  NCollection_Vector<Standard_Integer> anIndependent;
+  Standard_Integer i = 1;
+  for (aItLF.Initialize(aLF); aItLF.More(); aItLF.Next(), ++i) {
+    const TopoDS_Face& aF = TopoDS::Face(aItLF.Value());
+    aFaces(i) = aF;
+    anOffsets(i) = myFaceOffset.IsBound(aF) ? myFaceOffset(aF) : myOffset;
+    myAnalyse.Edges(aF,ChFiDS_Tangential,aTgtEdges(i));
+    if (myIsParallel && aTgtEdges(i).IsEmpty()) {
+      anIndependent.Append(i);
+    }
+  }
+  //
+  Message_ProgressScope aPS(theRange, "Making offset faces", aNbF);
+  if (!anIndependent.IsEmpty()) {
+    BRepOffset_OffsetFaceFunctor aFunctor (aFaces, anOffsets, anIndependent,
+                                           OffsetOutside, myJoin, anOffsetFaces);
+    OSD_Parallel::For (0, anIndependent.Length(), aFunctor);
+    aPS.Next(anIndependent.Length());
+  }
+  //
+  for (i = 1; i <= aNbF; ++i) {
+    const TopoDS_Face& aF = aFaces(i);
+    const TopTools_ListOfShape& Let = aTgtEdges(i);
+    if (myIsParallel && Let.IsEmpty()) {
+      theMapSF.Bind(aF,anOffsetFaces(i));
+      continue;
+    }
     if (!aPS.More())
     {
       myError = BRepOffset_UserBreak;
       return;
     }
-    const TopoDS_Face& aF = TopoDS::Face(aItLF.Value());
-    aCurOffset = myFaceOffset.IsBound(aF) ? myFaceOffset(aF) : myOffset;
-    BRepOffset_Offset OF(aF, aCurOffset, ShapeTgt, OffsetOutside, myJoin);
-    TopTools_ListOfShape Let;
-    myAnalyse.Edges(aF,ChFiDS_Tangential,Let);
+    BRepOffset_Offset OF(aF, anOffsets(i), ShapeTgt, OffsetOutside, myJoin);
     TopTools_ListIteratorOfListOfShape itl(Let);    
     for (; itl.More(); itl.Next()) {
       const TopoDS_Edge& Cur = TopoDS::Edge(itl.Value());
@@ -1250,6 +1323,7 @@ void BRepOffset_MakeOffset::MakeOffsetFaces(BRepOffset_DataMapOfShapeOffset& the
       }
     }
     theMapSF.Bind(aF,OF);
+    aPS.Next();
   }
   //
   const TopTools_ListOfShape& aNewFaces = myAnalyse.NewFaces();
@@ -1344,6 +1418,7 @@ void BRepOffset_MakeOffset::BuildOffsetByInter(const Message_ProgressRange& theR
   if (myOffset > 0) ExtentContext = 1;
 
   BRepOffset_Inter3d Inter3 (AsDes,Side,myTol);
+  Inter3.SetRunParallel (myIsParallel);
   // Intersection between parallel faces
   Inter3.ConnexIntByInt(myFaceComp, MapSF, myAnalyse, MES, Build, Failed,
                         aPSOuter.Next(aSteps(BuildOffsetByInter_ConnexIntByInt)), myIsPlanar);
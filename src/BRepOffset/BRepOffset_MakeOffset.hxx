@@ -74,6 +74,15 @@ public:
   
   //! Changes the flag allowing the linearization
   Standard_EXPORT void AllowLinearization (const Standard_Boolean theIsAllowed);
+
+  //! Sets the flag of parallel processing.
+  //! If set, the offset faces are built and the pairs of offset faces
+  //! are intersected in parallel. The result does not depend on the
+  //! number of threads.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  Standard_Boolean IsRunParallel() const { return myIsParallel; }
   
   //! Add Closing Faces,  <F>  has to be  in  the initial
   //! shape S.
@@ -264,6 +273,7 @@ private:
   BRepOffset_MakeLoops myMakeLoops;
   Standard_Boolean myIsPerformSewing; // Handle bad walls in thicksolid mode.
   Standard_Boolean myIsPlanar;
+  Standard_Boolean myIsParallel;
   TopoDS_Shape myBadShape;
   TopTools_DataMapOfShapeShape myFacePlanfaceMap;
   TopTools_ListOfShape myGenerated;
@@ -114,6 +114,14 @@ public:
                                      const Standard_Boolean RemoveIntEdges = Standard_False,
                                      const Message_ProgressRange& theRange = Message_ProgressRange());
 
+  //! Sets the flag of parallel processing for the algorithm
+  //! with intersection / arc join (see BRepOffset_MakeOffset::SetRunParallel()).
+  //! Has to be called before PerformByJoin().
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myOffsetShape.SetRunParallel (theIsParallel); }
+
+  //! Returns the flag of parallel processing.
+  Standard_Boolean IsRunParallel() const { return myOffsetShape.IsRunParallel(); }
+
   //! Returns instance of the unrelying intersection / arc algorithm.
   Standard_EXPORT virtual const BRepOffset_MakeOffset& MakeOffset() const;
 
@@ -284,11 +284,12 @@ static Standard_Integer tcopy(Draw_Interpretor& di,Standard_Integer n,const char
 {
   Standard_Boolean copyGeom = Standard_True;
   Standard_Boolean copyMesh = Standard_False;
+  Standard_Boolean isParallel = Standard_False;
   Standard_Integer iFirst = 1; // index of first shape argument
 
   if (n > 1)
   {
-    for (Standard_Integer i = 1; i <= 2; i++)
+    for (Standard_Integer i = 1; i <= 3 && i < n; i++)
     {
       if (a[i][0] != '-')
         break;
@@ -302,17 +303,24 @@ static Standard_Integer tcopy(Draw_Interpretor& di,Standard_Integer n,const char
         copyMesh = Standard_True;
         iFirst++;
       }
+      else if (a[i][1] == 'p')
+      {
+        isParallel = Standard_True;
+        iFirst++;
+      }
     }
   }
 
   if (n < 3 || (n - iFirst) % 2) {
-    Message::SendFail() << "Use: " << a[0] << " [-n(ogeom)] [-m(esh)] shape1 copy1 [shape2 copy2 [...]]\n"
+    Message::SendFail() << "Use: " << a[0] << " [-n(ogeom)] [-m(esh)] [-p(arallel)] shape1 copy1 [shape2 copy2 [...]]\n"
                         << "Option -n forbids copying of geometry (it will be shared)\n"
-                        << "Option -m forces copying of mesh (disabled by default)";
+                        << "Option -m forces copying of mesh (disabled by default)\n"
+                        << "Option -p copies the geometry and mesh in parallel";
     return 1;
   }
 
   BRepBuilderAPI_Copy cop;
+  cop.SetRunParallel(isParallel);
   Standard_Integer nbPairs = (n - iFirst) / 2;
   for (Standard_Integer i=0; i < nbPairs; i++) {
     cop.Perform(DBRep::Get(a[i+iFirst]), copyGeom, copyMesh);
@@ -329,9 +337,16 @@ static Standard_Integer tcopy(Draw_Interpretor& di,Standard_Integer n,const char
 
 static Standard_Integer nurbsconvert(Draw_Interpretor& di,Standard_Integer n,const char** a)
 {
+  Standard_Boolean isParallel = Standard_False;
+  if (n > 1 && !strcmp(a[n-1], "-parallel"))
+  {
+    isParallel = Standard_True;
+    n--;
+  }
   if (n < 3) return 1;
   if ((n-1)%2 != 0) return 1;
   BRepBuilderAPI_NurbsConvert nbscv;
+  nbscv.SetRunParallel(isParallel);
   for (Standard_Integer i=0; i<(n-1)/2; i++) {
     TopoDS_Shape S = DBRep::Get(a[2*i+2]);
     if (S.IsNull()) {
@@ -380,12 +395,19 @@ static Standard_Integer sameparameter(Draw_Interpretor& di,Standard_Integer n,co
 {
   if (n < 2) 
   {
-    di << "Use sameparameter [result] shape [toler]\n";
+    di << "Use sameparameter [result] shape [toler] [-parallel]\n";
     di << "shape is an initial shape\n";
     di << "result is a result shape. if skipped = > initial shape will be modified\n";
-    di << "toler is tolerance (default is 1.e-7)";
+    di << "toler is tolerance (default is 1.e-7)\n";
+    di << "-parallel processes the edges in parallel";
     return 1;
   }
+  Standard_Boolean isParallel = Standard_False;
+  if (n > 2 && !strcmp(a[n-1], "-parallel"))
+  {
+    isParallel = Standard_True;
+    n--;
+  }
   Standard_Real aTol = 1.e-7;
   Standard_Boolean force  = !strcmp(a[0],"fsameparameter");
 
@@ -402,13 +424,13 @@ static Standard_Integer sameparameter(Draw_Interpretor& di,Standard_Integer n,co
   {
     TopoDS_Shape aResultSh;
     BRepTools_ReShape aResh;
-    BRepLib::SameParameter(anInpS,aResh,aTol,force);
+    BRepLib::SameParameter(anInpS,aResh,aTol,force,isParallel);
     aResultSh = aResh.Apply(anInpS);
     DBRep::Set(a[1],aResultSh); 
   }
   else
   {
-    BRepLib::SameParameter(anInpS,aTol,force);
+    BRepLib::SameParameter(anInpS,aTol,force,isParallel);
     DBRep::Set(a[1],anInpS); 
   }
 
@@ -1519,7 +1541,7 @@ void  BRepTest::BasicCommands(Draw_Interpretor& theCommands)
 		  transform,g);
 
   theCommands.Add("tcopy",
-		  "tcopy [-n(ogeom)] [-m(esh)] name1 result1 [name2 result2 ...]",
+		  "tcopy [-n(ogeom)] [-m(esh)] [-p(arallel)] name1 result1 [name2 result2 ...]",
 		  __FILE__,
 		  tcopy,g);
 
@@ -1574,12 +1596,12 @@ void  BRepTest::BasicCommands(Draw_Interpretor& theCommands)
 		  mkedgecurve,g);
 
   theCommands.Add("fsameparameter",
-		  "fsameparameter shapename [tol (default 1.e-7)], \nforce sameparameter on all edges of the shape",
+		  "fsameparameter shapename [tol (default 1.e-7)] [-parallel], \nforce sameparameter on all edges of the shape",
 		  __FILE__,
 		  sameparameter,g);
 
   theCommands.Add("sameparameter",
-		  "sameparameter [result] shape [tol]",
+		  "sameparameter [result] shape [tol] [-parallel]",
 		  __FILE__,
 		  sameparameter,g);
 
@@ -1643,7 +1665,8 @@ void  BRepTest::BasicCommands(Draw_Interpretor& theCommands)
                   __FILE__, IsBoxesInterfered, g);
 
   theCommands.Add("nurbsconvert",
-		  "nurbsconvert result name [result name]",
+		  "nurbsconvert result name [result name] [-parallel]"
+		  "\n\t\t: -parallel converts the geometry of the faces and edges in parallel",
 		  __FILE__,
 		  nurbsconvert,g);
 
@@ -968,6 +968,104 @@ static Standard_Integer checkshape (Draw_Interpretor& theCommands,
   return 0;
 }
 
+//=======================================================================
+//function : checkshapeseq
+//purpose  : Checks a sequence of shapes reusing the results of shared sub-shapes
+//=======================================================================
+static Standard_Integer checkshapeseq (Draw_Interpretor& theCommands,
+                                       Standard_Integer theNArg, const char** theArgVal)
+{
+  if (theNArg < 2)
+  {
+    theCommands.PrintHelp (theArgVal[0]);
+    return 1;
+  }
+
+  Standard_Boolean aGeomCtrl = Standard_True;
+  Standard_Boolean isParallel = Standard_False;
+  Standard_Boolean isExact = Standard_False;
+  Standard_Boolean isIncremental = Standard_True;
+  TopTools_ListOfShape aShapes;
+  NCollection_List<TCollection_AsciiString> aNames;
+  for (Standard_Integer anAI = 1; anAI < theNArg; ++anAI)
+  {
+    TCollection_AsciiString anArg (theArgVal[anAI]);
+    anArg.LowerCase();
+    if (anArg == "-top")
+    {
+      aGeomCtrl = Standard_False;
+    }
+    else if (anArg == "-parallel")
+    {
+      isParallel = Standard_True;
+    }
+    else if (anArg == "-exact")
+    {
+      isExact = Standard_True;
+    }
+    else if (anArg == "-full")
+    {
+      isIncremental = Standard_False;
+    }
+    else
+    {
+      TopoDS_Shape aShape = DBRep::Get (theArgVal[anAI]);
+      if (aShape.IsNull())
+      {
+        theCommands << "Syntax error: " << theArgVal[anAI] << " is not a topological shape\n";
+        return 1;
+      }
+      aShapes.Append (aShape);
+      aNames.Append (theArgVal[anAI]);
+    }
+  }
+
+  if (aShapes.IsEmpty())
+  {
+    theCommands << "Syntax error: no shapes to check\n";
+    return 1;
+  }
+
+  try
+  {
+    OCC_CATCH_SIGNALS
+    BRepCheck_Analyzer anAna (aShapes.First(), aGeomCtrl, isParallel, isExact);
+    NCollection_List<TCollection_AsciiString>::Iterator anItN (aNames);
+    Standard_Boolean isFirst = Standard_True;
+    for (TopTools_ListOfShape::Iterator anItS (aShapes); anItS.More(); anItS.Next(), anItN.Next())
+    {
+      if (!isFirst)
+      {
+        if (isIncremental)
+        {
+          anAna.Update (anItS.Value());
+        }
+        else
+        {
+          anAna.Init (anItS.Value(), aGeomCtrl);
+        }
+      }
+      isFirst = Standard_False;
+
+      theCommands << anItN.Value() << (anAna.IsValid() ? " is valid" : " is invalid");
+      if (isIncremental)
+      {
+        theCommands << ", reused results: " << anAna.NbReusedResults();
+      }
+      theCommands << "\n";
+    }
+  }
+  catch (Standard_Failure const& anException)
+  {
+    theCommands << "checkshapeseq exception : ";
+    theCommands << anException.GetMessageString();
+    theCommands << "\n";
+    return 1;
+  }
+
+  return 0;
+}
+
 /***************************************************************/
 static void InitEpsSurf(Standard_Real& epsnl,Standard_Real& epsdis, Standard_Real& epsangk1, 
 			Standard_Real& epsangk2, Standard_Real& epsangn1, 
@@ -1656,6 +1754,19 @@ void BRepTest::CheckCommands(Draw_Interpretor& theCommands)
 		  checkshape,
 		  g);
 
+  theCommands.Add("checkshapeseq",
+                  "checkshapeseq shape1 [shape2 ...] [-top] [-parallel] [-exact] [-full]\n"
+                  "\t\tChecks validity of the sequence of shapes (e.g. results of consecutive operations).\n"
+                  "\t\tThe results of the previous check are reused for the sub-shapes shared with\n"
+                  "\t\tthe previous shape, so only the modified part of the shape is checked again.\n"
+                  "\t\t-top      - check topology only;\n"
+                  "\t\t-parallel - run check in parallel;\n"
+                  "\t\t-exact    - run check using exact method;\n"
+                  "\t\t-full     - check each shape from scratch (for comparison).",
+                  __FILE__,
+                  checkshapeseq,
+                  g);
+
   theCommands.Add("checksection", 
 		  "checks the closure of a section : checksection name [-r <RefVal>]\n"
                   "\"-r\" - allowed number of alone vertices.",
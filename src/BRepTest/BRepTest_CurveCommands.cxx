@@ -1908,6 +1908,11 @@ Standard_Integer  build3d(Draw_Interpretor& di,
   Standard_Integer n, const char** a)
 {
 
+  Standard_Boolean isParallel = Standard_False;
+  if (n > 2 && !strcmp(a[n-1], "-parallel")) {
+    isParallel = Standard_True;
+    n--;
+  }
   if ( (n <2) || (n>3) ) {
     //std::cout << " 1 or 2 arguments expected" << std::endl;
     di << " 1 or 2 arguments expected\n";
@@ -1918,8 +1923,8 @@ Standard_Integer  build3d(Draw_Interpretor& di,
   TopoDS_Shape S = DBRep::Get(a[1]);
   if (S.IsNull()) return 1;
 
-  if (n==2) { Ok = BRepLib::BuildCurves3d(S); }
-  else      { Ok = BRepLib::BuildCurves3d(S,Draw::Atof(a[2])); }
+  if (n==2) { Ok = BRepLib::BuildCurves3d(S,1.0e-5,GeomAbs_C1,14,0,isParallel); }
+  else      { Ok = BRepLib::BuildCurves3d(S,Draw::Atof(a[2]),GeomAbs_C1,14,0,isParallel); }
   //if (!Ok) {std::cout << " one of the computation failed" << std::endl;}
   if (!Ok) {di << " one of the computation failed\n";}
 
@@ -2056,7 +2061,7 @@ void  BRepTest::CurveCommands(Draw_Interpretor& theCommands)
     edgeintersector,g);
 
   theCommands.Add("build3d",
-    "build3d S [tol]",__FILE__,
+    "build3d S [tol] [-parallel]",__FILE__,
     build3d, g);
 
   theCommands.Add("reducepcurves",
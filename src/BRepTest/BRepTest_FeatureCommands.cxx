@@ -1120,12 +1120,13 @@ static Standard_Real         TheTolerance = Precision::Confusion();
 static Standard_Boolean      TheInter = Standard_False;
 static GeomAbs_JoinType      TheJoin = GeomAbs_Arc;
 static Standard_Boolean      RemoveIntEdges = Standard_False;
+static Standard_Boolean      TheRunParallel = Standard_False;
 
 Standard_Integer offsetparameter(Draw_Interpretor& di,
   Standard_Integer n, const char** a)
 {
   if (n == 1) {
-    di << " offsetparameter Tol Inter(c/p) JoinType(a/i/t) [RemoveInternalEdges(r/k)]\n";
+    di << " offsetparameter Tol Inter(c/p) JoinType(a/i/t) [RemoveInternalEdges(r/k)] [-parallel]\n";
     di << " Current Values\n";
     di << "   --> Tolerance : " << TheTolerance << "\n";
     di << "   --> TheInter  : ";
@@ -1151,6 +1152,7 @@ Standard_Integer offsetparameter(Draw_Interpretor& di,
     else {
       di << "Keep";
     }
+    di << "\n   --> Parallel : " << (TheRunParallel ? "on" : "off");
     di << "\n";
     //
     return 0;
@@ -1165,7 +1167,15 @@ Standard_Integer offsetparameter(Draw_Interpretor& di,
   else if (!strcmp(a[3], "i")) TheJoin = GeomAbs_Intersection;
   else if (!strcmp(a[3], "t")) TheJoin = GeomAbs_Tangent;
   //
-  RemoveIntEdges = (n >= 5) ? !strcmp(a[4], "r") : Standard_False;
+  RemoveIntEdges = Standard_False;
+  TheRunParallel = Standard_False;
+  for (Standard_Integer i = 4; i < n; ++i)
+  {
+    if (!strcmp(a[i], "-parallel"))
+      TheRunParallel = Standard_True;
+    else
+      RemoveIntEdges = !strcmp(a[i], "r");
+  }
   //
   return 0;
 }
@@ -1188,6 +1198,7 @@ Standard_Integer offsetload(Draw_Interpretor&,
 
   TheOffset.Initialize(S, Of, TheTolerance, BRepOffset_Skin, TheInter, 0, TheJoin,
     Standard_False, RemoveIntEdges);
+  TheOffset.SetRunParallel(TheRunParallel);
   //------------------------------------------
   // recuperation et chargement des bouchons.
   //----------------------------------------
@@ -2566,7 +2577,7 @@ void BRepTest::FeatureCommands(Draw_Interpretor& theCommands)
     __FILE__, offsetshape, g);
 
   theCommands.Add("offsetparameter",
-    "offsetparameter Tol Inter(c/p) JoinType(a/i/t) [RemoveInternalEdges(r/k)]",
+    "offsetparameter Tol Inter(c/p) JoinType(a/i/t) [RemoveInternalEdges(r/k)] [-parallel]",
     __FILE__, offsetparameter, g);
 
   theCommands.Add("offsetload",
@@ -139,6 +139,11 @@ static Standard_Integer BLEND(Draw_Interpretor& di, Standard_Integer narg, const
 {
   if(Rakk != 0) {delete Rakk; Rakk = 0;}
   printtolblend(di);
+  Standard_Boolean isParallel = Standard_False;
+  if (narg > 1 && !strcasecmp(a[narg-1], "-parallel")) {
+    isParallel = Standard_True;
+    narg--;
+  }
   if (narg<5) return 1;
   TopoDS_Shape V = DBRep::Get(a[2]);
   if(V.IsNull()) return 1;
@@ -154,6 +159,7 @@ static Standard_Integer BLEND(Draw_Interpretor& di, Standard_Integer narg, const
   Rakk = new BRepFilletAPI_MakeFillet(V,FSh);
   Rakk->SetParams(ta,t3d,t2d,t3d,t2d,fl);
   Rakk->SetContinuity(blend_cont, tapp_angle);
+  Rakk->SetRunParallel(isParallel);
   Standard_Real Rad;
   TopoDS_Edge E;
   Standard_Integer nbedge = 0;
@@ -714,7 +720,7 @@ void  BRepTest::FilletCommands(Draw_Interpretor& theCommands)
 		  tolblend,g);
 
   theCommands.Add("blend",
-		  "blend result object rad1 ed1 rad2 ed2 ... [R/Q/P]",__FILE__,
+		  "blend result object rad1 ed1 rad2 ed2 ... [R/Q/P] [-parallel]",__FILE__,
 		  BLEND,g);
 
   theCommands.Add("checkhist",
@@ -34,7 +34,7 @@ Standard_IMPORT Draw_Viewer dout;
 Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
 {
   if (n < 2) {
-    di << "Use: " << a[0] << " shape [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri]\n";
+    di << "Use: " << a[0] << " shape [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri] [-parallel]\n";
     di << "Compute properties of the shape, exact geometry (curves, surfaces) or\n";
     di << "some discrete data (polygons, triangulations) can be used for calculations\n";
     di << "The epsilon, if given, defines relative precision of computation\n";
@@ -43,10 +43,17 @@ Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
     di << "Shared entities will be take in account only one time in the skip mode\n";
     di << "All values are outputted with the full precision in the full mode.\n";
     di << "Preferable source of geometry data are triangulations in case if it exists, if the -tri key is used.\n";
-    di << "If epsilon is given, exact geometry (curves, surfaces) are used for calculations independently of using key -tri\n\n";
+    di << "If epsilon is given, exact geometry (curves, surfaces) are used for calculations independently of using key -tri\n";
+    di << "The faces are integrated in parallel if the -parallel key is used.\n\n";
     return 1;
   }
 
+  Standard_Boolean RunParallel = Standard_False;
+  if (n >= 2 && strcmp(a[n - 1], "-parallel") == 0)
+  {
+    RunParallel = Standard_True;
+    --n;
+  }
   Standard_Boolean UseTriangulation = Standard_False;
   if (n >= 2 && strcmp(a[n - 1], "-tri") == 0)
   {
@@ -82,17 +89,17 @@ Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
     if (*a[0] == 'l')
       BRepGProp::LinearProperties(S,G,SkipShared);
     else if (*a[0] == 's')
-      eps = BRepGProp::SurfaceProperties(S,G,eps,SkipShared);
+      eps = BRepGProp::SurfaceProperties(S,G,eps,SkipShared,RunParallel);
     else 
-      eps = BRepGProp::VolumeProperties(S,G,eps,onlyClosed,SkipShared);
+      eps = BRepGProp::VolumeProperties(S,G,eps,onlyClosed,SkipShared,RunParallel);
   }
   else {
     if (*a[0] == 'l')
       BRepGProp::LinearProperties(S, G, SkipShared, UseTriangulation);
     else if (*a[0] == 's')
-      BRepGProp::SurfaceProperties(S, G, SkipShared, UseTriangulation);
+      BRepGProp::SurfaceProperties(S, G, SkipShared, UseTriangulation, RunParallel);
     else 
-      BRepGProp::VolumeProperties(S,G,onlyClosed,SkipShared, UseTriangulation);
+      BRepGProp::VolumeProperties(S,G,onlyClosed,SkipShared, UseTriangulation, RunParallel);
   }
   
   gp_Pnt P = G.CentreOfMass();
@@ -183,7 +190,7 @@ Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
 Standard_Integer vpropsgk(Draw_Interpretor& di, Standard_Integer n, const char** a)
 {
   if (n < 2) {
-    di << "Use: " << a[0] << " shape epsilon closed span mode [x y z] [-skip]\n";
+    di << "Use: " << a[0] << " shape epsilon closed span mode [x y z] [-skip] [-parallel]\n";
     di << "Compute properties of the shape\n";
     di << "The epsilon defines relative precision of computation\n";
     di << "The \"closed\" flag, if equal 1, causes computation only closed shells of the shape\n";
@@ -192,10 +199,18 @@ Standard_Integer vpropsgk(Draw_Interpretor& di, Standard_Integer n, const char**
     di << "mode can be 0 - only volume calculations\n";
     di << "            1 - volume and gravity center\n";
     di << "            2 - volume, gravity center and matrix of inertia\n";
-    di << "The centroid coordinates will be put to DRAW variables x y z (if given)\n\n";
+    di << "The centroid coordinates will be put to DRAW variables x y z (if given)\n";
+    di << "The faces are integrated in parallel if the -parallel key is used.\n\n";
     return 1;
   }
 
+  Standard_Boolean RunParallel = Standard_False;
+  if (n >= 2 && strcmp(a[n - 1], "-parallel") == 0)
+  {
+    RunParallel = Standard_True;
+    --n;
+  }
+
   if ( n > 2 && n < 6) {
     di << "Wrong arguments\n";
     return 1;
@@ -234,7 +249,7 @@ Standard_Integer vpropsgk(Draw_Interpretor& di, Standard_Integer n, const char**
 
   //aChrono.Reset();
   //aChrono.Start();
-  eps = BRepGProp::VolumePropertiesGK(S, G, eps, onlyClosed, isUseSpan, CGFlag, IFlag, SkipShared);
+  eps = BRepGProp::VolumePropertiesGK(S, G, eps, onlyClosed, isUseSpan, CGFlag, IFlag, SkipShared, RunParallel);
   //aChrono.Stop();
 
   Standard_SStream aSStream0;
@@ -333,13 +348,13 @@ void  BRepTest::GPropCommands(Draw_Interpretor& theCommands)
   theCommands.Add("lprops",
     "lprops name [x y z] [-skip] [-full] [-tri]: compute linear properties",
     __FILE__, props, g);
-  theCommands.Add("sprops", "sprops name [epsilon] [x y z] [-skip] [-full] [-tri]:\n"
+  theCommands.Add("sprops", "sprops name [epsilon] [x y z] [-skip] [-full] [-tri] [-parallel]:\n"
 "  compute surfacic properties", __FILE__, props, g);
-  theCommands.Add("vprops", "vprops name [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri]:\n"
+  theCommands.Add("vprops", "vprops name [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri] [-parallel]:\n"
 "  compute volumic properties", __FILE__, props, g);
 
   theCommands.Add("vpropsgk",
-		  "vpropsgk name epsilon closed span mode [x y z] [-skip] : compute volumic properties",
+		  "vpropsgk name epsilon closed span mode [x y z] [-skip] [-parallel] : compute volumic properties",
 		  __FILE__,
 		  vpropsgk,
 		  g);
@@ -340,10 +340,15 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
   Standard_Boolean aSetMinTol = Standard_False;
   Standard_Real aMinTol = 0.;
   Standard_Real aMaxTol = Precision::Infinite();
+  Standard_Boolean isParallel = Standard_False;
 
   for (Standard_Integer i = 2; i < theArgc; i++)
   {
-    if (theArgv[i][0] == '-' || theArgv[i][0] == '+')
+    if (!strcmp (theArgv[i], "-parallel"))
+    {
+      isParallel = Standard_True;
+    }
+    else if (theArgv[i][0] == '-' || theArgv[i][0] == '+')
     {
       Standard_Boolean aVal = (theArgv[i][0] == '+' ? Standard_True : Standard_False);
       switch (tolower(theArgv[i][1]))
@@ -418,6 +423,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
     theDi << "  p - mode for same parameter processing for edges\n";
     theDi << "  e - mode for sewing floating edges\n";
     theDi << "  f - mode for sewing faces\n";
+    theDi << "Option -parallel allows to perform cutting and merging in parallel mode\n";
     return (1);
   }
     
@@ -444,6 +450,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
   aSewing.SetFaceMode (aFaceMode);
   aSewing.SetMinTolerance (aMinTol);
   aSewing.SetMaxTolerance (aMaxTol);
+  aSewing.SetRunParallel (isParallel);
 
   for (Standard_Integer i = 1; i <= aSeq.Length(); i++)
     aSewing.Add(aSeq.Value(i));
@@ -745,7 +752,7 @@ void  BRepTest::SurfaceCommands(Draw_Interpretor& theCommands)
 		  __FILE__,pcurve,g);
 
   theCommands.Add("sewing",
-		  "sewing result [tolerance] shape1 shape2 ... [min tolerance] [max tolerance] [switches]",
+		  "sewing result [tolerance] shape1 shape2 ... [min tolerance] [max tolerance] [switches] [-parallel]",
 		  __FILE__,sewing, g);
 
   theCommands.Add("continuity", 
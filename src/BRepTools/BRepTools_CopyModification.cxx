@@ -213,3 +213,13 @@ GeomAbs_Shape BRepTools_CopyModification::Continuity(const TopoDS_Edge& theEdge,
 }
 
 
+//=======================================================================
+//function : IsThreadSafe
+//purpose  : 
+//=======================================================================
+Standard_Boolean BRepTools_CopyModification::IsThreadSafe() const
+{
+  return Standard_True;
+}
+
+
@@ -114,6 +114,10 @@ public:
                                                              const TopoDS_Face&                   theFace,
                                                              Handle(Poly_PolygonOnTriangulation)& thePoly) Standard_OVERRIDE;
 
+  //! Returns true as copying of the geometry
+  //! does not change the state of the modification.
+  Standard_EXPORT Standard_Boolean IsThreadSafe() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(BRepTools_CopyModification, BRepTools_Modification)
 
 private:
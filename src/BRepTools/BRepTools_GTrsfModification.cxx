@@ -373,3 +373,12 @@ Standard_Boolean BRepTools_GTrsfModification::NewPolygonOnTriangulation
     thePoly = thePoly->Copy();
   return Standard_True;
 }
+
+//=======================================================================
+//function : IsThreadSafe
+//purpose  : 
+//=======================================================================
+Standard_Boolean BRepTools_GTrsfModification::IsThreadSafe() const
+{
+  return Standard_True;
+}
@@ -35,3 +35,8 @@ Standard_Boolean BRepTools_Modification::NewPolygonOnTriangulation(const TopoDS_
 {
   return Standard_False;
 }
+
+Standard_Boolean BRepTools_Modification::IsThreadSafe() const
+{
+  return Standard_False;
+}
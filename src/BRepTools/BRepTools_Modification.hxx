@@ -122,6 +122,15 @@ public:
   //! (resp. <F2>).
   Standard_EXPORT virtual GeomAbs_Shape Continuity (const TopoDS_Edge& E, const TopoDS_Face& F1, const TopoDS_Face& F2, const TopoDS_Edge& NewE, const TopoDS_Face& NewF1, const TopoDS_Face& NewF2) = 0;
 
+  //! Returns true if the methods NewSurface(), NewCurve(), NewPoint(),
+  //! NewTriangulation() and NewPolygon() may be called concurrently
+  //! for different faces, edges and vertices.
+  //! In this case BRepTools_Modifier is allowed to evaluate them in parallel.
+  //! The faces (edges) sharing the same surface (curve) are still passed
+  //! to these methods in the order of their exploration in the shape.
+  //! Default implementation returns false.
+  Standard_EXPORT virtual Standard_Boolean IsThreadSafe() const;
+
 
 
 
@@ -49,17 +49,228 @@
 #include <Standard_NullObject.hxx>
 #include <BRepTools_TrsfModification.hxx>
 #include <Message_ProgressScope.hxx>
+#include <Geom_Curve.hxx>
 #include <Geom_Surface.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <TColStd_MapTransientHasher.hxx>
 
 static void SetShapeFlags(const TopoDS_Shape& theInSh, TopoDS_Shape& theOutSh);
 
+namespace
+{
+  //! New geometry of the vertex returned by the modification
+  struct BRepTools_NewPointResult
+  {
+    gp_Pnt Pnt;
+    Standard_Real Tol;
+    Standard_Boolean IsNew;
+
+    BRepTools_NewPointResult() : Tol (0.0), IsNew (Standard_False) {}
+  };
+
+  //! New geometry of the edge returned by the modification
+  struct BRepTools_NewCurveResult
+  {
+    Handle(Geom_Curve) Curve;
+    TopLoc_Location Loc;
+    Standard_Real Tol;
+    Standard_Boolean IsNew;
+
+    BRepTools_NewCurveResult() : Tol (0.0), IsNew (Standard_False) {}
+  };
+
+  //! New geometry of the face returned by the modification
+  struct BRepTools_NewSurfaceResult
+  {
+    Handle(Geom_Surface) Surface;
+    TopLoc_Location Loc;
+    Standard_Real Tol;
+    Standard_Boolean RevWires;
+    Standard_Boolean RevFace;
+    Standard_Boolean IsNew;
+
+    BRepTools_NewSurfaceResult()
+    : Tol (0.0), RevWires (Standard_False), RevFace (Standard_False), IsNew (Standard_False) {}
+  };
+
+  //! Splits the shapes with the given geometries into the chains of shapes
+  //! sharing the same geometry. The shapes of each chain are kept in the
+  //! original order, so that the modification receives them in the same
+  //! sequence as in the serial mode. If the chains are not requested,
+  //! each shape makes its own chain.
+  static void makeChains (const NCollection_Array1<Handle(Standard_Transient)>& theGeoms,
+                          const Standard_Boolean theToShare,
+                          NCollection_Vector<Standard_Integer>& theFirst,
+                          NCollection_Array1<Standard_Integer>& theNext)
+  {
+    theNext.Init (0);
+    NCollection_DataMap<Handle(Standard_Transient), Standard_Integer, TColStd_MapTransientHasher> aLastMap;
+    for (Standard_Integer i = theGeoms.Lower(); i <= theGeoms.Upper(); ++i)
+    {
+      const Handle(Standard_Transient)& aGeom = theGeoms (i);
+      Standard_Integer* aLast = (theToShare && !aGeom.IsNull()) ? aLastMap.ChangeSeek (aGeom) : NULL;
+      if (aLast == NULL)
+      {
+        theFirst.Append (i);
+        if (theToShare && !aGeom.IsNull())
+          aLastMap.Bind (aGeom, i);
+      }
+      else
+      {
+        theNext (*aLast) = i;
+        *aLast = i;
+      }
+    }
+  }
+
+  //! Functor for evaluation of the new points of the vertices
+  class BRepTools_NewPointFunctor
+  {
+  public:
+    BRepTools_NewPointFunctor (const TopTools_IndexedDataMapOfShapeListOfShape& theMVE,
+                               const Handle(BRepTools_Modification)& theModif,
+                               NCollection_Array1<BRepTools_NewPointResult>& theResults)
+    : myMVE (theMVE), myModif (theModif), myResults (theResults) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      BRepTools_NewPointResult& aRes = myResults.ChangeValue (theIndex);
+      aRes.IsNew = myModif->NewPoint (TopoDS::Vertex (myMVE.FindKey (theIndex)), aRes.Pnt, aRes.Tol);
+    }
+
+  private:
+    BRepTools_NewPointFunctor& operator= (const BRepTools_NewPointFunctor&);
+
+  private:
+    const TopTools_IndexedDataMapOfShapeListOfShape& myMVE;
+    const Handle(BRepTools_Modification)& myModif;
+    NCollection_Array1<BRepTools_NewPointResult>& myResults;
+  };
+
+  //! Functor for evaluation of the new curves of the chains of edges
+  class BRepTools_NewCurveFunctor
+  {
+  public:
+    BRepTools_NewCurveFunctor (const TopTools_IndexedDataMapOfShapeListOfShape& theMEF,
+                               const Handle(BRepTools_Modification)& theModif,
+                               const NCollection_Vector<Standard_Integer>& theFirst,
+                               const NCollection_Array1<Standard_Integer>& theNext,
+                               NCollection_Array1<BRepTools_NewCurveResult>& theResults)
+    : myMEF (theMEF), myModif (theModif), myFirst (theFirst), myNext (theNext), myResults (theResults) {}
+
+    void operator() (const Standard_Integer theChain) const
+    {
+      for (Standard_Integer i = myFirst (theChain); i > 0; i = myNext (i))
+      {
+        BRepTools_NewCurveResult& aRes = myResults.ChangeValue (i);
+        aRes.IsNew = myModif->NewCurve (TopoDS::Edge (myMEF.FindKey (i)), aRes.Curve, aRes.Loc, aRes.Tol);
+      }
+    }
+
+  private:
+    BRepTools_NewCurveFunctor& operator= (const BRepTools_NewCurveFunctor&);
+
+  private:
+    const TopTools_IndexedDataMapOfShapeListOfShape& myMEF;
+    const Handle(BRepTools_Modification)& myModif;
+    const NCollection_Vector<Standard_Integer>& myFirst;
+    const NCollection_Array1<Standard_Integer>& myNext;
+    NCollection_Array1<BRepTools_NewCurveResult>& myResults;
+  };
+
+  //! Functor for evaluation of the new surfaces of the chains of faces
+  class BRepTools_NewSurfaceFunctor
+  {
+  public:
+    BRepTools_NewSurfaceFunctor (const TopTools_IndexedMapOfShape& theMF,
+                                 const Handle(BRepTools_Modification)& theModif,
+                                 const NCollection_Vector<Standard_Integer>& theFirst,
+                                 const NCollection_Array1<Standard_Integer>& theNext,
+                                 NCollection_Array1<BRepTools_NewSurfaceResult>& theResults)
+    : myMF (theMF), myModif (theModif), myFirst (theFirst), myNext (theNext), myResults (theResults) {}
+
+    void operator() (const Standard_Integer theChain) const
+    {
+      for (Standard_Integer i = myFirst (theChain); i > 0; i = myNext (i))
+      {
+        BRepTools_NewSurfaceResult& aRes = myResults.ChangeValue (i);
+        aRes.IsNew = myModif->NewSurface (TopoDS::Face (myMF (i)), aRes.Surface, aRes.Loc,
+                                          aRes.Tol, aRes.RevWires, aRes.RevFace);
+      }
+    }
+
+  private:
+    BRepTools_NewSurfaceFunctor& operator= (const BRepTools_NewSurfaceFunctor&);
+
+  private:
+    const TopTools_IndexedMapOfShape& myMF;
+    const Handle(BRepTools_Modification)& myModif;
+    const NCollection_Vector<Standard_Integer>& myFirst;
+    const NCollection_Array1<Standard_Integer>& myNext;
+    NCollection_Array1<BRepTools_NewSurfaceResult>& myResults;
+  };
+
+  //! Functor for evaluation of the new triangulations of the faces
+  class BRepTools_NewTriangulationFunctor
+  {
+  public:
+    BRepTools_NewTriangulationFunctor (const TopTools_IndexedMapOfShape& theMF,
+                                       const Handle(BRepTools_Modification)& theModif,
+                                       NCollection_Array1<Handle(Poly_Triangulation)>& theResults)
+    : myMF (theMF), myModif (theModif), myResults (theResults) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      Handle(Poly_Triangulation)& aTriangulation = myResults.ChangeValue (theIndex);
+      if (!myModif->NewTriangulation (TopoDS::Face (myMF (theIndex)), aTriangulation))
+        aTriangulation.Nullify();
+    }
+
+  private:
+    BRepTools_NewTriangulationFunctor& operator= (const BRepTools_NewTriangulationFunctor&);
+
+  private:
+    const TopTools_IndexedMapOfShape& myMF;
+    const Handle(BRepTools_Modification)& myModif;
+    NCollection_Array1<Handle(Poly_Triangulation)>& myResults;
+  };
+
+  //! Functor for evaluation of the new 3D polygons of the edges
+  class BRepTools_NewPolygonFunctor
+  {
+  public:
+    BRepTools_NewPolygonFunctor (const TopTools_IndexedDataMapOfShapeListOfShape& theMEF,
+                                 const Handle(BRepTools_Modification)& theModif,
+                                 NCollection_Array1<Handle(Poly_Polygon3D)>& theResults)
+    : myMEF (theMEF), myModif (theModif), myResults (theResults) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      Handle(Poly_Polygon3D)& aPolygon = myResults.ChangeValue (theIndex);
+      if (!myModif->NewPolygon (TopoDS::Edge (myMEF.FindKey (theIndex)), aPolygon))
+        aPolygon.Nullify();
+    }
+
+  private:
+    BRepTools_NewPolygonFunctor& operator= (const BRepTools_NewPolygonFunctor&);
+
+  private:
+    const TopTools_IndexedDataMapOfShapeListOfShape& myMEF;
+    const Handle(BRepTools_Modification)& myModif;
+    NCollection_Array1<Handle(Poly_Polygon3D)>& myResults;
+  };
+}
+
 //=======================================================================
 //function : BRepTools_Modifier
 //purpose  : 
 //=======================================================================
 
 BRepTools_Modifier::BRepTools_Modifier (Standard_Boolean theMutableInput):
-myDone(Standard_False), myMutableInput (theMutableInput)
+myDone(Standard_False), myMutableInput (theMutableInput), myIsParallel (Standard_False), myHasNewMeshInfo (Standard_False)
 {}
 
 //=======================================================================
@@ -68,7 +279,7 @@ myDone(Standard_False), myMutableInput (theMutableInput)
 //=======================================================================
 
 BRepTools_Modifier::BRepTools_Modifier (const TopoDS_Shape& S) :
-myShape(S),myDone(Standard_False), myMutableInput (Standard_False)
+myShape(S),myDone(Standard_False), myMutableInput (Standard_False), myIsParallel (Standard_False), myHasNewMeshInfo (Standard_False)
 {
   Put(S);
 }
@@ -82,7 +293,7 @@ BRepTools_Modifier::BRepTools_Modifier
   (const TopoDS_Shape& S,
    const Handle(BRepTools_Modification)& M)
    : myShape(S), myDone(Standard_False), 
-     myMutableInput (Standard_False)
+     myMutableInput (Standard_False), myIsParallel (Standard_False), myHasNewMeshInfo (Standard_False)
 {
   Put(S);
   Perform(M);
@@ -135,6 +346,8 @@ void BRepTools_Modifier::Perform(const Handle(BRepTools_Modification)& M,
 
   FillNewSurfaceInfo(M);
 
+  FillNewMeshInfo(aMEF, M);
+
   if (!myMutableInput)
     CreateOtherVertices(aMVE, aMEF, M);
 
@@ -276,7 +489,8 @@ Standard_Boolean BRepTools_Modifier::Rebuild
 
       // update triangulation on the copied face
       Handle(Poly_Triangulation) aTriangulation;
-      if (M->NewTriangulation(TopoDS::Face(S), aTriangulation))
+      if (myHasNewMeshInfo ? myNewTriangulations.Find(TopoDS::Face(S), aTriangulation)
+                           : M->NewTriangulation(TopoDS::Face(S), aTriangulation))
       {
         if (rebuild) // the copied face already exists => update it
           B.UpdateFace(TopoDS::Face(result), aTriangulation);
@@ -320,7 +534,8 @@ Standard_Boolean BRepTools_Modifier::Rebuild
 
       // update polygonal structure on the edge
       Handle(Poly_Polygon3D) aPolygon;
-      if (M->NewPolygon(TopoDS::Edge(S), aPolygon))
+      if (myHasNewMeshInfo ? myNewPolygons.Find(TopoDS::Edge(S), aPolygon)
+                           : M->NewPolygon(TopoDS::Edge(S), aPolygon))
       {
         if (rebuild) // the copied edge already exists => update it
           B.UpdateEdge(TopoDS::Edge(result), aPolygon, S.Location());
@@ -597,20 +812,32 @@ Standard_Boolean BRepTools_Modifier::Rebuild
   return rebuild;
 }
 
+//=======================================================================
+//function : CreateNewVertices
+//purpose  : The new points are evaluated in parallel if requested
+//           and allowed by the modification, and then stored in order.
+//=======================================================================
+
 void BRepTools_Modifier::CreateNewVertices( const TopTools_IndexedDataMapOfShapeListOfShape& theMVE, const Handle(BRepTools_Modification)& M)
 {
-  double aToler;
+  const Standard_Integer aNbV = theMVE.Extent();
+  if (aNbV == 0)
+    return;
+
+  NCollection_Array1<BRepTools_NewPointResult> aResults (1, aNbV);
+  BRepTools_NewPointFunctor aFunctor (theMVE, M, aResults);
+  OSD_Parallel::For (1, aNbV + 1, aFunctor, !(myIsParallel && M->IsThreadSafe()));
+
   BRep_Builder aBB;
-  gp_Pnt aPnt;  
-  for (int i = 1; i <= theMVE.Extent(); i++ )
+  for (int i = 1; i <= aNbV; i++ )
   {
     //fill MyMap only with vertices with NewPoint == true
     const TopoDS_Vertex& aV = TopoDS::Vertex(theMVE.FindKey(i));
-    Standard_Boolean IsNewP = M->NewPoint(aV, aPnt, aToler);
-    if (IsNewP)
+    const BRepTools_NewPointResult& aRes = aResults (i);
+    if (aRes.IsNew)
     {
       TopoDS_Vertex aNewV;
-      aBB.MakeVertex(aNewV, aPnt, aToler);
+      aBB.MakeVertex(aNewV, aRes.Pnt, aRes.Tol);
       SetShapeFlags(aV, aNewV);
       myMap(aV) = aNewV;
       myHasNewGeom.Add(aV);
@@ -620,48 +847,93 @@ void BRepTools_Modifier::CreateNewVertices( const TopTools_IndexedDataMapOfShape
   }
 }
 
+//=======================================================================
+//function : FillNewCurveInfo
+//purpose  : In parallel mode the edges sharing the same 3D curve are
+//           passed to the modification in one thread in their order.
+//=======================================================================
+
 void BRepTools_Modifier::FillNewCurveInfo(const TopTools_IndexedDataMapOfShapeListOfShape& theMEF, const Handle(BRepTools_Modification)& M)
 {
-  Handle(Geom_Curve) aCurve;
-  TopLoc_Location aLocation;
+  const Standard_Integer aNbE = theMEF.Extent();
+  if (aNbE == 0)
+    return;
+
+  const Standard_Boolean isParallel = myIsParallel && M->IsThreadSafe();
+  NCollection_Array1<Handle(Standard_Transient)> aCurves (1, aNbE);
+  if (isParallel)
+  {
+    TopLoc_Location aLoc;
+    Standard_Real aFirst, aLast;
+    for (int i = 1; i <= aNbE; i++ )
+      aCurves (i) = BRep_Tool::Curve (TopoDS::Edge (theMEF.FindKey (i)), aLoc, aFirst, aLast);
+  }
+  NCollection_Vector<Standard_Integer> aFirstInChain;
+  NCollection_Array1<Standard_Integer> aNextInChain (1, aNbE);
+  makeChains (aCurves, isParallel, aFirstInChain, aNextInChain);
+
+  NCollection_Array1<BRepTools_NewCurveResult> aResults (1, aNbE);
+  BRepTools_NewCurveFunctor aFunctor (theMEF, M, aFirstInChain, aNextInChain, aResults);
+  OSD_Parallel::For (0, aFirstInChain.Length(), aFunctor, !isParallel);
+
   BRepTools_Modifier::NewCurveInfo aNCinfo;
-  double aToler;
-  for (int i = 1; i <= theMEF.Extent(); i++ )
+  for (int i = 1; i <= aNbE; i++ )
   {
     const TopoDS_Edge& anE = TopoDS::Edge(theMEF.FindKey(i));
-    Standard_Boolean IsNewCur = M->NewCurve(anE, aCurve, aLocation, aToler);
-    if (IsNewCur)
+    const BRepTools_NewCurveResult& aRes = aResults (i);
+    if (aRes.IsNew)
     {
-      aNCinfo.myCurve = aCurve;
-      aNCinfo.myLoc = aLocation;
-      aNCinfo.myToler = aToler;
+      aNCinfo.myCurve = aRes.Curve;
+      aNCinfo.myLoc = aRes.Loc;
+      aNCinfo.myToler = aRes.Tol;
       myNCInfo.Bind(anE, aNCinfo);
       myHasNewGeom.Add(anE);
     }
   }
 }
 
+//=======================================================================
+//function : FillNewSurfaceInfo
+//purpose  : In parallel mode the faces sharing the same surface are
+//           passed to the modification in one thread in their order.
+//=======================================================================
+
 void BRepTools_Modifier::FillNewSurfaceInfo(const Handle(BRepTools_Modification)& M)
 {
   TopTools_IndexedMapOfShape aMF;  
   TopExp::MapShapes(myShape, TopAbs_FACE, aMF);
+  const Standard_Integer aNbF = aMF.Extent();
+  if (aNbF == 0)
+    return;
+
+  const Standard_Boolean isParallel = myIsParallel && M->IsThreadSafe();
+  NCollection_Array1<Handle(Standard_Transient)> aSurfaces (1, aNbF);
+  if (isParallel)
+  {
+    TopLoc_Location aLoc;
+    for (int i = 1; i <= aNbF; i++ )
+      aSurfaces (i) = BRep_Tool::Surface (TopoDS::Face (aMF (i)), aLoc);
+  }
+  NCollection_Vector<Standard_Integer> aFirstInChain;
+  NCollection_Array1<Standard_Integer> aNextInChain (1, aNbF);
+  makeChains (aSurfaces, isParallel, aFirstInChain, aNextInChain);
+
+  NCollection_Array1<BRepTools_NewSurfaceResult> aResults (1, aNbF);
+  BRepTools_NewSurfaceFunctor aFunctor (aMF, M, aFirstInChain, aNextInChain, aResults);
+  OSD_Parallel::For (0, aFirstInChain.Length(), aFunctor, !isParallel);
+
   BRepTools_Modifier::NewSurfaceInfo aNSinfo;
-  for (int i = 1; i <= aMF.Extent(); i++ )
+  for (int i = 1; i <= aNbF; i++ )
   {
     const TopoDS_Face& aF = TopoDS::Face(aMF(i));
-    Standard_Boolean RevFace;
-    Standard_Boolean RevWires;
-    Handle(Geom_Surface) aSurface;
-    TopLoc_Location aLocation;
-    double aToler1;
-    Standard_Boolean IsNewSur = M->NewSurface(aF, aSurface, aLocation, aToler1, RevWires,RevFace);
-    if (IsNewSur)
+    const BRepTools_NewSurfaceResult& aRes = aResults (i);
+    if (aRes.IsNew)
     {
-      aNSinfo.mySurface = aSurface;
-      aNSinfo.myLoc = aLocation;
-      aNSinfo.myToler = aToler1;
-      aNSinfo.myRevWires = RevWires;
-      aNSinfo.myRevFace = RevFace;
+      aNSinfo.mySurface = aRes.Surface;
+      aNSinfo.myLoc = aRes.Loc;
+      aNSinfo.myToler = aRes.Tol;
+      aNSinfo.myRevWires = aRes.RevWires;
+      aNSinfo.myRevFace = aRes.RevFace;
       myNSInfo.Bind(aF, aNSinfo);
       myHasNewGeom.Add(aF);
     }
@@ -701,6 +973,48 @@ void BRepTools_Modifier::FillNewSurfaceInfo(const Handle(BRepTools_Modification)
 
 }
 
+//=======================================================================
+//function : FillNewMeshInfo
+//purpose  : In parallel mode the triangulations of the faces and the
+//           polygons of the edges are converted in advance, otherwise
+//           they are converted during the rebuilding.
+//=======================================================================
+
+void BRepTools_Modifier::FillNewMeshInfo(const TopTools_IndexedDataMapOfShapeListOfShape& theMEF, const Handle(BRepTools_Modification)& M)
+{
+  myNewTriangulations.Clear();
+  myNewPolygons.Clear();
+  myHasNewMeshInfo = myIsParallel && M->IsThreadSafe();
+  if (!myHasNewMeshInfo)
+    return;
+
+  TopTools_IndexedMapOfShape aMF;
+  TopExp::MapShapes(myShape, TopAbs_FACE, aMF);
+  if (aMF.Extent() > 0)
+  {
+    NCollection_Array1<Handle(Poly_Triangulation)> aTriangulations (1, aMF.Extent());
+    BRepTools_NewTriangulationFunctor aFunctor (aMF, M, aTriangulations);
+    OSD_Parallel::For (1, aMF.Extent() + 1, aFunctor);
+    for (int i = 1; i <= aMF.Extent(); i++ )
+    {
+      if (!aTriangulations (i).IsNull())
+        myNewTriangulations.Bind (TopoDS::Face (aMF (i)), aTriangulations (i));
+    }
+  }
+
+  if (theMEF.Extent() > 0)
+  {
+    NCollection_Array1<Handle(Poly_Polygon3D)> aPolygons (1, theMEF.Extent());
+    BRepTools_NewPolygonFunctor aFunctor (theMEF, M, aPolygons);
+    OSD_Parallel::For (1, theMEF.Extent() + 1, aFunctor);
+    for (int i = 1; i <= theMEF.Extent(); i++ )
+    {
+      if (!aPolygons (i).IsNull())
+        myNewPolygons.Bind (TopoDS::Edge (theMEF.FindKey (i)), aPolygons (i));
+    }
+  }
+}
+
 void BRepTools_Modifier::CreateOtherVertices(const TopTools_IndexedDataMapOfShapeListOfShape& theMVE, 
                                              const TopTools_IndexedDataMapOfShapeListOfShape& theMEF, 
                                              const Handle(BRepTools_Modification)& M)
@@ -32,6 +32,8 @@
 #include <TopTools_ShapeMapHasher.hxx>
 #include <TopLoc_Location.hxx>
 #include <Message_ProgressRange.hxx>
+#include <Poly_Polygon3D.hxx>
+#include <Poly_Triangulation.hxx>
 
 class BRepTools_Modification;
 class Geom_Curve;
@@ -73,6 +75,17 @@ public:
   //! during modification process
   Standard_EXPORT void SetMutableInput(Standard_Boolean theMutableInput);
 
+  //! Sets the flag of parallel evaluation of the new geometry of the faces,
+  //! edges and vertices (methods NewSurface(), NewCurve(), NewPoint(),
+  //! NewTriangulation() and NewPolygon() of the modification). The flag is taken into account only for the
+  //! modifications declaring themselves thread-safe (see
+  //! BRepTools_Modification::IsThreadSafe()). The topology is rebuilt
+  //! sequentially, so the result does not depend on the flag.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of parallel evaluation of the new geometry.
+  Standard_Boolean IsRunParallel() const { return myIsParallel; }
+
   //! Returns the modified shape corresponding to <S>.
   const TopoDS_Shape& ModifiedShape (const TopoDS_Shape& S) const;
   
@@ -116,6 +129,10 @@ private:
 
   Standard_EXPORT void FillNewSurfaceInfo(const Handle(BRepTools_Modification)& M);
 
+  Standard_EXPORT void FillNewMeshInfo(
+    const TopTools_IndexedDataMapOfShapeListOfShape& theMEF,
+    const Handle(BRepTools_Modification)& M);
+
   Standard_EXPORT void CreateOtherVertices(
     const TopTools_IndexedDataMapOfShapeListOfShape& theMVE, 
     const TopTools_IndexedDataMapOfShapeListOfShape& theMEF, 
@@ -129,6 +146,10 @@ private:
   TopTools_MapOfShape myNonUpdFace;
   TopTools_MapOfShape myHasNewGeom;
   Standard_Boolean myMutableInput;
+  Standard_Boolean myIsParallel;
+  Standard_Boolean myHasNewMeshInfo;
+  NCollection_DataMap<TopoDS_Face, Handle(Poly_Triangulation), TopTools_ShapeMapHasher> myNewTriangulations;
+  NCollection_DataMap<TopoDS_Edge, Handle(Poly_Polygon3D), TopTools_ShapeMapHasher> myNewPolygons;
 
 };
 
@@ -352,6 +352,7 @@ Standard_Boolean BRepTools_NurbsConvertModification::NewSurface
     GeomLib_ChangeVBounds(BS, V1, V2) ;
   }
 
+  Standard_Mutex::Sentry aSentry (myMutex);
   if (!myMap.Contains(SS)) {
     myMap.Add(SS, S);
   }
@@ -486,6 +487,7 @@ Standard_Boolean BRepTools_NurbsConvertModification::NewCurve
     }
   }
 
+  Standard_Mutex::Sentry aSentry (myMutex);
   if(!myMap.Contains(Caux)) {
     myMap.Add(Caux,C);
   }
@@ -980,3 +982,12 @@ const TopTools_ListOfShape&
 {
   return myUpdatedEdges;
 }
+
+//=======================================================================
+//function : IsThreadSafe
+//purpose  : 
+//=======================================================================
+Standard_Boolean BRepTools_NurbsConvertModification::IsThreadSafe() const
+{
+  return Standard_True;
+}
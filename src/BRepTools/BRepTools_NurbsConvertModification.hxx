@@ -23,6 +23,7 @@
 #include <TColStd_ListOfTransient.hxx>
 #include <TColStd_IndexedDataMapOfTransientTransient.hxx>
 #include <BRepTools_CopyModification.hxx>
+#include <Standard_Mutex.hxx>
 #include <Standard_Real.hxx>
 #include <GeomAbs_Shape.hxx>
 class TopoDS_Face;
@@ -117,6 +118,10 @@ public:
                                                              const TopoDS_Face&                   theFace,
                                                              Handle(Poly_PolygonOnTriangulation)& thePoly) Standard_OVERRIDE;
 
+  //! Returns true. The map of converted geometries filled by NewSurface()
+  //! and NewCurve() is protected by the mutex.
+  Standard_EXPORT Standard_Boolean IsThreadSafe() const Standard_OVERRIDE;
+
   Standard_EXPORT const TopTools_ListOfShape& GetUpdatedEdges() const;
 
 
@@ -134,6 +139,7 @@ private:
   TColStd_ListOfTransient mylcu;
   TColStd_IndexedDataMapOfTransientTransient myMap;
   TopTools_ListOfShape myUpdatedEdges;
+  Standard_Mutex myMutex;
 
 
 };
@@ -109,7 +109,9 @@ static void CopyRanges (const TopoDS_Shape& toedge, const TopoDS_Shape& fromedge
 //=======================================================================
 
 BRepTools_ReShape::BRepTools_ReShape()
-: myStatus(-1)
+: myLowestRecordedType(TopAbs_COMPOUND),
+  myIsCachedConsiderLocation(Standard_False),
+  myStatus(-1)
 {
   myConsiderLocation = Standard_False;
 }
@@ -123,6 +125,8 @@ BRepTools_ReShape::BRepTools_ReShape()
 void BRepTools_ReShape::Clear() 
 {
   myShapeToReplacement.Clear();
+  myLowestRecordedType = TopAbs_COMPOUND;
+  myHasRecordedSubShapes.Clear();
   myNewShapes.Clear();
 }
 
@@ -179,9 +183,32 @@ void BRepTools_ReShape::replace (const TopoDS_Shape& ashape,
 #endif
 
   myShapeToReplacement.Bind(shape, TReplacement(newshape, theKind));
+  if (shape.ShapeType() > myLowestRecordedType)
+    myLowestRecordedType = shape.ShapeType();
+  myHasRecordedSubShapes.Clear();
   myNewShapes.Add (newshape);
 }
 
+//=======================================================================
+//function : AddRecords
+//purpose  : 
+//=======================================================================
+
+void BRepTools_ReShape::AddRecords (const BRepTools_ReShape& theOther)
+{
+  for (TShapeToReplacement::Iterator anIt (theOther.myShapeToReplacement); anIt.More(); anIt.Next())
+  {
+    myShapeToReplacement.Bind (anIt.Key(), anIt.Value());
+  }
+  if (!theOther.myShapeToReplacement.IsEmpty() && theOther.myLowestRecordedType > myLowestRecordedType)
+    myLowestRecordedType = theOther.myLowestRecordedType;
+  myHasRecordedSubShapes.Clear();
+  for (TopTools_MapOfShape::Iterator anIt (theOther.myNewShapes); anIt.More(); anIt.Next())
+  {
+    myNewShapes.Add (anIt.Value());
+  }
+}
+
 //=======================================================================
 //function : IsRecorded
 //purpose  : 
@@ -199,6 +226,41 @@ Standard_Boolean BRepTools_ReShape::IsRecorded (const TopoDS_Shape& ashape) cons
 }
 
 
+//=======================================================================
+//function : HasRecordedSubShapes
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean BRepTools_ReShape::HasRecordedSubShapes (const TopoDS_Shape& theShape)
+{
+  // the sub-shapes of the same or lower level than all recorded shapes cannot be recorded,
+  // while a compound may contain shapes of any level
+  const TopAbs_ShapeEnum aType = theShape.ShapeType();
+  if (myShapeToReplacement.IsEmpty()
+   || (aType != TopAbs_COMPOUND && aType >= myLowestRecordedType))
+  {
+    return Standard_False;
+  }
+
+  if (myIsCachedConsiderLocation != myConsiderLocation)
+  {
+    myHasRecordedSubShapes.Clear();
+    myIsCachedConsiderLocation = myConsiderLocation;
+  }
+  if (const Standard_Boolean* aCached = myHasRecordedSubShapes.Seek (theShape))
+  {
+    return *aCached;
+  }
+
+  Standard_Boolean hasRecorded = Standard_False;
+  for (TopoDS_Iterator anIt (theShape, Standard_False); anIt.More() && !hasRecorded; anIt.Next())
+  {
+    hasRecorded = IsRecorded (anIt.Value()) || HasRecordedSubShapes (anIt.Value());
+  }
+  myHasRecordedSubShapes.Bind (theShape, hasRecorded);
+  return hasRecorded;
+}
+
 //=======================================================================
 //function : Value
 //purpose  : 
@@ -361,6 +423,9 @@ TopoDS_Shape BRepTools_ReShape::Apply (const TopoDS_Shape& shape,
   if (st > until || (st == until && until > TopAbs_COMPOUND)) return newsh; // stopping criteria
   if(st == TopAbs_VERTEX || st == TopAbs_SHAPE)
     return shape;
+  // the sub-shapes cannot be modified, skip the whole sub-tree
+  if (!HasRecordedSubShapes(shape))
+    return shape;
   // define allowed types of components
   //fix for SAMTECH bug OCC322 about abcense internal vertices after sewing. 
   /*
@@ -379,20 +444,29 @@ TopoDS_Shape BRepTools_ReShape::Apply (const TopoDS_Shape& shape,
   */
   BRep_Builder B;
   
-  TopoDS_Shape result = shape.EmptyCopied();
+  // the copy of the shape is made only when the first modified sub-shape is met
+  TopoDS_Shape result;
   TopAbs_Orientation orien = shape.Orientation();
-  result.Orientation(TopAbs_FORWARD); // protect against INTERNAL or EXTERNAL shapes
   Standard_Boolean modif = Standard_False;
   Standard_Integer locStatus = myStatus;
   
   // apply recorded modifications to subshapes
   Standard_Boolean isEmpty = Standard_True;
-  for ( TopoDS_Iterator it(shape,Standard_False); it.More(); it.Next() ) {
+  Standard_Integer aNbPrevious = 0;
+  for ( TopoDS_Iterator it(shape,Standard_False); it.More(); it.Next(), aNbPrevious++ ) {
     TopoDS_Shape sh = it.Value();
     newsh = Apply ( sh, until );
     if ( newsh != sh ) {
       if ( myStatus & EncodeStatus(4)) //ShapeExtend::DecodeStatus ( myStatus, ShapeExtend_DONE4 ) )
         locStatus |= EncodeStatus(4); //|= ShapeExtend::EncodeStatus ( ShapeExtend_DONE4 );
+      if ( ! modif ) {
+        result = shape.EmptyCopied();
+        result.Orientation(TopAbs_FORWARD); // protect against INTERNAL or EXTERNAL shapes
+        // add the preceding sub-shapes, which are not modified
+        TopoDS_Iterator aPrevIt(shape,Standard_False);
+        for ( Standard_Integer i = 0; i < aNbPrevious; i++, aPrevIt.Next() )
+          B.Add ( result, aPrevIt.Value() );
+      }
       modif = 1;
     }
     if ( newsh.IsNull() ) {
@@ -402,6 +476,8 @@ TopoDS_Shape BRepTools_ReShape::Apply (const TopoDS_Shape& shape,
     if ( isEmpty )
       isEmpty = Standard_False;
     locStatus |= EncodeStatus(3);//ShapeExtend::EncodeStatus ( ShapeExtend_DONE3 );
+    if ( ! modif )
+      continue;
     if ( st == TopAbs_COMPOUND || newsh.ShapeType() == sh.ShapeType()) { //fix for SAMTECH bug OCC322 about abcense internal vertices after sewing.
       B.Add ( result, newsh );
       continue;
@@ -90,6 +90,13 @@ public:
     }
   }
 
+  //! Adds all replacements recorded in <theOther> to this one.
+  //! The records of this object for the same shapes are overwritten.
+  //! Both objects should have the same ModeConsiderLocation.
+  //! Allows collecting the modifications made independently
+  //! (e.g. in different threads) in separate objects.
+  Standard_EXPORT void AddRecords (const BRepTools_ReShape& theOther);
+
   //! Tells if a shape is recorded for Replace/Remove
   Standard_EXPORT virtual Standard_Boolean IsRecorded (const TopoDS_Shape& shape) const;
   
@@ -118,6 +125,10 @@ public:
   //! (for example, TopoDS_Edge can be replaced by TopoDS_Edge,
   //! TopoDS_Wire or TopoDS_Compound containing TopoDS_Edges).
   //! If incompatible shape type is encountered, it is ignored and flag FAIL1 is set in Status.
+  //!
+  //! Only the ancestors of the recorded sub-shapes are rebuilt. The sub-shapes
+  //! which do not contain recorded shapes (see HasRecordedSubShapes()) are
+  //! not explored, so each shared sub-shape is searched for the recorded shapes once.
   Standard_EXPORT virtual TopoDS_Shape Apply (const TopoDS_Shape& theShape,
                                               const TopAbs_ShapeEnum theUntil = TopAbs_SHAPE);
 
@@ -142,6 +153,12 @@ public:
                                            const gp_Pnt& theNewPos,
                                            const Standard_Real aTol);
 
+  //! Returns true if some sub-shape of the given shape (at any depth) is recorded.
+  //! The answer is cached for each explored sub-shape until the next request is recorded,
+  //! so the sub-shapes shared by several ancestors are explored once.
+  //! The sub-shapes of the same or lower level than all recorded shapes are not explored.
+  Standard_EXPORT Standard_Boolean HasRecordedSubShapes (const TopoDS_Shape& theShape);
+
   //! Checks if shape has been recorded by reshaper as a value
   //@param theShape is the given shape
   Standard_EXPORT Standard_Boolean IsNewShape(const TopoDS_Shape& theShape) const;
@@ -232,6 +249,12 @@ private:
   //! Maps each shape to its replacement.
   //! If a shape is not bound to the map then the shape is replaced by itself.
   TShapeToReplacement myShapeToReplacement;
+  //! The lowest level (the greatest type) among the recorded shapes.
+  TopAbs_ShapeEnum myLowestRecordedType;
+  //! Maps each explored shape to the flag telling whether it has recorded sub-shapes.
+  NCollection_DataMap<TopoDS_Shape, Standard_Boolean, TopTools_ShapeMapHasher> myHasRecordedSubShapes;
+  //! The mode of considering locations the map above has been filled with.
+  Standard_Boolean myIsCachedConsiderLocation;
 
 protected:
   TopTools_MapOfShape myNewShapes;
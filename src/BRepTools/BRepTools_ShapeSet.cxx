@@ -45,6 +45,9 @@
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 
+#include <locale>
+#include <string>
+
 #ifdef MacOS
 #define strcasecmp(p,q) strcmp(p,q)
 #elseif _WIN32
@@ -70,6 +73,136 @@
 //               (It means a parameter for triangulation).
 
 
+namespace
+{
+  //! Buffer accumulating the text of triangulations and polygons before writing it into the stream.
+  //! The numbers are formatted by Sprintf() with the precision of the stream, which gives the same text
+  //! as formatted output of the stream with classic locale and default flags, but avoids its overhead per value.
+  //! If the stream uses other formatting or is unbuffered (std::ios::unitbuf),
+  //! the values are passed to the stream as is.
+  class BRepTools_TextBuffer
+  {
+  public:
+
+    //! Maximum size of the buffered text.
+    static const size_t THE_BUFFER_SIZE = 1024 * 1024;
+
+    BRepTools_TextBuffer (Standard_OStream& theStream)
+    : myStream (theStream),
+      myPrecision (int (theStream.precision())),
+      myIsPlain (isPlainStream (theStream))
+    {
+      if (myIsPlain)
+      {
+        myBuffer.reserve (THE_BUFFER_SIZE + 256);
+      }
+    }
+
+    ~BRepTools_TextBuffer() { Flush(); }
+
+    //! Appends the string.
+    BRepTools_TextBuffer& operator<< (const char* theString)
+    {
+      if (!myIsPlain)
+      {
+        myStream << theString;
+        return *this;
+      }
+      myBuffer += theString;
+      return flushIfFull();
+    }
+
+    //! Appends the integer value.
+    BRepTools_TextBuffer& operator<< (const Standard_Integer theValue)
+    {
+      if (!myIsPlain)
+      {
+        myStream << theValue;
+        return *this;
+      }
+      char aDigits[16];
+      int aNbDigits = 0;
+      uint64_t aValue = theValue < 0 ? uint64_t (-int64_t (theValue)) : uint64_t (theValue);
+      do
+      {
+        aDigits[aNbDigits++] = char ('0' + aValue % 10);
+        aValue /= 10;
+      }
+      while (aValue != 0);
+      if (theValue < 0)
+      {
+        myBuffer += '-';
+      }
+      while (aNbDigits > 0)
+      {
+        myBuffer += aDigits[--aNbDigits];
+      }
+      return flushIfFull();
+    }
+
+    //! Appends the real value.
+    BRepTools_TextBuffer& operator<< (const Standard_Real theValue)
+    {
+      if (!myIsPlain)
+      {
+        myStream << theValue;
+        return *this;
+      }
+      char aString[64];
+      const int aLength = Sprintf (aString, "%.*g", myPrecision, theValue);
+      myBuffer.append (aString, size_t (aLength));
+      return flushIfFull();
+    }
+
+    //! Writes the buffered text into the stream.
+    void Flush()
+    {
+      if (!myBuffer.empty())
+      {
+        myStream.write (myBuffer.data(), std::streamsize (myBuffer.size()));
+        myBuffer.clear();
+      }
+    }
+
+  private:
+
+    //! Returns TRUE if the stream formats numbers in the same way as Sprintf() with "%d" and "%.*g"
+    //! and does not request flushing after each output operation.
+    static Standard_Boolean isPlainStream (const Standard_OStream& theStream)
+    {
+      const std::ios::fmtflags aFlags = theStream.flags();
+      if ((aFlags & (std::ios::floatfield | std::ios::showpos | std::ios::showpoint | std::ios::uppercase
+                   | std::ios::hex | std::ios::oct | std::ios::unitbuf)) != 0
+       || theStream.width() != 0
+       || theStream.precision() > 32)
+      {
+        return Standard_False;
+      }
+      const std::numpunct<char>& aPunct = std::use_facet<std::numpunct<char> > (theStream.getloc());
+      return aPunct.decimal_point() == '.'
+          && aPunct.grouping().empty();
+    }
+
+    BRepTools_TextBuffer& flushIfFull()
+    {
+      if (myBuffer.size() >= THE_BUFFER_SIZE)
+      {
+        Flush();
+      }
+      return *this;
+    }
+
+    BRepTools_TextBuffer& operator= (const BRepTools_TextBuffer& );
+
+  private:
+    Standard_OStream& myStream;
+    std::string       myBuffer;
+    int               myPrecision;
+    Standard_Boolean  myIsPlain;
+  };
+}
+
+
 //=======================================================================
 //function : BRepTools_ShapeSet
 //purpose  :
@@ -1183,32 +1316,40 @@ void BRepTools_ShapeSet::WritePolygonOnTriangulation(Standard_OStream&      OS,
 
   Handle(Poly_PolygonOnTriangulation) Poly;
   Handle(TColStd_HArray1OfReal) Param;
+  BRepTools_TextBuffer aBuffer (OS);
   for (i=1; i<=nbpOntri && aPS.More(); i++, aPS.Next()) {
     Poly = Handle(Poly_PolygonOnTriangulation)::DownCast(myNodes(i));
     const TColStd_Array1OfInteger& Nodes = Poly->Nodes();
-    if (!Compact) {
-      OS << "  "<< i << " : PolygonOnTriangulation with " << Nodes.Length() << " Nodes\n";
+    if (Compact) {
+      aBuffer << Nodes.Length() << " ";
+      for (j=1; j <= Nodes.Length(); j++) aBuffer << Nodes.Value(j) << " ";
+      aBuffer << "\n";
+      aBuffer << "p " << Poly->Deflection() << " ";
+      Param = Poly->Parameters();
+      if (!Param.IsNull()) {
+        aBuffer << "1 ";
+        for (j=1; j <= Param->Length(); j++) aBuffer << Param->Value(j) << " ";
+        aBuffer << "\n";
+      }
+      else aBuffer << "0 \n";
+      continue;
     }
-    else OS << Nodes.Length()<<" ";
-    if (!Compact) OS <<"  ";
+
+    OS << "  "<< i << " : PolygonOnTriangulation with " << Nodes.Length() << " Nodes\n";
+    OS <<"  ";
     for (j=1; j <= Nodes.Length(); j++) OS << Nodes.Value(j) << " ";
     OS << "\n";
 
-    // writing parameters:
-    Param = Poly->Parameters();
-    if (Compact) OS <<"p ";
-
     // write the deflection
-    if (!Compact) OS << "  Deflection : ";
+    OS << "  Deflection : ";
     OS <<Poly->Deflection() << " ";
-    if (!Compact) OS << "\n";
-    
+    OS << "\n";
+
+    // writing parameters:
+    Param = Poly->Parameters();
     if (!Param.IsNull()) {
-      if (!Compact) {
-        OS << "  Parameters :";
-      }
-      else OS << "1 " ;
-      if (!Compact) OS <<"  ";
+      OS << "  Parameters :";
+      OS <<"  ";
       for (j=1; j <= Param->Length(); j++) OS << Param->Value(j) << " ";
       OS << "\n";
     }
@@ -1249,7 +1390,7 @@ void BRepTools_ShapeSet::ReadPolygonOnTriangulation(Standard_IStream& IS,
     IS >> nbnodes;
     TColStd_Array1OfInteger Nodes(1, nbnodes);
     for (j = 1; j <= nbnodes; j++) {
-      IS >> val;
+      GeomTools::GetInteger(IS, val);
       Nodes(j) = val;
     }
     IS >> buffer;
@@ -1425,101 +1566,116 @@ void BRepTools_ShapeSet::WriteTriangulation(Standard_OStream&      OS,
   }
 
   Handle(Poly_Triangulation) T;
+  BRepTools_TextBuffer aBuffer (OS);
   for (i = 1; i <= nbtri && aPS.More(); i++, aPS.Next()) {
 
     T = myTriangulations.FindKey(i);
     const Standard_Boolean toWriteNormals = myTriangulations(i);
     if (Compact) {
-      OS << T->NbNodes() << " " << T->NbTriangles() << " ";
-      OS << ((T->HasUVNodes()) ? "1" : "0") << " ";
+      // the text is formatted in memory, the result is the same as for the stream below
+      aBuffer << T->NbNodes() << " " << T->NbTriangles() << " ";
+      aBuffer << ((T->HasUVNodes()) ? "1" : "0") << " ";
       if (FormatNb() >= TopTools_FormatVersion_VERSION_3)
       {
-        OS << ((T->HasNormals() && toWriteNormals) ? "1" : "0") << " ";
+        aBuffer << ((T->HasNormals() && toWriteNormals) ? "1" : "0") << " ";
       }
-    }
-    else {
-      OS << "  "<< i << " : Triangulation with " << T->NbNodes() << " Nodes and "
-         << T->NbTriangles() <<" Triangles\n";
-      OS << "      "<<((T->HasUVNodes()) ? "with" : "without") << " UV nodes\n";
-      if (FormatNb() >= TopTools_FormatVersion_VERSION_3)
+      aBuffer << T->Deflection() << "\n";
+
+      nbNodes = T->NbNodes();
+      for (j = 1; j <= nbNodes; j++)
       {
-        OS << "      " << ((T->HasNormals() && toWriteNormals) ? "with" : "without") << " normals\n";
+        const gp_Pnt aNode = T->Node (j);
+        aBuffer << aNode.X() << " " << aNode.Y() << " " << aNode.Z() << " ";
       }
+      if (T->HasUVNodes())
+      {
+        for (j = 1; j <= nbNodes; j++)
+        {
+          const gp_Pnt2d aNode2d = T->UVNode (j);
+          aBuffer << aNode2d.X() << " " << aNode2d.Y() << " ";
+        }
+      }
+      nbTriangles = T->NbTriangles();
+      for (j = 1; j <= nbTriangles; j++)
+      {
+        T->Triangle (j).Get (n1, n2, n3);
+        aBuffer << n1 << " " << n2 << " " << n3 << " ";
+      }
+      if (FormatNb() >= TopTools_FormatVersion_VERSION_3
+       && T->HasNormals() && toWriteNormals)
+      {
+        gp_Vec3f aNorm;
+        for (j = 1; j <= nbNodes; j++)
+        {
+          T->Normal (j, aNorm);
+          aBuffer << aNorm.x() << " " << aNorm.y() << " " << aNorm.z() << " ";
+        }
+      }
+      aBuffer << "\n";
+      continue;
     }
-    
+
+    OS << "  "<< i << " : Triangulation with " << T->NbNodes() << " Nodes and "
+       << T->NbTriangles() <<" Triangles\n";
+    OS << "      "<<((T->HasUVNodes()) ? "with" : "without") << " UV nodes\n";
+    if (FormatNb() >= TopTools_FormatVersion_VERSION_3)
+    {
+      OS << "      " << ((T->HasNormals() && toWriteNormals) ? "with" : "without") << " normals\n";
+    }
+
     // write the deflection
-    
-    if (!Compact) OS << "  Deflection : ";
+    OS << "  Deflection : ";
     OS <<T->Deflection() << "\n";
-    
+
     // write the 3d nodes
-    
-    if (!Compact) OS << "\n3D Nodes :\n";
-    
+    OS << "\n3D Nodes :\n";
     nbNodes = T->NbNodes();
     for (j = 1; j <= nbNodes; j++)
     {
       const gp_Pnt aNode = T->Node (j);
-      if (!Compact) OS << std::setw(10) << j << " : ";
-      if (!Compact) OS << std::setw(17);
-      OS << aNode.X() << " ";
-      if (!Compact) OS << std::setw(17);
-      OS << aNode.Y() << " ";
-      if (!Compact) OS << std::setw(17);
-      OS << aNode.Z();
-      if (!Compact) OS << "\n";
-      else OS << " ";
+      OS << std::setw(10) << j << " : ";
+      OS << std::setw(17) << aNode.X() << " ";
+      OS << std::setw(17) << aNode.Y() << " ";
+      OS << std::setw(17) << aNode.Z() << "\n";
     }
-    
+
     if (T->HasUVNodes())
     {
-      if (!Compact) OS << "\nUV Nodes :\n";
+      OS << "\nUV Nodes :\n";
       for (j = 1; j <= nbNodes; j++)
       {
         const gp_Pnt2d aNode2d = T->UVNode (j);
-        if (!Compact) OS << std::setw(10) << j << " : ";
-        if (!Compact) OS << std::setw(17);
-        OS << aNode2d.X() << " ";
-        if (!Compact) OS << std::setw(17);
-        OS << aNode2d.Y();
-        if (!Compact) OS << "\n";
-        else OS << " ";
+        OS << std::setw(10) << j << " : ";
+        OS << std::setw(17) << aNode2d.X() << " ";
+        OS << std::setw(17) << aNode2d.Y() << "\n";
       }
     }
-    
-    if (!Compact) OS << "\nTriangles :\n";
+
+    OS << "\nTriangles :\n";
     nbTriangles = T->NbTriangles();
     for (j = 1; j <= nbTriangles; j++) {
-      if (!Compact) OS << std::setw(10) << j << " : ";
+      OS << std::setw(10) << j << " : ";
       T->Triangle (j).Get (n1, n2, n3);
-      if (!Compact) OS << std::setw(10);
-      OS << n1 << " ";
-      if (!Compact) OS << std::setw(10);
-      OS << n2 << " ";
-      if (!Compact) OS << std::setw(10);
-      OS << n3;
-      if (!Compact) OS << "\n";
-      else OS << " ";
+      OS << std::setw(10) << n1 << " ";
+      OS << std::setw(10) << n2 << " ";
+      OS << std::setw(10) << n3 << "\n";
     }
 
     if (FormatNb() >= TopTools_FormatVersion_VERSION_3)
     {
       if (T->HasNormals() && toWriteNormals)
       {
-        if (!Compact) OS << "\nNormals :\n";
+        OS << "\nNormals :\n";
         for (j = 1; j <= nbNodes; j++)
         {
-          if (!Compact)
-          {
-            OS << std::setw(10) << j << " : ";
-            OS << std::setw(17);
-          }
+          OS << std::setw(10) << j << " : ";
+          OS << std::setw(17);
           gp_Vec3f aNorm;
           for (Standard_Integer k = 0; k < 3; ++k)
           {
             T->Normal (j, aNorm);
             OS << aNorm[k];
-            OS << (!Compact ? "\n" : " ");
+            OS << "\n";
           }
         }
       }
@@ -1590,7 +1746,9 @@ void BRepTools_ShapeSet::ReadTriangulation(Standard_IStream& IS, const Message_P
     // read the triangles
     Standard_Integer n1,n2,n3;
     for (j = 1; j <= nbTriangles; j++) {
-      IS >> n1 >> n2 >> n3;
+      GeomTools::GetInteger(IS, n1);
+      GeomTools::GetInteger(IS, n2);
+      GeomTools::GetInteger(IS, n3);
       T->SetTriangle (j, Poly_Triangle (n1, n2, n3));
     }
 
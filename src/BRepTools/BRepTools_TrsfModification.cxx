@@ -479,3 +479,14 @@ GeomAbs_Shape BRepTools_TrsfModification::Continuity
 }
 
 
+//=======================================================================
+//function : IsThreadSafe
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean BRepTools_TrsfModification::IsThreadSafe() const
+{
+  return Standard_True;
+}
+
+
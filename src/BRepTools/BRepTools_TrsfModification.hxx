@@ -124,6 +124,10 @@ public:
   //! (resp. <F2>).
   Standard_EXPORT GeomAbs_Shape Continuity (const TopoDS_Edge& E, const TopoDS_Face& F1, const TopoDS_Face& F2, const TopoDS_Edge& NewE, const TopoDS_Face& NewF1, const TopoDS_Face& NewF2) Standard_OVERRIDE;
 
+  //! Returns true as the transformation of the geometry
+  //! does not change the state of the modification.
+  Standard_EXPORT Standard_Boolean IsThreadSafe() const Standard_OVERRIDE;
+
 
 
 
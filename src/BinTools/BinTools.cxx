@@ -16,6 +16,7 @@
 
 #include <BinTools.hxx>
 #include <BinTools_ShapeSet.hxx>
+#include <FSD_BinaryFile.hxx>
 #include <FSD_FileHeader.hxx>
 #include <OSD_FileSystem.hxx>
 #include <Storage_StreamTypeMismatchError.hxx>
@@ -94,6 +95,21 @@ Standard_OStream& BinTools::PutExtChar(Standard_OStream& OS, const Standard_ExtC
   return OS;
 }
 
+//=======================================================================
+//function : PutUInt64
+//purpose  :
+//=======================================================================
+Standard_OStream& BinTools::PutUInt64 (Standard_OStream& theOS, const uint64_t theValue)
+{
+#ifdef DO_INVERSE
+  const uint64_t aValue = FSD_BinaryFile::InverseUint64 (theValue);
+  theOS.write ((char*)&aValue, sizeof(uint64_t));
+#else
+  theOS.write ((char*)&theValue, sizeof(uint64_t));
+#endif
+  return theOS;
+}
+
 //=======================================================================
 //function : GetReal
 //purpose  :
@@ -158,6 +174,22 @@ Standard_IStream& BinTools::GetExtChar(Standard_IStream& IS, Standard_ExtCharact
   return IS;
 }
 
+//=======================================================================
+//function : GetUInt64
+//purpose  :
+//=======================================================================
+Standard_IStream& BinTools::GetUInt64 (Standard_IStream& theIS, uint64_t& theValue)
+{
+  if (!theIS.read ((char*)&theValue, sizeof(uint64_t)))
+  {
+    throw Storage_StreamTypeMismatchError();
+  }
+#ifdef DO_INVERSE
+  theValue = FSD_BinaryFile::InverseUint64 (theValue);
+#endif
+  return theIS;
+}
+
 //=======================================================================
 //function : GetBool
 //purpose  : 
@@ -179,11 +211,31 @@ void BinTools::Write (const TopoDS_Shape& theShape,
                       const Standard_Boolean theWithNormals,
                       const BinTools_FormatVersion theVersion,
                       const Message_ProgressRange& theRange)
+{
+  Write (theShape, theStream, theWithTriangles, theWithNormals, theVersion, 0.0, Standard_False, Standard_False, theRange);
+}
+
+//=======================================================================
+//function : Write
+//purpose  :
+//=======================================================================
+void BinTools::Write (const TopoDS_Shape& theShape,
+                      Standard_OStream& theStream,
+                      const Standard_Boolean theWithTriangles,
+                      const Standard_Boolean theWithNormals,
+                      const BinTools_FormatVersion theVersion,
+                      const Standard_Real theNodesPrecision,
+                      const Standard_Boolean theToCompress,
+                      const Standard_Boolean theToRunParallel,
+                      const Message_ProgressRange& theRange)
 {
   BinTools_ShapeSet aShapeSet;
   aShapeSet.SetWithTriangles(theWithTriangles);
   aShapeSet.SetWithNormals(theWithNormals);
   aShapeSet.SetFormatNb (theVersion);
+  aShapeSet.SetRunParallel (theToRunParallel);
+  aShapeSet.SetNodesPrecision (theNodesPrecision);
+  aShapeSet.SetCompressTables (theToCompress);
   aShapeSet.Add (theShape);
   aShapeSet.Write (theStream, theRange);
   aShapeSet.Write (theShape, theStream);
@@ -196,9 +248,22 @@ void BinTools::Write (const TopoDS_Shape& theShape,
 
 void BinTools::Read (TopoDS_Shape& theShape, Standard_IStream& theStream,
                      const Message_ProgressRange& theRange)
+{
+  Read (theShape, theStream, Standard_False, theRange);
+}
+
+//=======================================================================
+//function : Read
+//purpose  : 
+//=======================================================================
+
+void BinTools::Read (TopoDS_Shape& theShape, Standard_IStream& theStream,
+                     const Standard_Boolean theToRunParallel,
+                     const Message_ProgressRange& theRange)
 {
   BinTools_ShapeSet aShapeSet;
   aShapeSet.SetWithTriangles(Standard_True);
+  aShapeSet.SetRunParallel (theToRunParallel);
   aShapeSet.Read (theStream, theRange);
   aShapeSet.ReadSubs (theShape, theStream, aShapeSet.NbShapes());
 }
@@ -213,6 +278,23 @@ Standard_Boolean BinTools::Write (const TopoDS_Shape& theShape,
                                   const Standard_Boolean theWithNormals,
                                   const BinTools_FormatVersion theVersion,
                                   const Message_ProgressRange& theRange)
+{
+  return Write (theShape, theFile, theWithTriangles, theWithNormals, theVersion, 0.0, Standard_False, Standard_False, theRange);
+}
+
+//=======================================================================
+//function : Write
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools::Write (const TopoDS_Shape& theShape,
+                                  const Standard_CString theFile,
+                                  const Standard_Boolean theWithTriangles,
+                                  const Standard_Boolean theWithNormals,
+                                  const BinTools_FormatVersion theVersion,
+                                  const Standard_Real theNodesPrecision,
+                                  const Standard_Boolean theToCompress,
+                                  const Standard_Boolean theToRunParallel,
+                                  const Message_ProgressRange& theRange)
 {
   const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
   std::shared_ptr<std::ostream> aStream = aFileSystem->OpenOStream (theFile, std::ios::out | std::ios::binary);
@@ -220,7 +302,8 @@ Standard_Boolean BinTools::Write (const TopoDS_Shape& theShape,
   if (aStream.get() == NULL || !aStream->good())
     return Standard_False;
 
-  Write (theShape, *aStream, theWithTriangles, theWithNormals, theVersion, theRange);
+  Write (theShape, *aStream, theWithTriangles, theWithNormals, theVersion, theNodesPrecision, theToCompress,
+         theToRunParallel, theRange);
   aStream->flush();
   return aStream->good();
 }
@@ -232,6 +315,18 @@ Standard_Boolean BinTools::Write (const TopoDS_Shape& theShape,
 
 Standard_Boolean BinTools::Read (TopoDS_Shape& theShape, const Standard_CString theFile,
                                  const Message_ProgressRange& theRange)
+{
+  return Read (theShape, theFile, Standard_False, Standard_False, theRange);
+}
+
+//=======================================================================
+//function : Read
+//purpose  : 
+//=======================================================================
+Standard_Boolean BinTools::Read (TopoDS_Shape& theShape, const Standard_CString theFile,
+                                 const Standard_Boolean theToDeferTriangulation,
+                                 const Standard_Boolean theToRunParallel,
+                                 const Message_ProgressRange& theRange)
 {
   const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
   std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream (theFile, std::ios::in | std::ios::binary);
@@ -240,6 +335,14 @@ Standard_Boolean BinTools::Read (TopoDS_Shape& theShape, const Standard_CString
     return Standard_False;
   }
 
-  Read (theShape, *aStream, theRange);
+  BinTools_ShapeSet aShapeSet;
+  aShapeSet.SetWithTriangles(Standard_True);
+  aShapeSet.SetRunParallel (theToRunParallel);
+  if (theToDeferTriangulation)
+  {
+    aShapeSet.SetDeferredFile (theFile);
+  }
+  aShapeSet.Read (*aStream, theRange);
+  aShapeSet.ReadSubs (theShape, *aStream, aShapeSet.NbShapes());
   return aStream->good();
 }
@@ -44,6 +44,8 @@ public:
   
   Standard_EXPORT static Standard_OStream& PutExtChar (Standard_OStream& OS, const Standard_ExtCharacter theValue);
 
+  Standard_EXPORT static Standard_OStream& PutUInt64 (Standard_OStream& OS, const uint64_t theValue);
+
   Standard_EXPORT static Standard_IStream& GetReal (Standard_IStream& IS, Standard_Real& theValue);
 
   Standard_EXPORT static Standard_IStream& GetShortReal (Standard_IStream& IS, Standard_ShortReal& theValue);
@@ -54,6 +56,8 @@ public:
   
   Standard_EXPORT static Standard_IStream& GetExtChar (Standard_IStream& IS, Standard_ExtCharacter& theValue);
 
+  Standard_EXPORT static Standard_IStream& GetUInt64 (Standard_IStream& IS, uint64_t& theValue);
+
   //! Writes the shape to the stream in binary format BinTools_FormatVersion_CURRENT.
   //! This alias writes shape with triangulation data.
   //! @param theShape [in]       the shape to write
@@ -82,8 +86,40 @@ public:
                                     const BinTools_FormatVersion theVersion,
                                     const Message_ProgressRange& theRange = Message_ProgressRange());
 
+  //! Writes the shape to the stream in binary format of specified version with compact encoding options.
+  //! @param theShape [in]         the shape to write
+  //! @param theStream [in][out]   the stream to output shape into
+  //! @param theWithTriangles [in] flag which specifies whether to save shape with (TRUE) or without (FALSE) triangles
+  //! @param theWithNormals [in]   flag which specifies whether to save triangulation with (TRUE) or without (FALSE) normals
+  //! @param theVersion [in]       the BinTools format version
+  //! @param theNodesPrecision [in] precision of quantization of triangulation nodes, zero for lossless storage;
+  //!                               has effect for version BinTools_FormatVersion_VERSION_6 and later only
+  //! @param theToCompress [in]    flag to compress the tables of geometry and triangulations;
+  //!                              has effect for version BinTools_FormatVersion_VERSION_6 and later only
+  //! @param theToRunParallel [in] flag to encode the tables of geometry and triangulations in parallel;
+  //!                              has effect for version BinTools_FormatVersion_VERSION_5 and later only
+  //! @param theRange              the range of progress indicator to fill in
+  Standard_EXPORT static void Write (const TopoDS_Shape& theShape, Standard_OStream& theStream,
+                                     const Standard_Boolean theWithTriangles,
+                                     const Standard_Boolean theWithNormals,
+                                     const BinTools_FormatVersion theVersion,
+                                     const Standard_Real theNodesPrecision,
+                                     const Standard_Boolean theToCompress,
+                                     const Standard_Boolean theToRunParallel = Standard_False,
+                                     const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Reads a shape from <theStream> and returns it in <theShape>.
+  Standard_EXPORT static void Read (TopoDS_Shape& theShape, Standard_IStream& theStream,
+                                    const Message_ProgressRange& theRange = Message_ProgressRange());
+
   //! Reads a shape from <theStream> and returns it in <theShape>.
+  //! @param theShape [out]        the read shape
+  //! @param theStream [in]        the stream to read
+  //! @param theToRunParallel [in] flag to decode the tables of geometry and triangulations in parallel;
+  //!                              has effect for version BinTools_FormatVersion_VERSION_5 and later only
+  //! @param theRange [in]         the range of progress indicator to fill in
   Standard_EXPORT static void Read (TopoDS_Shape& theShape, Standard_IStream& theStream,
+                                    const Standard_Boolean theToRunParallel,
                                     const Message_ProgressRange& theRange = Message_ProgressRange());
 
   //! Writes the shape to the file in binary format BinTools_FormatVersion_CURRENT.
@@ -114,9 +150,44 @@ public:
                                                  const BinTools_FormatVersion theVersion,
                                                  const Message_ProgressRange& theRange = Message_ProgressRange());
 
+  //! Writes the shape to the file in binary format of specified version with compact encoding options.
+  //! @param theShape [in]          the shape to write
+  //! @param theFile [in]           the path to file to output shape into
+  //! @param theWithTriangles [in]  flag which specifies whether to save shape with (TRUE) or without (FALSE) triangles
+  //! @param theWithNormals [in]    flag which specifies whether to save triangulation with (TRUE) or without (FALSE) normals
+  //! @param theVersion [in]        the BinTools format version
+  //! @param theNodesPrecision [in] precision of quantization of triangulation nodes, zero for lossless storage
+  //! @param theToCompress [in]     flag to compress the tables of geometry and triangulations
+  //! @param theToRunParallel [in]  flag to encode the tables of geometry and triangulations in parallel
+  //! @param theRange               the range of progress indicator to fill in
+  Standard_EXPORT static Standard_Boolean Write (const TopoDS_Shape& theShape,
+                                                 const Standard_CString theFile,
+                                                 const Standard_Boolean theWithTriangles,
+                                                 const Standard_Boolean theWithNormals,
+                                                 const BinTools_FormatVersion theVersion,
+                                                 const Standard_Real theNodesPrecision,
+                                                 const Standard_Boolean theToCompress,
+                                                 const Standard_Boolean theToRunParallel = Standard_False,
+                                                 const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Reads a shape from <theFile> and returns it in <theShape>.
+  Standard_EXPORT static Standard_Boolean Read
+    (TopoDS_Shape& theShape, const Standard_CString theFile,
+     const Message_ProgressRange& theRange = Message_ProgressRange());
+
   //! Reads a shape from <theFile> and returns it in <theShape>.
+  //! @param theShape [out] the read shape
+  //! @param theFile  [in] the path to the file to read
+  //! @param theToDeferTriangulation [in] if TRUE, the data of triangulations is not read;
+  //!                                     faces get BinTools_TriangulationSource objects instead,
+  //!                                     which can be loaded later by BRepTools::LoadTriangulation()
+  //!                                     or BRepTools::LoadAllTriangulations()
+  //! @param theToRunParallel [in] flag to decode the tables of geometry and triangulations in parallel
+  //! @param theRange [in] the range of progress indicator to fill in
   Standard_EXPORT static Standard_Boolean Read
     (TopoDS_Shape& theShape, const Standard_CString theFile,
+     const Standard_Boolean theToDeferTriangulation,
+     const Standard_Boolean theToRunParallel = Standard_False,
      const Message_ProgressRange& theRange = Message_ProgressRange());
 
 };
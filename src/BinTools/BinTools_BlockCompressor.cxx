@@ -0,0 +1,221 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools_BlockCompressor.hxx>
+
+#include <string.h>
+
+namespace
+{
+  //! Minimal length of the match.
+  static const size_t THE_MIN_MATCH = 4;
+
+  //! Number of bytes at the end of block which are always written as literals.
+  static const size_t THE_LAST_LITERALS = 5;
+
+  //! Minimal distance from the last match start to the end of the block.
+  static const size_t THE_MATCH_LIMIT = 12;
+
+  //! Maximal offset of the match.
+  static const size_t THE_MAX_OFFSET = 65535;
+
+  //! Number of bits in hash of 4 bytes sequence.
+  static const unsigned int THE_HASH_BITS = 16;
+
+  //! Reads 4 bytes from the memory.
+  static uint32_t read32 (const char* theData)
+  {
+    uint32_t aValue = 0;
+    memcpy (&aValue, theData, sizeof(uint32_t));
+    return aValue;
+  }
+
+  //! Returns hash of 4 bytes sequence.
+  static uint32_t hash32 (const uint32_t theValue)
+  {
+    return (theValue * 2654435761U) >> (32 - THE_HASH_BITS);
+  }
+
+  //! Writes the length exceeding 15 as a sequence of bytes.
+  static void putLength (size_t theLength, std::vector<char>& theResult)
+  {
+    for (; theLength >= 255; theLength -= 255)
+    {
+      theResult.push_back (char (255));
+    }
+    theResult.push_back (char (theLength));
+  }
+
+  //! Reads the length exceeding 15.
+  static Standard_Boolean getLength (const unsigned char* theData, const size_t theSize,
+                                     size_t& thePos, size_t& theLength)
+  {
+    for (;;)
+    {
+      if (thePos >= theSize)
+      {
+        return Standard_False;
+      }
+      const unsigned char aByte = theData[thePos++];
+      theLength += aByte;
+      if (aByte != 255)
+      {
+        return Standard_True;
+      }
+    }
+  }
+
+  //! Writes the sequence of literals followed by the match (if theMatchLength is not zero).
+  static void putSequence (const char* theLiterals, const size_t theNbLiterals,
+                           const size_t theOffset, const size_t theMatchLength,
+                           std::vector<char>& theResult)
+  {
+    const size_t aTokenPos = theResult.size();
+    theResult.push_back (0);
+    unsigned char aToken = (unsigned char)((theNbLiterals < 15 ? theNbLiterals : 15) << 4);
+    if (theNbLiterals >= 15)
+    {
+      putLength (theNbLiterals - 15, theResult);
+    }
+    theResult.insert (theResult.end(), theLiterals, theLiterals + theNbLiterals);
+    if (theMatchLength != 0)
+    {
+      theResult.push_back (char (theOffset & 0xFF));
+      theResult.push_back (char ((theOffset >> 8) & 0xFF));
+      const size_t aLength = theMatchLength - THE_MIN_MATCH;
+      aToken |= (unsigned char)(aLength < 15 ? aLength : 15);
+      if (aLength >= 15)
+      {
+        putLength (aLength - 15, theResult);
+      }
+    }
+    theResult[aTokenPos] = char (aToken);
+  }
+}
+
+//=======================================================================
+//function : Compress
+//purpose  :
+//=======================================================================
+void BinTools_BlockCompressor::Compress (const char* theData,
+                                         const size_t theSize,
+                                         std::vector<char>& theResult)
+{
+  theResult.reserve (theResult.size() + theSize + theSize / 255 + 16);
+  size_t anAnchor = 0;
+  if (theSize > THE_MATCH_LIMIT)
+  {
+    std::vector<uint32_t> aTable (size_t (1) << THE_HASH_BITS, 0);
+    const size_t aMatchStartLimit = theSize - THE_MATCH_LIMIT;
+    const size_t aMatchEndLimit   = theSize - THE_LAST_LITERALS;
+    for (size_t aPos = 1; aPos < aMatchStartLimit; )
+    {
+      const uint32_t aSequence = read32 (theData + aPos);
+      uint32_t& aTableValue = aTable[hash32 (aSequence)];
+      const size_t aRef = aTableValue;
+      aTableValue = uint32_t (aPos);
+      if (aRef >= aPos
+       || aPos - aRef > THE_MAX_OFFSET
+       || read32 (theData + aRef) != aSequence)
+      {
+        ++aPos;
+        continue;
+      }
+
+      size_t aLength = THE_MIN_MATCH;
+      while (aPos + aLength < aMatchEndLimit
+          && theData[aRef + aLength] == theData[aPos + aLength])
+      {
+        ++aLength;
+      }
+      putSequence (theData + anAnchor, aPos - anAnchor, aPos - aRef, aLength, theResult);
+      aPos += aLength;
+      anAnchor = aPos;
+    }
+  }
+  putSequence (theData + anAnchor, theSize - anAnchor, 0, 0, theResult);
+}
+
+//=======================================================================
+//function : Decompress
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_BlockCompressor::Decompress (const char* theData,
+                                                       const size_t theSize,
+                                                       char* theResult,
+                                                       const size_t theRawSize)
+{
+  const unsigned char* aData = (const unsigned char* )theData;
+  size_t aPos = 0;
+  size_t aResPos = 0;
+  while (aPos < theSize)
+  {
+    const unsigned char aToken = aData[aPos++];
+    size_t aNbLiterals = aToken >> 4;
+    if (aNbLiterals == 15
+    && !getLength (aData, theSize, aPos, aNbLiterals))
+    {
+      return Standard_False;
+    }
+    if (aNbLiterals > theSize - aPos
+     || aNbLiterals > theRawSize - aResPos)
+    {
+      return Standard_False;
+    }
+    memcpy (theResult + aResPos, theData + aPos, aNbLiterals);
+    aPos    += aNbLiterals;
+    aResPos += aNbLiterals;
+    if (aPos == theSize)
+    {
+      // the last sequence contains only literals
+      break;
+    }
+
+    if (theSize - aPos < 2)
+    {
+      return Standard_False;
+    }
+    const size_t anOffset = size_t (aData[aPos]) | (size_t (aData[aPos + 1]) << 8);
+    aPos += 2;
+    size_t aLength = aToken & 0x0F;
+    if (aLength == 15
+    && !getLength (aData, theSize, aPos, aLength))
+    {
+      return Standard_False;
+    }
+    aLength += THE_MIN_MATCH;
+    if (anOffset == 0
+     || anOffset > aResPos
+     || aLength > theRawSize - aResPos)
+    {
+      return Standard_False;
+    }
+
+    const char* aRef = theResult + aResPos - anOffset;
+    char* aDest = theResult + aResPos;
+    if (anOffset >= aLength)
+    {
+      memcpy (aDest, aRef, aLength);
+    }
+    else
+    {
+      // overlapping copy repeating the last anOffset bytes
+      for (size_t anIter = 0; anIter < aLength; ++anIter)
+      {
+        aDest[anIter] = aRef[anIter];
+      }
+    }
+    aResPos += aLength;
+  }
+  return aResPos == theRawSize;
+}
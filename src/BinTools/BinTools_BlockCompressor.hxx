@@ -0,0 +1,54 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_BlockCompressor_HeaderFile
+#define _BinTools_BlockCompressor_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+
+#include <vector>
+
+//! Simple LZ77-family compressor of memory blocks used by binary BRep format.
+//! The compressed block is a sequence of tokens, each consisting of
+//! a run of literal bytes followed by a back-reference (16-bit offset and length)
+//! into the already decompressed data (the layout is compatible with LZ4 block format).
+//! The compressor uses a single-entry hash table and favors speed of decompression over ratio.
+class BinTools_BlockCompressor
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Compresses the block of data and appends the result to the output buffer.
+  //! @param theData   [in]  the data to compress
+  //! @param theSize   [in]  the size of the data
+  //! @param theResult [out] the buffer to append compressed data to
+  Standard_EXPORT static void Compress (const char* theData,
+                                        const size_t theSize,
+                                        std::vector<char>& theResult);
+
+  //! Decompresses the block of data.
+  //! @param theData    [in]  the compressed data
+  //! @param theSize    [in]  the size of the compressed data
+  //! @param theResult  [out] the buffer to decompress into, should have theRawSize bytes
+  //! @param theRawSize [in]  the size of decompressed data
+  //! @return FALSE if compressed data is corrupted
+  Standard_EXPORT static Standard_Boolean Decompress (const char* theData,
+                                                      const size_t theSize,
+                                                      char* theResult,
+                                                      const size_t theRawSize);
+
+};
+
+#endif // _BinTools_BlockCompressor_HeaderFile
@@ -51,6 +51,9 @@ public:
   
   //! Returns the Curve of index <I>.
   Standard_EXPORT Handle(Geom2d_Curve) Curve2d (const Standard_Integer I) const;
+
+  //! Returns the number of 2D curves in the set.
+  Standard_Integer NbCurves2d() const { return myMap.Extent(); }
   
   //! Returns the index of <L>.
   Standard_EXPORT Standard_Integer Index (const Handle(Geom2d_Curve)& C) const;
@@ -26,13 +26,18 @@ enum BinTools_FormatVersion
   BinTools_FormatVersion_VERSION_4 = 4, //!< Stores per-vertex normal information in case
                                         //!  of triangulation-only Faces, because
                                         //!  no analytical geometry to restore normals
+  BinTools_FormatVersion_VERSION_5 = 5, //!< Stores offsets of entries of the tables of geometry, polygons
+                                        //!  and triangulations to allow their parallel writing and reading
+  BinTools_FormatVersion_VERSION_6 = 6, //!< Compact encoding of triangulations and polygons on triangulations
+                                        //!  (variable-length indices, optional quantization of nodes and normals)
+                                        //!  and optional compression of the tables
   BinTools_FormatVersion_CURRENT = BinTools_FormatVersion_VERSION_4 //!< Current version
 };
 
 enum
 {
   BinTools_FormatVersion_LOWER   = BinTools_FormatVersion_VERSION_1,
-  BinTools_FormatVersion_UPPER   = BinTools_FormatVersion_VERSION_4
+  BinTools_FormatVersion_UPPER   = BinTools_FormatVersion_VERSION_6
 };
 
 #endif
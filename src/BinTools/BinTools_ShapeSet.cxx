@@ -15,9 +15,11 @@
 
 
 #include <BinTools.hxx>
+#include <BinTools_BlockCompressor.hxx>
 #include <BinTools_Curve2dSet.hxx>
 #include <BinTools_ShapeSet.hxx>
 #include <BinTools_SurfaceSet.hxx>
+#include <BinTools_TriangulationSource.hxx>
 #include <BRep_CurveOnClosedSurface.hxx>
 #include <BRep_CurveOnSurface.hxx>
 #include <BRep_CurveRepresentation.hxx>
@@ -34,10 +36,19 @@
 #include <BRep_Tool.hxx>
 #include <BRep_TVertex.hxx>
 #include <BRepTools.hxx>
+#include <Geom2d_Curve.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <Poly_Polygon3D.hxx>
 #include <Poly_PolygonOnTriangulation.hxx>
 #include <Poly_Triangulation.hxx>
+#include <Standard_ArrayStreamBuffer.hxx>
 #include <Standard_ErrorHandler.hxx>
+#include <Storage_StreamTypeMismatchError.hxx>
+#include <TCollection_AsciiString.hxx>
 #include <TColStd_HArray1OfInteger.hxx>
 #include <TColStd_HArray1OfReal.hxx>
 #include <TopoDS.hxx>
@@ -47,13 +58,1220 @@
 #include <Message_ProgressRange.hxx>
 
 #include <string.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+  //! Maximum number of table entries encoded at once while writing
+  //! the tables of format BinTools_FormatVersion_VERSION_5.
+  static const Standard_Integer THE_WRITE_BATCH_SIZE = 4096;
+
+  //! Maximum size of table data decoded at once while reading
+  //! the tables of format BinTools_FormatVersion_VERSION_5.
+  static const uint64_t THE_READ_CHUNK_SIZE = 64 * 1024 * 1024;
+
+  //! Maximum size of uncompressed data of the compressed block
+  //! (unless the block consists of a single larger entry).
+  static const size_t THE_COMPRESSED_BLOCK_SIZE = 4 * 1024 * 1024;
+
+  //! Writes the offset of a table entry.
+  static void putOffset (Standard_OStream& theStream, const uint64_t theOffset)
+  {
+    BinTools::PutUInt64 (theStream, theOffset);
+  }
+
+  //! Reads the offset of a table entry.
+  static void getOffset (Standard_IStream& theStream, uint64_t& theOffset)
+  {
+    BinTools::GetUInt64 (theStream, theOffset);
+  }
+
+  //! Writes the 3D polygon.
+  static void writePolygon3D (Standard_OStream& OS, const Handle(Poly_Polygon3D)& thePoly)
+  {
+    BinTools::PutInteger(OS, thePoly->NbNodes());
+    BinTools::PutBool(OS, thePoly->HasParameters());
+
+    // write the deflection
+    BinTools::PutReal(OS, thePoly->Deflection());
+
+    // write the nodes
+    const Standard_Integer  aNbNodes = thePoly->NbNodes();
+    const TColgp_Array1OfPnt& aNodes = thePoly->Nodes();
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      const gp_Pnt& aPnt = aNodes.Value (aNodeIter);
+      BinTools::PutReal(OS, aPnt.X());
+      BinTools::PutReal(OS, aPnt.Y());
+      BinTools::PutReal(OS, aPnt.Z());
+    }
+    if (thePoly->HasParameters())
+    {
+      const TColStd_Array1OfReal& aParam = thePoly->Parameters();
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        BinTools::PutReal(OS, aParam.Value (aNodeIter));
+      }
+    }
+  }
+
+  //! Reads the 3D polygon.
+  static void readPolygon3D (Standard_IStream& IS, Handle(Poly_Polygon3D)& thePoly)
+  {
+    Standard_Integer aNbNodes = 0;
+    Standard_Boolean hasParameters = Standard_False;
+    Standard_Real aDefl = 0.0;
+    BinTools::GetInteger(IS, aNbNodes);
+    BinTools::GetBool(IS, hasParameters);
+    BinTools::GetReal(IS, aDefl);
+
+    thePoly = new Poly_Polygon3D (aNbNodes, hasParameters);
+    thePoly->Deflection (aDefl);
+
+    TColgp_Array1OfPnt& aNodes = thePoly->ChangeNodes();
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      gp_XYZ& aPnt = aNodes.ChangeValue (aNodeIter).ChangeCoord();
+      BinTools::GetReal(IS, aPnt.ChangeCoord (1));
+      BinTools::GetReal(IS, aPnt.ChangeCoord (2));
+      BinTools::GetReal(IS, aPnt.ChangeCoord (3));
+    }
+    if (hasParameters)
+    {
+      TColStd_Array1OfReal& aParam = thePoly->ChangeParameters();
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        BinTools::GetReal(IS, aParam.ChangeValue (aNodeIter));
+      }
+    }
+  }
+
+  //! Writes the polygon on triangulation.
+  static void writePolygonOnTriangulation (Standard_OStream& OS, const Handle(Poly_PolygonOnTriangulation)& thePoly)
+  {
+    const TColStd_Array1OfInteger& aNodes = thePoly->Nodes();
+    BinTools::PutInteger(OS, aNodes.Length());
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNodes.Length(); ++aNodeIter)
+    {
+      BinTools::PutInteger(OS, aNodes.Value (aNodeIter));
+    }
+
+    // write the deflection
+    BinTools::PutReal(OS, thePoly->Deflection());
+
+    // writing parameters
+    if (const Handle(TColStd_HArray1OfReal)& aParam = thePoly->Parameters())
+    {
+      BinTools::PutBool(OS, Standard_True);
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aParam->Length(); ++aNodeIter)
+      {
+        BinTools::PutReal(OS, aParam->Value (aNodeIter));
+      }
+    }
+    else
+    {
+      BinTools::PutBool(OS, Standard_False);
+    }
+  }
+
+  //! Reads the polygon on triangulation.
+  static void readPolygonOnTriangulation (Standard_IStream& IS, Handle(Poly_PolygonOnTriangulation)& thePoly)
+  {
+    Standard_Integer aNbNodes = 0;
+    BinTools::GetInteger(IS, aNbNodes);
+    thePoly = new Poly_PolygonOnTriangulation (aNbNodes, Standard_False);
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      Standard_Integer aNode = 0;
+      BinTools::GetInteger (IS, aNode);
+      thePoly->SetNode (aNodeIter, aNode);
+    }
+
+    Standard_Real aDefl = 0.0;
+    BinTools::GetReal(IS, aDefl);
+    thePoly->Deflection (aDefl);
+
+    Standard_Boolean hasParameters = Standard_False;
+    BinTools::GetBool(IS, hasParameters);
+    if (hasParameters)
+    {
+      Handle(TColStd_HArray1OfReal) aParams = new TColStd_HArray1OfReal (1, aNbNodes);
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        BinTools::GetReal(IS, aParams->ChangeValue (aNodeIter));
+      }
+      thePoly->SetParameters (aParams);
+    }
+  }
+
+  //! Writes the triangulation.
+  //! @param theNeedToWriteNormals [in] flag to write normals of the triangulation
+  //! @param theHasNormalsFlag     [in] flag to write presence of normals (format version 4 and later)
+  static void writeTriangulation (Standard_OStream& OS,
+                                  const Handle(Poly_Triangulation)& theTriangulation,
+                                  const Standard_Boolean theNeedToWriteNormals,
+                                  const Standard_Boolean theHasNormalsFlag)
+  {
+    const Handle(Poly_Triangulation) aTriangulation = BinTools_ShapeSetBase::TriangulationToWrite (theTriangulation);
+    const Standard_Boolean toWriteNormals = theHasNormalsFlag && theNeedToWriteNormals && aTriangulation->HasNormals();
+    const Standard_Integer aNbNodes     = aTriangulation->NbNodes();
+    const Standard_Integer aNbTriangles = aTriangulation->NbTriangles();
+    BinTools::PutInteger(OS, aNbNodes);
+    BinTools::PutInteger(OS, aNbTriangles);
+    BinTools::PutBool(OS, aTriangulation->HasUVNodes() ? 1 : 0);
+    if (theHasNormalsFlag)
+    {
+      BinTools::PutBool(OS, toWriteNormals ? 1 : 0);
+    }
+    BinTools::PutReal(OS, aTriangulation->Deflection());
+
+    // write the 3d nodes
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      const gp_Pnt aPnt = aTriangulation->Node (aNodeIter);
+      BinTools::PutReal(OS, aPnt.X());
+      BinTools::PutReal(OS, aPnt.Y());
+      BinTools::PutReal(OS, aPnt.Z());
+    }
+
+    if (aTriangulation->HasUVNodes())
+    {
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        const gp_Pnt2d aUV = aTriangulation->UVNode (aNodeIter);
+        BinTools::PutReal(OS, aUV.X());
+        BinTools::PutReal(OS, aUV.Y());
+      }
+    }
+
+    for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+    {
+      const Poly_Triangle aTri = aTriangulation->Triangle (aTriIter);
+      BinTools::PutInteger(OS, aTri.Value (1));
+      BinTools::PutInteger(OS, aTri.Value (2));
+      BinTools::PutInteger(OS, aTri.Value (3));
+    }
+
+    // write the normals
+    if (toWriteNormals)
+    {
+      gp_Vec3f aNormal;
+      for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+      {
+        aTriangulation->Normal (aNormalIter, aNormal);
+        BinTools::PutShortReal (OS, aNormal.x());
+        BinTools::PutShortReal (OS, aNormal.y());
+        BinTools::PutShortReal (OS, aNormal.z());
+      }
+    }
+  }
+
+  //! Reads the triangulation.
+  //! @param theHasNormalsFlag [in] flag indicating that presence of normals is stored (format version 4 and later)
+  static void readTriangulation (Standard_IStream& IS,
+                                 Handle(Poly_Triangulation)& theTriangulation,
+                                 const Standard_Boolean theHasNormalsFlag)
+  {
+    Standard_Integer aNbNodes = 0, aNbTriangles = 0;
+    Standard_Boolean hasUV = Standard_False;
+    Standard_Boolean hasNormals = Standard_False;
+    Standard_Real aDefl = 0.0;
+    BinTools::GetInteger(IS, aNbNodes);
+    BinTools::GetInteger(IS, aNbTriangles);
+    BinTools::GetBool(IS, hasUV);
+    if (theHasNormalsFlag)
+    {
+      BinTools::GetBool(IS, hasNormals);
+    }
+    BinTools::GetReal(IS, aDefl); //deflection
+    theTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, hasUV, hasNormals);
+    theTriangulation->Deflection (aDefl);
+
+    gp_Pnt aNode;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (1));
+      BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (2));
+      BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (3));
+      theTriangulation->SetNode (aNodeIter, aNode);
+    }
+
+    if (hasUV)
+    {
+      gp_Pnt2d aNode2d;
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (1));
+        BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (2));
+        theTriangulation->SetUVNode (aNodeIter, aNode2d);
+      }
+    }
+
+    // read the triangles
+    Standard_Integer aTriNodes[3] = {};
+    for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+    {
+      BinTools::GetInteger(IS, aTriNodes[0]);
+      BinTools::GetInteger(IS, aTriNodes[1]);
+      BinTools::GetInteger(IS, aTriNodes[2]);
+      theTriangulation->SetTriangle (aTriIter, Poly_Triangle (aTriNodes[0], aTriNodes[1], aTriNodes[2]));
+    }
+
+    if (hasNormals)
+    {
+      gp_Vec3f aNormal;
+      for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+      {
+        BinTools::GetShortReal(IS, aNormal.x());
+        BinTools::GetShortReal(IS, aNormal.y());
+        BinTools::GetShortReal(IS, aNormal.z());
+        theTriangulation->SetNormal (aNormalIter, aNormal);
+      }
+    }
+  }
+
+  //! Writes the unsigned integer as a sequence of 7-bit groups (variable-length encoding).
+  static void putVarInt (Standard_OStream& theStream, uint64_t theValue)
+  {
+    char aBuffer[10];
+    int aSize = 0;
+    for (; theValue >= 0x80; theValue >>= 7)
+    {
+      aBuffer[aSize++] = char ((theValue & 0x7F) | 0x80);
+    }
+    aBuffer[aSize++] = char (theValue);
+    theStream.write (aBuffer, aSize);
+  }
+
+  //! Reads the unsigned integer written by putVarInt().
+  static uint64_t getVarInt (Standard_IStream& theStream)
+  {
+    uint64_t aValue = 0;
+    for (int aShift = 0; aShift < 64; aShift += 7)
+    {
+      const int aByte = theStream.get();
+      if (aByte == std::char_traits<char>::eof())
+      {
+        break;
+      }
+      aValue |= uint64_t (aByte & 0x7F) << aShift;
+      if ((aByte & 0x80) == 0)
+      {
+        return aValue;
+      }
+    }
+    throw Storage_StreamTypeMismatchError();
+  }
+
+  //! Writes the signed integer in variable-length encoding,
+  //! mapping values of small magnitude to small unsigned values (zigzag encoding).
+  static void putSignedVarInt (Standard_OStream& theStream, const int64_t theValue)
+  {
+    putVarInt (theStream, (uint64_t (theValue) << 1) ^ uint64_t (theValue >> 63));
+  }
+
+  //! Reads the signed integer written by putSignedVarInt().
+  static int64_t getSignedVarInt (Standard_IStream& theStream)
+  {
+    const uint64_t aValue = getVarInt (theStream);
+    return int64_t (aValue >> 1) ^ -int64_t (aValue & 1);
+  }
+
+  //! Reads the non-negative integer written by putVarInt() and checks its range.
+  static Standard_Integer getCount (Standard_IStream& theStream)
+  {
+    const uint64_t aValue = getVarInt (theStream);
+    if (aValue > uint64_t (IntegerLast()))
+    {
+      throw Storage_StreamTypeMismatchError();
+    }
+    return Standard_Integer (aValue);
+  }
+
+  //! Writes the component of normal quantized to 16-bit integer
+  //! (in the same byte order as the other 16-bit values of the file).
+  static void putNormalComponent (Standard_OStream& theStream, const Standard_ShortReal theValue)
+  {
+    const Standard_ShortReal aValue = Max (-1.0f, Min (1.0f, theValue));
+    const int16_t aQuantized = int16_t (floor (aValue * 32767.0f + 0.5f));
+    BinTools::PutExtChar (theStream, Standard_ExtCharacter (uint16_t (aQuantized)));
+  }
+
+  //! Reads the component of normal written by putNormalComponent().
+  static Standard_ShortReal getNormalComponent (Standard_IStream& theStream)
+  {
+    Standard_ExtCharacter aValue = 0;
+    BinTools::GetExtChar (theStream, aValue);
+    const int16_t aQuantized = int16_t (uint16_t (aValue));
+    return Standard_ShortReal (aQuantized) / 32767.0f;
+  }
+
+  //! Flags of the triangulation in compact encoding.
+  enum
+  {
+    THE_COMPACT_HAS_UV      = 0x01, //!< triangulation has UV nodes
+    THE_COMPACT_HAS_NORMALS = 0x02, //!< triangulation has normals
+    THE_COMPACT_QUANTIZED   = 0x04  //!< nodes and normals are quantized
+  };
+
+  //! Writes the polygon on triangulation in compact encoding (format version 6 and later):
+  //! indices of nodes are written as differences of consecutive indices in variable-length encoding.
+  static void writePolygonOnTriangulationCompact (Standard_OStream& OS, const Handle(Poly_PolygonOnTriangulation)& thePoly)
+  {
+    const TColStd_Array1OfInteger& aNodes = thePoly->Nodes();
+    putVarInt (OS, uint64_t (aNodes.Length()));
+    Standard_Integer aPrevNode = 0;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNodes.Length(); ++aNodeIter)
+    {
+      putSignedVarInt (OS, int64_t (aNodes.Value (aNodeIter)) - aPrevNode);
+      aPrevNode = aNodes.Value (aNodeIter);
+    }
+
+    BinTools::PutReal(OS, thePoly->Deflection());
+    if (const Handle(TColStd_HArray1OfReal)& aParam = thePoly->Parameters())
+    {
+      BinTools::PutBool(OS, Standard_True);
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aParam->Length(); ++aNodeIter)
+      {
+        BinTools::PutReal(OS, aParam->Value (aNodeIter));
+      }
+    }
+    else
+    {
+      BinTools::PutBool(OS, Standard_False);
+    }
+  }
+
+  //! Reads the polygon on triangulation in compact encoding.
+  static void readPolygonOnTriangulationCompact (Standard_IStream& IS, Handle(Poly_PolygonOnTriangulation)& thePoly)
+  {
+    const Standard_Integer aNbNodes = getCount (IS);
+    thePoly = new Poly_PolygonOnTriangulation (aNbNodes, Standard_False);
+    int64_t aNode = 0;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      aNode += getSignedVarInt (IS);
+      thePoly->SetNode (aNodeIter, Standard_Integer (aNode));
+    }
+
+    Standard_Real aDefl = 0.0;
+    BinTools::GetReal(IS, aDefl);
+    thePoly->Deflection (aDefl);
+
+    Standard_Boolean hasParameters = Standard_False;
+    BinTools::GetBool(IS, hasParameters);
+    if (hasParameters)
+    {
+      Handle(TColStd_HArray1OfReal) aParams = new TColStd_HArray1OfReal (1, aNbNodes);
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        BinTools::GetReal(IS, aParams->ChangeValue (aNodeIter));
+      }
+      thePoly->SetParameters (aParams);
+    }
+  }
+
+  //! Writes the triangulation in compact encoding (format version 6 and later):
+  //! - numbers of nodes and triangles and indices of triangle nodes are written in variable-length encoding,
+  //!   the indices are written as differences to the first node of the current and previous triangles;
+  //! - when thePrecision is positive, nodes are written as differences of integer coordinates
+  //!   on the grid with step 2 * thePrecision and normals are quantized to 16-bit integers.
+  //! @param theNeedToWriteNormals [in] flag to write normals of the triangulation
+  //! @param thePrecision          [in] precision of quantization of nodes, zero for lossless encoding
+  static void writeTriangulationCompact (Standard_OStream& OS,
+                                         const Handle(Poly_Triangulation)& theTriangulation,
+                                         const Standard_Boolean theNeedToWriteNormals,
+                                         const Standard_Real thePrecision)
+  {
+    const Handle(Poly_Triangulation) aTriangulation = BinTools_ShapeSetBase::TriangulationToWrite (theTriangulation);
+    const Standard_Integer aNbNodes     = aTriangulation->NbNodes();
+    const Standard_Integer aNbTriangles = aTriangulation->NbTriangles();
+    const Standard_Boolean toWriteNormals = theNeedToWriteNormals && aTriangulation->HasNormals();
+
+    // quantize the nodes only if the number of grid steps fits into the range of exactly represented integers
+    const Standard_Real aStep = 2.0 * thePrecision;
+    gp_XYZ aMin (RealLast(), RealLast(), RealLast());
+    gp_XYZ aMax (RealFirst(), RealFirst(), RealFirst());
+    Standard_Boolean isQuantized = aStep > 0.0 && aNbNodes > 0;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes && isQuantized; ++aNodeIter)
+    {
+      const gp_XYZ aNode = aTriangulation->Node (aNodeIter).XYZ();
+      aMin.SetCoord (Min (aMin.X(), aNode.X()), Min (aMin.Y(), aNode.Y()), Min (aMin.Z(), aNode.Z()));
+      aMax.SetCoord (Max (aMax.X(), aNode.X()), Max (aMax.Y(), aNode.Y()), Max (aMax.Z(), aNode.Z()));
+    }
+    if (isQuantized)
+    {
+      const gp_XYZ aRange = aMax - aMin;
+      isQuantized = Max (aRange.X(), Max (aRange.Y(), aRange.Z())) / aStep < 1.0e15;
+    }
+
+    putVarInt (OS, uint64_t (aNbNodes));
+    putVarInt (OS, uint64_t (aNbTriangles));
+    const char aFlags = char ((aTriangulation->HasUVNodes() ? THE_COMPACT_HAS_UV : 0)
+                            | (toWriteNormals ? THE_COMPACT_HAS_NORMALS : 0)
+                            | (isQuantized ? THE_COMPACT_QUANTIZED : 0));
+    OS.put (aFlags);
+    BinTools::PutReal(OS, aTriangulation->Deflection());
+
+    // write the 3d nodes
+    if (isQuantized)
+    {
+      BinTools::PutReal(OS, aStep);
+      BinTools::PutReal(OS, aMin.X());
+      BinTools::PutReal(OS, aMin.Y());
+      BinTools::PutReal(OS, aMin.Z());
+      int64_t aPrev[3] = {};
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        const gp_XYZ aNode = aTriangulation->Node (aNodeIter).XYZ();
+        for (Standard_Integer aCoordIter = 0; aCoordIter < 3; ++aCoordIter)
+        {
+          const int64_t aValue = int64_t (floor ((aNode.Coord (aCoordIter + 1) - aMin.Coord (aCoordIter + 1)) / aStep + 0.5));
+          putSignedVarInt (OS, aValue - aPrev[aCoordIter]);
+          aPrev[aCoordIter] = aValue;
+        }
+      }
+    }
+    else
+    {
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        const gp_Pnt aPnt = aTriangulation->Node (aNodeIter);
+        BinTools::PutReal(OS, aPnt.X());
+        BinTools::PutReal(OS, aPnt.Y());
+        BinTools::PutReal(OS, aPnt.Z());
+      }
+    }
+
+    if (aTriangulation->HasUVNodes())
+    {
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        const gp_Pnt2d aUV = aTriangulation->UVNode (aNodeIter);
+        BinTools::PutReal(OS, aUV.X());
+        BinTools::PutReal(OS, aUV.Y());
+      }
+    }
+
+    // neighboring triangles share nodes, so that the differences of indices are small
+    Standard_Integer aPrevNode = 0;
+    for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+    {
+      const Poly_Triangle aTri = aTriangulation->Triangle (aTriIter);
+      putSignedVarInt (OS, int64_t (aTri.Value (1)) - aPrevNode);
+      putSignedVarInt (OS, int64_t (aTri.Value (2)) - aTri.Value (1));
+      putSignedVarInt (OS, int64_t (aTri.Value (3)) - aTri.Value (1));
+      aPrevNode = aTri.Value (1);
+    }
+
+    // write the normals
+    if (toWriteNormals)
+    {
+      gp_Vec3f aNormal;
+      for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+      {
+        aTriangulation->Normal (aNormalIter, aNormal);
+        if (isQuantized)
+        {
+          putNormalComponent (OS, aNormal.x());
+          putNormalComponent (OS, aNormal.y());
+          putNormalComponent (OS, aNormal.z());
+        }
+        else
+        {
+          BinTools::PutShortReal (OS, aNormal.x());
+          BinTools::PutShortReal (OS, aNormal.y());
+          BinTools::PutShortReal (OS, aNormal.z());
+        }
+      }
+    }
+  }
+
+  //! Reads the triangulation in compact encoding.
+  static void readTriangulationCompact (Standard_IStream& IS,
+                                        Handle(Poly_Triangulation)& theTriangulation)
+  {
+    const Standard_Integer aNbNodes     = getCount (IS);
+    const Standard_Integer aNbTriangles = getCount (IS);
+    const int aFlags = IS.get();
+    if (aFlags == std::char_traits<char>::eof())
+    {
+      throw Storage_StreamTypeMismatchError();
+    }
+    const Standard_Boolean hasUV       = (aFlags & THE_COMPACT_HAS_UV) != 0;
+    const Standard_Boolean hasNormals  = (aFlags & THE_COMPACT_HAS_NORMALS) != 0;
+    const Standard_Boolean isQuantized = (aFlags & THE_COMPACT_QUANTIZED) != 0;
+    Standard_Real aDefl = 0.0;
+    BinTools::GetReal(IS, aDefl);
+    theTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, hasUV, hasNormals);
+    theTriangulation->Deflection (aDefl);
+
+    if (isQuantized)
+    {
+      Standard_Real aStep = 0.0;
+      gp_XYZ aMin;
+      BinTools::GetReal(IS, aStep);
+      BinTools::GetReal(IS, aMin.ChangeCoord (1));
+      BinTools::GetReal(IS, aMin.ChangeCoord (2));
+      BinTools::GetReal(IS, aMin.ChangeCoord (3));
+      int64_t aValue[3] = {};
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        aValue[0] += getSignedVarInt (IS);
+        aValue[1] += getSignedVarInt (IS);
+        aValue[2] += getSignedVarInt (IS);
+        theTriangulation->SetNode (aNodeIter, gp_Pnt (aMin.X() + Standard_Real (aValue[0]) * aStep,
+                                                      aMin.Y() + Standard_Real (aValue[1]) * aStep,
+                                                      aMin.Z() + Standard_Real (aValue[2]) * aStep));
+      }
+    }
+    else
+    {
+      gp_Pnt aNode;
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (1));
+        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (2));
+        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (3));
+        theTriangulation->SetNode (aNodeIter, aNode);
+      }
+    }
+
+    if (hasUV)
+    {
+      gp_Pnt2d aNode2d;
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (1));
+        BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (2));
+        theTriangulation->SetUVNode (aNodeIter, aNode2d);
+      }
+    }
+
+    // read the triangles
+    int64_t aPrevNode = 0;
+    for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+    {
+      const int64_t aNode1 = aPrevNode + getSignedVarInt (IS);
+      const int64_t aNode2 = aNode1 + getSignedVarInt (IS);
+      const int64_t aNode3 = aNode1 + getSignedVarInt (IS);
+      theTriangulation->SetTriangle (aTriIter, Poly_Triangle (Standard_Integer (aNode1),
+                                                              Standard_Integer (aNode2),
+                                                              Standard_Integer (aNode3)));
+      aPrevNode = aNode1;
+    }
+
+    if (hasNormals)
+    {
+      gp_Vec3f aNormal;
+      for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+      {
+        if (isQuantized)
+        {
+          aNormal.x() = getNormalComponent (IS);
+          aNormal.y() = getNormalComponent (IS);
+          aNormal.z() = getNormalComponent (IS);
+        }
+        else
+        {
+          BinTools::GetShortReal(IS, aNormal.x());
+          BinTools::GetShortReal(IS, aNormal.y());
+          BinTools::GetShortReal(IS, aNormal.z());
+        }
+        theTriangulation->SetNormal (aNormalIter, aNormal);
+      }
+    }
+  }
+
+  //! Writes the 2D curve.
+  static void writeCurve2d (Standard_OStream& OS, const Handle(Geom2d_Curve)& theCurve)
+  {
+    BinTools_OStream aStream (OS);
+    BinTools_Curve2dSet::WriteCurve2d (theCurve, aStream);
+  }
+
+  //! Reads the 2D curve.
+  static void readCurve2d (Standard_IStream& IS, Handle(Geom2d_Curve)& theCurve)
+  {
+    BinTools_Curve2dSet::ReadCurve2d (IS, theCurve);
+  }
+
+  //! Writes the 3D curve.
+  static void writeCurve (Standard_OStream& OS, const Handle(Geom_Curve)& theCurve)
+  {
+    BinTools_OStream aStream (OS);
+    BinTools_CurveSet::WriteCurve (theCurve, aStream);
+  }
+
+  //! Reads the 3D curve.
+  static void readCurve (Standard_IStream& IS, Handle(Geom_Curve)& theCurve)
+  {
+    BinTools_CurveSet::ReadCurve (IS, theCurve);
+  }
+
+  //! Writes the surface.
+  static void writeSurface (Standard_OStream& OS, const Handle(Geom_Surface)& theSurface)
+  {
+    BinTools_OStream aStream (OS);
+    BinTools_SurfaceSet::WriteSurface (theSurface, aStream);
+  }
+
+  //! Reads the surface.
+  static void readSurface (Standard_IStream& IS, Handle(Geom_Surface)& theSurface)
+  {
+    BinTools_SurfaceSet::ReadSurface (IS, theSurface);
+  }
+
+  //! Interface for writing and reading of independent entries of the table
+  //! in format BinTools_FormatVersion_VERSION_5.
+  //! Both methods can be called concurrently for different entries.
+  class BinTools_TableCodec
+  {
+  public:
+    virtual ~BinTools_TableCodec() {}
+
+    //! Writes the entry with the given index into the stream.
+    virtual void Write (const Standard_Integer theIndex, Standard_OStream& theStream) const = 0;
+
+    //! Reads the entry with the given index from the stream.
+    virtual void Read (const Standard_Integer theIndex, Standard_IStream& theStream) const = 0;
+  };
+
+  //! Table codec for the array of entries using the functions writing and reading single entry.
+  //! The entries are indexed from 1, the index 0 is not used and allows defining arrays for empty tables.
+  template<class TheEntryType>
+  class BinTools_ArrayCodec : public BinTools_TableCodec
+  {
+  public:
+    typedef void (*WriteFunction) (Standard_OStream& , const TheEntryType& );
+    typedef void (*ReadFunction)  (Standard_IStream& , TheEntryType& );
+
+    BinTools_ArrayCodec (NCollection_Array1<TheEntryType>& theEntries,
+                         WriteFunction theWriteFunc,
+                         ReadFunction theReadFunc)
+    : myEntries (theEntries),
+      myWriteFunc (theWriteFunc),
+      myReadFunc (theReadFunc)
+    {}
+
+    virtual void Write (const Standard_Integer theIndex, Standard_OStream& theStream) const Standard_OVERRIDE
+    {
+      myWriteFunc (theStream, myEntries.Value (theIndex));
+    }
+
+    virtual void Read (const Standard_Integer theIndex, Standard_IStream& theStream) const Standard_OVERRIDE
+    {
+      myReadFunc (theStream, myEntries.ChangeValue (theIndex));
+    }
+
+  private:
+    BinTools_ArrayCodec& operator= (const BinTools_ArrayCodec& );
+
+  private:
+    NCollection_Array1<TheEntryType>& myEntries;
+    WriteFunction myWriteFunc;
+    ReadFunction  myReadFunc;
+  };
+
+  //! Parameters of writing and reading of the tables.
+  struct BinTools_TableParams
+  {
+    Standard_Boolean IsParallel;     //!< flag to encode and decode the entries in parallel
+    Standard_Boolean IsCompact;      //!< compact encoding of format BinTools_FormatVersion_VERSION_6
+    Standard_Boolean ToCompress;     //!< flag to compress the table data (compact encoding only)
+    Standard_Real    NodesPrecision; //!< precision of quantization of triangulation nodes (compact encoding only)
+  };
+
+  //! Returns parameters of the tables for the shape set.
+  static BinTools_TableParams tableParams (const BinTools_ShapeSet& theSet)
+  {
+    BinTools_TableParams aParams;
+    aParams.IsParallel     = theSet.IsRunParallel();
+    aParams.IsCompact      = theSet.FormatNb() >= BinTools_FormatVersion_VERSION_6;
+    aParams.ToCompress     = aParams.IsCompact && theSet.ToCompressTables();
+    aParams.NodesPrecision = aParams.IsCompact ? theSet.NodesPrecision() : 0.0;
+    return aParams;
+  }
+
+  //! Table codec for triangulations, which are written with normals on demand.
+  class BinTools_TriangulationCodec : public BinTools_TableCodec
+  {
+  public:
+    BinTools_TriangulationCodec (NCollection_Array1<Handle(Poly_Triangulation)>& theTriangulations,
+                                 NCollection_Array1<Standard_Boolean>& theNeedNormals,
+                                 const BinTools_TableParams& theParams)
+    : myTriangulations (theTriangulations),
+      myNeedNormals (theNeedNormals),
+      myParams (theParams)
+    {}
+
+    virtual void Write (const Standard_Integer theIndex, Standard_OStream& theStream) const Standard_OVERRIDE
+    {
+      if (myParams.IsCompact)
+      {
+        writeTriangulationCompact (theStream, myTriangulations.Value (theIndex), myNeedNormals.Value (theIndex), myParams.NodesPrecision);
+        return;
+      }
+      writeTriangulation (theStream, myTriangulations.Value (theIndex), myNeedNormals.Value (theIndex), Standard_True);
+    }
+
+    virtual void Read (const Standard_Integer theIndex, Standard_IStream& theStream) const Standard_OVERRIDE
+    {
+      Handle(Poly_Triangulation)& aTriangulation = myTriangulations.ChangeValue (theIndex);
+      if (myParams.IsCompact)
+      {
+        readTriangulationCompact (theStream, aTriangulation);
+      }
+      else
+      {
+        readTriangulation (theStream, aTriangulation, Standard_True);
+      }
+      myNeedNormals.ChangeValue (theIndex) = aTriangulation->HasNormals();
+    }
+
+  private:
+    BinTools_TriangulationCodec& operator= (const BinTools_TriangulationCodec& );
+
+  private:
+    NCollection_Array1<Handle(Poly_Triangulation)>& myTriangulations;
+    NCollection_Array1<Standard_Boolean>& myNeedNormals;
+    const BinTools_TableParams& myParams;
+  };
+
+  //! Functor writing the entries of the table into separate buffers.
+  class BinTools_TableWriteFunctor
+  {
+  public:
+    BinTools_TableWriteFunctor (const BinTools_TableCodec& theCodec,
+                                const Standard_Integer theFirst,
+                                NCollection_Array1<std::string>& theBuffers)
+    : myCodec (theCodec),
+      myFirst (theFirst),
+      myBuffers (theBuffers)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      Standard_SStream aStream;
+      myCodec.Write (myFirst + theIndex, aStream);
+      myBuffers.ChangeValue (theIndex) = aStream.str();
+    }
+
+  private:
+    BinTools_TableWriteFunctor& operator= (const BinTools_TableWriteFunctor& );
+
+  private:
+    const BinTools_TableCodec&       myCodec;
+    const Standard_Integer           myFirst;
+    NCollection_Array1<std::string>& myBuffers;
+  };
+
+  //! Functor reading the entries of the table from the memory buffer.
+  class BinTools_TableReadFunctor
+  {
+  public:
+    BinTools_TableReadFunctor (const BinTools_TableCodec& theCodec,
+                               const Standard_Integer theFirst,
+                               const NCollection_Array1<uint64_t>& theOffsets,
+                               const char* theData)
+    : myCodec (theCodec),
+      myFirst (theFirst),
+      myOffsets (theOffsets),
+      myData (theData)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const Standard_Integer anEntry = myFirst + theIndex;
+      const uint64_t aBegin = myOffsets (anEntry - 1) - myOffsets (myFirst - 1);
+      const uint64_t aSize  = myOffsets (anEntry) - myOffsets (anEntry - 1);
+      Standard_ArrayStreamBuffer aBuffer (myData + aBegin, size_t (aSize));
+      std::istream aStream (&aBuffer);
+      myCodec.Read (anEntry, aStream);
+    }
+
+  private:
+    BinTools_TableReadFunctor& operator= (const BinTools_TableReadFunctor& );
+
+  private:
+    const BinTools_TableCodec&          myCodec;
+    const Standard_Integer              myFirst;
+    const NCollection_Array1<uint64_t>& myOffsets;
+    const char*                         myData;
+  };
+
+  //! Functor compressing the blocks of entries of the table.
+  class BinTools_BlockCompressFunctor
+  {
+  public:
+    BinTools_BlockCompressFunctor (const NCollection_Array1<std::string>& theBuffers,
+                                   const NCollection_Vector<Standard_Integer>& theBlocks,
+                                   NCollection_Array1<std::vector<char> >& theResults)
+    : myBuffers (theBuffers),
+      myBlocks (theBlocks),
+      myResults (theResults)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      std::string aData;
+      for (Standard_Integer anIter = myBlocks.Value (theIndex); anIter < myBlocks.Value (theIndex + 1); ++anIter)
+      {
+        aData += myBuffers.Value (anIter);
+      }
+      std::vector<char>& aResult = myResults.ChangeValue (theIndex);
+      aResult.clear();
+      BinTools_BlockCompressor::Compress (aData.data(), aData.size(), aResult);
+    }
+
+  private:
+    BinTools_BlockCompressFunctor& operator= (const BinTools_BlockCompressFunctor& );
+
+  private:
+    const NCollection_Array1<std::string>&      myBuffers;
+    const NCollection_Vector<Standard_Integer>& myBlocks;
+    NCollection_Array1<std::vector<char> >&     myResults;
+  };
+
+  //! Writes the encoded entries of the table.
+  //! When compression is requested, the entries are grouped into blocks of size THE_COMPRESSED_BLOCK_SIZE,
+  //! which are compressed in parallel and written as sizes of uncompressed and compressed data followed by the latter.
+  static void writeTableEntries (Standard_OStream& theStream,
+                                 NCollection_Array1<std::string>& theBuffers,
+                                 const Standard_Integer theNb,
+                                 const BinTools_TableParams& theParams)
+  {
+    if (!theParams.ToCompress)
+    {
+      for (Standard_Integer anIter = 0; anIter < theNb; ++anIter)
+      {
+        std::string& aBuffer = theBuffers.ChangeValue (anIter);
+        theStream.write (aBuffer.data(), std::streamsize (aBuffer.size()));
+        aBuffer.clear();
+      }
+      return;
+    }
+
+    // split the entries into blocks, the block is defined by its first entry
+    NCollection_Vector<Standard_Integer> aBlocks;
+    size_t aBlockSize = 0;
+    for (Standard_Integer anIter = 0; anIter < theNb; ++anIter)
+    {
+      const size_t anEntrySize = theBuffers.Value (anIter).size();
+      if (anIter == 0
+       || aBlockSize + anEntrySize > THE_COMPRESSED_BLOCK_SIZE)
+      {
+        aBlocks.Append (anIter);
+        aBlockSize = 0;
+      }
+      aBlockSize += anEntrySize;
+    }
+    const Standard_Integer aNbBlocks = aBlocks.Length();
+    aBlocks.Append (theNb);
+
+    NCollection_Array1<std::vector<char> > aResults (0, aNbBlocks - 1);
+    OSD_Parallel::For (0, aNbBlocks, BinTools_BlockCompressFunctor (theBuffers, aBlocks, aResults), !theParams.IsParallel);
+    for (Standard_Integer aBlockIter = 0; aBlockIter < aNbBlocks; ++aBlockIter)
+    {
+      uint64_t aRawSize = 0;
+      for (Standard_Integer anIter = aBlocks.Value (aBlockIter); anIter < aBlocks.Value (aBlockIter + 1); ++anIter)
+      {
+        aRawSize += theBuffers.Value (anIter).size();
+        theBuffers.ChangeValue (anIter).clear();
+      }
+      const std::vector<char>& aResult = aResults.Value (aBlockIter);
+      putOffset (theStream, aRawSize);
+      putOffset (theStream, aResult.size());
+      theStream.write (aResult.data(), std::streamsize (aResult.size()));
+    }
+  }
+
+  //! Writes the entries of the table in format BinTools_FormatVersion_VERSION_5:
+  //! offsets of the entries from the beginning of the table data (theNb + 1 values) followed by the entries.
+  //! In format BinTools_FormatVersion_VERSION_6 the offsets of non-empty table are followed by the flag of compression,
+  //! the offsets refer to the uncompressed data in this case.
+  //! The entries are encoded in parallel in batches; the offsets are updated after writing of all entries,
+  //! if the stream allows changing the position, otherwise the whole table is encoded at once.
+  static void writeTable (Standard_OStream& theStream,
+                          const BinTools_TableCodec& theCodec,
+                          const Standard_Integer theNb,
+                          const BinTools_TableParams& theParams,
+                          const Message_ProgressRange& theRange)
+  {
+    NCollection_Array1<uint64_t> anOffsets (0, theNb);
+    anOffsets.Init (0);
+    if (theNb == 0)
+    {
+      putOffset (theStream, 0);
+      return;
+    }
+
+    const std::streampos aTablePos = theStream.tellp();
+    const Standard_Boolean isSeekable = aTablePos != std::streampos (-1);
+    if (isSeekable)
+    {
+      // reserve the place for offsets
+      for (Standard_Integer anIter = 0; anIter <= theNb; ++anIter)
+      {
+        putOffset (theStream, 0);
+      }
+      if (theParams.IsCompact)
+      {
+        theStream.put (theParams.ToCompress ? 1 : 0);
+      }
+    }
+
+    const Standard_Integer aBatchSize = isSeekable ? Min (theNb, THE_WRITE_BATCH_SIZE) : theNb;
+    NCollection_Array1<std::string> aBuffers (0, aBatchSize - 1);
+    Message_ProgressScope aPS (theRange, "Writing table", theNb);
+    for (Standard_Integer aFirst = 1; aFirst <= theNb && aPS.More(); aFirst += aBatchSize)
+    {
+      const Standard_Integer aNbEntries = Min (aBatchSize, theNb - aFirst + 1);
+      OSD_Parallel::For (0, aNbEntries, BinTools_TableWriteFunctor (theCodec, aFirst, aBuffers), !theParams.IsParallel);
+      for (Standard_Integer anIter = 0; anIter < aNbEntries; ++anIter)
+      {
+        anOffsets (aFirst + anIter) = anOffsets (aFirst + anIter - 1) + aBuffers.Value (anIter).size();
+      }
+      if (isSeekable)
+      {
+        writeTableEntries (theStream, aBuffers, aNbEntries, theParams);
+      }
+      aPS.Next (aNbEntries);
+    }
+
+    if (isSeekable)
+    {
+      const std::streampos anEndPos = theStream.tellp();
+      theStream.seekp (aTablePos);
+      for (Standard_Integer anIter = 0; anIter <= theNb; ++anIter)
+      {
+        putOffset (theStream, anOffsets (anIter));
+      }
+      theStream.seekp (anEndPos);
+    }
+    else
+    {
+      for (Standard_Integer anIter = 0; anIter <= theNb; ++anIter)
+      {
+        putOffset (theStream, anOffsets (anIter));
+      }
+      if (theParams.IsCompact)
+      {
+        theStream.put (theParams.ToCompress ? 1 : 0);
+      }
+      writeTableEntries (theStream, aBuffers, theNb, theParams);
+    }
+  }
+
+  //! Reads the entries of the table in format BinTools_FormatVersion_VERSION_5 and later.
+  //! The table data is read by chunks limited by THE_READ_CHUNK_SIZE (or by compressed blocks),
+  //! the entries of each chunk are decoded in parallel.
+  static void readTable (Standard_IStream& theStream,
+                         const BinTools_TableCodec& theCodec,
+                         const Standard_Integer theNb,
+                         const BinTools_TableParams& theParams,
+                         const Message_ProgressRange& theRange)
+  {
+    NCollection_Array1<uint64_t> anOffsets (0, theNb);
+    for (Standard_Integer anIter = 0; anIter <= theNb; ++anIter)
+    {
+      getOffset (theStream, anOffsets (anIter));
+      if (anIter > 0
+       && anOffsets (anIter) < anOffsets (anIter - 1))
+      {
+        throw Standard_Failure ("BinTools_ShapeSet: corrupted table of offsets");
+      }
+    }
+    if (theNb == 0)
+    {
+      return;
+    }
+
+    Standard_Boolean isCompressed = Standard_False;
+    if (theParams.IsCompact)
+    {
+      const int aFlag = theStream.get();
+      if (aFlag == std::char_traits<char>::eof())
+      {
+        throw Storage_StreamTypeMismatchError();
+      }
+      isCompressed = aFlag != 0;
+    }
+
+    std::vector<char> aData;
+    Message_ProgressScope aPS (theRange, "Reading table", theNb);
+    if (isCompressed)
+    {
+      std::vector<char> aPacked;
+      for (Standard_Integer aFirst = 1; aFirst <= theNb && aPS.More(); )
+      {
+        uint64_t aRawSize = 0, aPackedSize = 0;
+        getOffset (theStream, aRawSize);
+        getOffset (theStream, aPackedSize);
+        Standard_Integer aLast = aFirst;
+        while (aLast < theNb
+            && anOffsets (aLast + 1) - anOffsets (aFirst - 1) <= aRawSize)
+        {
+          ++aLast;
+        }
+        if (anOffsets (aLast) - anOffsets (aFirst - 1) != aRawSize
+         || aPackedSize > aRawSize + aRawSize / 255 + 16)
+        {
+          throw Standard_Failure ("BinTools_ShapeSet: corrupted compressed block");
+        }
+
+        aPacked.resize (size_t (aPackedSize) + 1);
+        aData.resize (size_t (aRawSize) + 1);
+        if (!theStream.read (aPacked.data(), std::streamsize (aPackedSize)))
+        {
+          throw Storage_StreamTypeMismatchError();
+        }
+        if (!BinTools_BlockCompressor::Decompress (aPacked.data(), size_t (aPackedSize), aData.data(), size_t (aRawSize)))
+        {
+          throw Standard_Failure ("BinTools_ShapeSet: corrupted compressed block");
+        }
+        OSD_Parallel::For (0, aLast - aFirst + 1,
+                           BinTools_TableReadFunctor (theCodec, aFirst, anOffsets, aData.data()),
+                           !theParams.IsParallel);
+        aPS.Next (aLast - aFirst + 1);
+        aFirst = aLast + 1;
+      }
+      return;
+    }
+
+    for (Standard_Integer aFirst = 1; aFirst <= theNb && aPS.More(); )
+    {
+      Standard_Integer aLast = aFirst;
+      while (aLast < theNb
+          && anOffsets (aLast + 1) - anOffsets (aFirst - 1) <= THE_READ_CHUNK_SIZE)
+      {
+        ++aLast;
+      }
+      const uint64_t aSize = anOffsets (aLast) - anOffsets (aFirst - 1);
+      aData.resize (size_t (aSize) + 1);
+      if (!theStream.read (aData.data(), std::streamsize (aSize)))
+      {
+        throw Storage_StreamTypeMismatchError();
+      }
+      OSD_Parallel::For (0, aLast - aFirst + 1,
+                         BinTools_TableReadFunctor (theCodec, aFirst, anOffsets, aData.data()),
+                         !theParams.IsParallel);
+      aPS.Next (aLast - aFirst + 1);
+      aFirst = aLast + 1;
+    }
+  }
+
+  //! Reads the header of the table and returns the number of its entries.
+  static Standard_Integer readTableHeader (Standard_IStream& IS, const Standard_CString theName)
+  {
+    char aBuffer[255];
+    IS >> aBuffer;
+    if (IS.fail() || strcmp (aBuffer, theName))
+    {
+      throw Standard_Failure ((TCollection_AsciiString ("BinTools_ShapeSet::ReadGeometry: Not a ") + theName + " table").ToCString());
+    }
+    Standard_Integer aNb = 0;
+    IS >> aNb;
+    IS.get(); // remove LF
+    if (IS.fail() || aNb < 0)
+    {
+      throw Standard_Failure ((TCollection_AsciiString ("BinTools_ShapeSet::ReadGeometry: wrong size of ") + theName + " table").ToCString());
+    }
+    return aNb;
+  }
+
+  //! Writes the 2D curves in format BinTools_FormatVersion_VERSION_5.
+  static void writeCurve2dTable (Standard_OStream& OS, const BinTools_Curve2dSet& theSet,
+                                 const BinTools_TableParams& theParams, const Message_ProgressRange& theRange)
+  {
+    const Standard_Integer aNb = theSet.NbCurves2d();
+    OS << "Curve2ds " << aNb << "\n";
+    NCollection_Array1<Handle(Geom2d_Curve)> aCurves (0, aNb);
+    for (Standard_Integer anIter = 1; anIter <= aNb; ++anIter)
+    {
+      aCurves (anIter) = theSet.Curve2d (anIter);
+    }
+    writeTable (OS, BinTools_ArrayCodec<Handle(Geom2d_Curve)> (aCurves, writeCurve2d, readCurve2d), aNb, theParams, theRange);
+  }
+
+  //! Reads the 2D curves in format BinTools_FormatVersion_VERSION_5.
+  static void readCurve2dTable (Standard_IStream& IS, BinTools_Curve2dSet& theSet,
+                                const BinTools_TableParams& theParams, const Message_ProgressRange& theRange)
+  {
+    const Standard_Integer aNb = readTableHeader (IS, "Curve2ds");
+    NCollection_Array1<Handle(Geom2d_Curve)> aCurves (0, aNb);
+    readTable (IS, BinTools_ArrayCodec<Handle(Geom2d_Curve)> (aCurves, writeCurve2d, readCurve2d), aNb, theParams, theRange);
+    for (Standard_Integer anIter = 1; anIter <= aNb && !aCurves (anIter).IsNull(); ++anIter)
+    {
+      theSet.Add (aCurves (anIter));
+    }
+  }
+
+  //! Writes the 3D curves in format BinTools_FormatVersion_VERSION_5.
+  static void writeCurveTable (Standard_OStream& OS, const BinTools_CurveSet& theSet,
+                               const BinTools_TableParams& theParams, const Message_ProgressRange& theRange)
+  {
+    const Standard_Integer aNb = theSet.NbCurves();
+    OS << "Curves " << aNb << "\n";
+    NCollection_Array1<Handle(Geom_Curve)> aCurves (0, aNb);
+    for (Standard_Integer anIter = 1; anIter <= aNb; ++anIter)
+    {
+      aCurves (anIter) = theSet.Curve (anIter);
+    }
+    writeTable (OS, BinTools_ArrayCodec<Handle(Geom_Curve)> (aCurves, writeCurve, readCurve), aNb, theParams, theRange);
+  }
+
+  //! Reads the 3D curves in format BinTools_FormatVersion_VERSION_5.
+  static void readCurveTable (Standard_IStream& IS, BinTools_CurveSet& theSet,
+                              const BinTools_TableParams& theParams, const Message_ProgressRange& theRange)
+  {
+    const Standard_Integer aNb = readTableHeader (IS, "Curves");
+    NCollection_Array1<Handle(Geom_Curve)> aCurves (0, aNb);
+    readTable (IS, BinTools_ArrayCodec<Handle(Geom_Curve)> (aCurves, writeCurve, readCurve), aNb, theParams, theRange);
+    for (Standard_Integer anIter = 1; anIter <= aNb && !aCurves (anIter).IsNull(); ++anIter)
+    {
+      theSet.Add (aCurves (anIter));
+    }
+  }
+
+  //! Writes the surfaces in format BinTools_FormatVersion_VERSION_5.
+  static void writeSurfaceTable (Standard_OStream& OS, const BinTools_SurfaceSet& theSet,
+                                 const BinTools_TableParams& theParams, const Message_ProgressRange& theRange)
+  {
+    const Standard_Integer aNb = theSet.NbSurfaces();
+    OS << "Surfaces " << aNb << "\n";
+    NCollection_Array1<Handle(Geom_Surface)> aSurfaces (0, aNb);
+    for (Standard_Integer anIter = 1; anIter <= aNb; ++anIter)
+    {
+      aSurfaces (anIter) = theSet.Surface (anIter);
+    }
+    writeTable (OS, BinTools_ArrayCodec<Handle(Geom_Surface)> (aSurfaces, writeSurface, readSurface), aNb, theParams, theRange);
+  }
+
+  //! Reads the surfaces in format BinTools_FormatVersion_VERSION_5.
+  static void readSurfaceTable (Standard_IStream& IS, BinTools_SurfaceSet& theSet,
+                                const BinTools_TableParams& theParams, const Message_ProgressRange& theRange)
+  {
+    const Standard_Integer aNb = readTableHeader (IS, "Surfaces");
+    NCollection_Array1<Handle(Geom_Surface)> aSurfaces (0, aNb);
+    readTable (IS, BinTools_ArrayCodec<Handle(Geom_Surface)> (aSurfaces, writeSurface, readSurface), aNb, theParams, theRange);
+    for (Standard_Integer anIter = 1; anIter <= aNb && !aSurfaces (anIter).IsNull(); ++anIter)
+    {
+      theSet.Add (aSurfaces (anIter));
+    }
+  }
+}
 
 //=======================================================================
 //function : BinTools_ShapeSet
 //purpose  :
 //=======================================================================
 BinTools_ShapeSet::BinTools_ShapeSet ()
-  : BinTools_ShapeSetBase ()
+  : BinTools_ShapeSetBase (),
+    myIsParallel (Standard_False),
+    myNodesPrecision (0.0),
+    myToCompress (Standard_False)
 {}
 
 //=======================================================================
@@ -267,11 +1485,19 @@ void BinTools_ShapeSet::AddShape (const TopoDS_Shape& S)
 void  BinTools_ShapeSet::WriteGeometry (Standard_OStream& OS,
                                         const Message_ProgressRange& theRange)const
 {
+  const Standard_Boolean hasTables = FormatNb() >= BinTools_FormatVersion_VERSION_5;
+  const BinTools_TableParams aParams = tableParams (*this);
   Message_ProgressScope aPS(theRange, "Writing geometry", 6);
-  myCurves2d.Write(OS, aPS.Next());
+  if (hasTables)
+    writeCurve2dTable(OS, myCurves2d, aParams, aPS.Next());
+  else
+    myCurves2d.Write(OS, aPS.Next());
   if (!aPS.More())
     return;
-  myCurves.Write(OS, aPS.Next());
+  if (hasTables)
+    writeCurveTable(OS, myCurves, aParams, aPS.Next());
+  else
+    myCurves.Write(OS, aPS.Next());
   if (!aPS.More())
     return;
   WritePolygon3D(OS, aPS.Next());
@@ -280,7 +1506,10 @@ void  BinTools_ShapeSet::WriteGeometry (Standard_OStream& OS,
   WritePolygonOnTriangulation(OS, aPS.Next());
   if (!aPS.More())
     return;
-  mySurfaces.Write(OS, aPS.Next());
+  if (hasTables)
+    writeSurfaceTable(OS, mySurfaces, aParams, aPS.Next());
+  else
+    mySurfaces.Write(OS, aPS.Next());
   if (!aPS.More())
     return;
   WriteTriangulation(OS, aPS.Next());
@@ -532,12 +1761,20 @@ void BinTools_ShapeSet::ReadGeometry (Standard_IStream& IS,
                                       const Message_ProgressRange& theRange)
 {
 
+  const Standard_Boolean hasTables = FormatNb() >= BinTools_FormatVersion_VERSION_5;
+  const BinTools_TableParams aParams = tableParams (*this);
   Message_ProgressScope aPS(theRange, "Reading geometry", 6);
-  myCurves2d.Read(IS, aPS.Next());
+  if (hasTables)
+    readCurve2dTable(IS, myCurves2d, aParams, aPS.Next());
+  else
+    myCurves2d.Read(IS, aPS.Next());
   if (!aPS.More())
     return;
 
-  myCurves.Read(IS, aPS.Next());
+  if (hasTables)
+    readCurveTable(IS, myCurves, aParams, aPS.Next());
+  else
+    myCurves.Read(IS, aPS.Next());
   if (!aPS.More())
     return;
 
@@ -549,7 +1786,10 @@ void BinTools_ShapeSet::ReadGeometry (Standard_IStream& IS,
   if (!aPS.More())
     return;
 
-  mySurfaces.Read(IS, aPS.Next());
+  if (hasTables)
+    readSurfaceTable(IS, mySurfaces, aParams, aPS.Next());
+  else
+    mySurfaces.Read(IS, aPS.Next());
   if (!aPS.More())
     return;
 
@@ -1206,33 +2446,29 @@ void BinTools_ShapeSet::WritePolygonOnTriangulation
   try
   {
     OCC_CATCH_SIGNALS
-    Message_ProgressScope aPS(theRange, "Writing polygons on triangulation", aNbPol);
-    for (Standard_Integer aPolIter = 1; aPolIter <= aNbPol && aPS.More(); ++aPolIter, aPS.Next())
+    if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
     {
-      const Handle(Poly_PolygonOnTriangulation)& aPoly = myNodes.FindKey (aPolIter);
-      const TColStd_Array1OfInteger& aNodes = aPoly->Nodes();
-      BinTools::PutInteger(OS, aNodes.Length());
-      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNodes.Length(); ++aNodeIter)
-      {
-        BinTools::PutInteger(OS, aNodes.Value (aNodeIter));
-      }
-
-      // write the deflection
-      BinTools::PutReal(OS, aPoly->Deflection());
-
-      // writing parameters
-      if (const Handle(TColStd_HArray1OfReal)& aParam = aPoly->Parameters())
+      NCollection_Array1<Handle(Poly_PolygonOnTriangulation)> aPolygons (0, aNbPol);
+      for (Standard_Integer aPolIter = 1; aPolIter <= aNbPol; ++aPolIter)
       {
-        BinTools::PutBool(OS, Standard_True);
-        for (Standard_Integer aNodeIter = 1; aNodeIter <= aParam->Length(); ++aNodeIter)
-        {
-          BinTools::PutReal(OS, aParam->Value (aNodeIter));
-        }
+        aPolygons (aPolIter) = myNodes.FindKey (aPolIter);
       }
-      else
+      const BinTools_TableParams aParams = tableParams (*this);
+      if (aParams.IsCompact)
       {
-        BinTools::PutBool(OS, Standard_False);
+        writeTable (OS, BinTools_ArrayCodec<Handle(Poly_PolygonOnTriangulation)> (aPolygons, writePolygonOnTriangulationCompact, readPolygonOnTriangulationCompact),
+                    aNbPol, aParams, theRange);
+        return;
       }
+      writeTable (OS, BinTools_ArrayCodec<Handle(Poly_PolygonOnTriangulation)> (aPolygons, writePolygonOnTriangulation, readPolygonOnTriangulation),
+                  aNbPol, aParams, theRange);
+      return;
+    }
+
+    Message_ProgressScope aPS(theRange, "Writing polygons on triangulation", aNbPol);
+    for (Standard_Integer aPolIter = 1; aPolIter <= aNbPol && aPS.More(); ++aPolIter, aPS.Next())
+    {
+      writePolygonOnTriangulation (OS, myNodes.FindKey (aPolIter));
     }
   }
   catch (Standard_Failure const& anException)
@@ -1264,34 +2500,32 @@ void BinTools_ShapeSet::ReadPolygonOnTriangulation
   try
   {
     OCC_CATCH_SIGNALS
-    Message_ProgressScope aPS(theRange, "Reading Polygones on triangulation", aNbPol);
-    for (Standard_Integer aPolIter = 1; aPolIter <= aNbPol && aPS.More(); ++aPolIter, aPS.Next())
+    if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
     {
-      Standard_Integer aNbNodes = 0;
-      BinTools::GetInteger(IS, aNbNodes);
-      Handle(Poly_PolygonOnTriangulation) aPoly = new Poly_PolygonOnTriangulation (aNbNodes, Standard_False);
-      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      NCollection_Array1<Handle(Poly_PolygonOnTriangulation)> aPolygons (0, aNbPol);
+      const BinTools_TableParams aParams = tableParams (*this);
+      if (aParams.IsCompact)
       {
-        Standard_Integer aNode = 0;
-        BinTools::GetInteger (IS, aNode);
-        aPoly->SetNode (aNodeIter, aNode);
+        readTable (IS, BinTools_ArrayCodec<Handle(Poly_PolygonOnTriangulation)> (aPolygons, writePolygonOnTriangulationCompact, readPolygonOnTriangulationCompact),
+                   aNbPol, aParams, theRange);
       }
-
-      Standard_Real aDefl = 0.0;
-      BinTools::GetReal(IS, aDefl);
-      aPoly->Deflection (aDefl);
-
-      Standard_Boolean hasParameters = Standard_False;
-      BinTools::GetBool(IS, hasParameters);
-      if (hasParameters)
+      else
       {
-        Handle(TColStd_HArray1OfReal) aParams = new TColStd_HArray1OfReal (1, aNbNodes);
-        for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-        {
-          BinTools::GetReal(IS, aParams->ChangeValue (aNodeIter));
-        }
-        aPoly->SetParameters (aParams);
+        readTable (IS, BinTools_ArrayCodec<Handle(Poly_PolygonOnTriangulation)> (aPolygons, writePolygonOnTriangulation, readPolygonOnTriangulation),
+                   aNbPol, aParams, theRange);
       }
+      for (Standard_Integer aPolIter = 1; aPolIter <= aNbPol && !aPolygons (aPolIter).IsNull(); ++aPolIter)
+      {
+        myNodes.Add (aPolygons (aPolIter));
+      }
+      return;
+    }
+
+    Message_ProgressScope aPS(theRange, "Reading Polygones on triangulation", aNbPol);
+    for (Standard_Integer aPolIter = 1; aPolIter <= aNbPol && aPS.More(); ++aPolIter, aPS.Next())
+    {
+      Handle(Poly_PolygonOnTriangulation) aPoly;
+      readPolygonOnTriangulation (IS, aPoly);
       myNodes.Add (aPoly);
     }
   }
@@ -1315,34 +2549,22 @@ void BinTools_ShapeSet::WritePolygon3D (Standard_OStream& OS,
   try
   {
     OCC_CATCH_SIGNALS
-    Message_ProgressScope aPS(theRange, "Writing polygons 3D", aNbPol);
-    for (Standard_Integer aPolIter = 1; aPolIter <= aNbPol && aPS.More(); ++aPolIter, aPS.Next())
+    if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
     {
-      const Handle(Poly_Polygon3D)& aPoly = myPolygons3D.FindKey (aPolIter);
-      BinTools::PutInteger(OS, aPoly->NbNodes());
-      BinTools::PutBool(OS, aPoly->HasParameters());
-
-      // write the deflection
-      BinTools::PutReal(OS, aPoly->Deflection());
-
-      // write the nodes
-      const Standard_Integer  aNbNodes = aPoly->NbNodes();
-      const TColgp_Array1OfPnt& aNodes = aPoly->Nodes();
-      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-      {
-        const gp_Pnt& aPnt = aNodes.Value (aNodeIter);
-        BinTools::PutReal(OS, aPnt.X());
-        BinTools::PutReal(OS, aPnt.Y());
-        BinTools::PutReal(OS, aPnt.Z());
-      }
-      if (aPoly->HasParameters())
+      NCollection_Array1<Handle(Poly_Polygon3D)> aPolygons (0, aNbPol);
+      for (Standard_Integer aPolIter = 1; aPolIter <= aNbPol; ++aPolIter)
       {
-        const TColStd_Array1OfReal& aParam = aPoly->Parameters();
-        for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-        {
-          BinTools::PutReal(OS, aParam.Value (aNodeIter));
-        }
+        aPolygons (aPolIter) = myPolygons3D.FindKey (aPolIter);
       }
+      writeTable (OS, BinTools_ArrayCodec<Handle(Poly_Polygon3D)> (aPolygons, writePolygon3D, readPolygon3D),
+                  aNbPol, tableParams (*this), theRange);
+      return;
+    }
+
+    Message_ProgressScope aPS(theRange, "Writing polygons 3D", aNbPol);
+    for (Standard_Integer aPolIter = 1; aPolIter <= aNbPol && aPS.More(); ++aPolIter, aPS.Next())
+    {
+      writePolygon3D (OS, myPolygons3D.FindKey (aPolIter));
     }
   }
   catch (Standard_Failure const& anException)
@@ -1376,36 +2598,23 @@ void BinTools_ShapeSet::ReadPolygon3D (Standard_IStream& IS,
   try
   {
     OCC_CATCH_SIGNALS
-    Message_ProgressScope aPS(theRange, "Reading polygones 3D", aNbPol);
-    for (Standard_Integer aPolIter = 1; aPolIter <= aNbPol && aPS.More(); ++aPolIter, aPS.Next())
+    if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
     {
-      Standard_Integer aNbNodes = 0;
-      Standard_Boolean hasParameters = Standard_False;
-      Standard_Real aDefl = 0.0;
-      BinTools::GetInteger(IS, aNbNodes);
-      BinTools::GetBool(IS, hasParameters);
-      BinTools::GetReal(IS, aDefl);
-
-      Handle(Poly_Polygon3D) aPoly = new Poly_Polygon3D (aNbNodes, hasParameters);
-      aPoly->Deflection (aDefl);
-
-      TColgp_Array1OfPnt& aNodes = aPoly->ChangeNodes();
-      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-      {
-        gp_XYZ& aPnt = aNodes.ChangeValue (aNodeIter).ChangeCoord();
-        BinTools::GetReal(IS, aPnt.ChangeCoord (1));
-        BinTools::GetReal(IS, aPnt.ChangeCoord (2));
-        BinTools::GetReal(IS, aPnt.ChangeCoord (3));
-      }
-      if (hasParameters)
+      NCollection_Array1<Handle(Poly_Polygon3D)> aPolygons (0, aNbPol);
+      readTable (IS, BinTools_ArrayCodec<Handle(Poly_Polygon3D)> (aPolygons, writePolygon3D, readPolygon3D),
+                 aNbPol, tableParams (*this), theRange);
+      for (Standard_Integer aPolIter = 1; aPolIter <= aNbPol && !aPolygons (aPolIter).IsNull(); ++aPolIter)
       {
-        TColStd_Array1OfReal& aParam = aPoly->ChangeParameters();
-        for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-        {
-          BinTools::GetReal(IS, aParam.ChangeValue (aNodeIter));
-        }
+        myPolygons3D.Add (aPolygons (aPolIter));
       }
+      return;
+    }
 
+    Message_ProgressScope aPS(theRange, "Reading polygones 3D", aNbPol);
+    for (Standard_Integer aPolIter = 1; aPolIter <= aNbPol && aPS.More(); ++aPolIter, aPS.Next())
+    {
+      Handle(Poly_Polygon3D) aPoly;
+      readPolygon3D (IS, aPoly);
       myPolygons3D.Add (aPoly);
     }
   }
@@ -1431,64 +2640,27 @@ void BinTools_ShapeSet::WriteTriangulation (Standard_OStream& OS,
   try
   {
     OCC_CATCH_SIGNALS
-    Message_ProgressScope aPS(theRange, "Writing triangulation", aNbTriangulations);
-    for (Standard_Integer aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More(); ++aTriangulationIter, aPS.Next())
+    if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
     {
-      const Handle(Poly_Triangulation)& aTriangulation = myTriangulations.FindKey (aTriangulationIter);
-      Standard_Boolean NeedToWriteNormals = myTriangulations.FindFromIndex(aTriangulationIter);
-      const Standard_Integer aNbNodes     = aTriangulation->NbNodes();
-      const Standard_Integer aNbTriangles = aTriangulation->NbTriangles();
-      BinTools::PutInteger(OS, aNbNodes);
-      BinTools::PutInteger(OS, aNbTriangles);
-      BinTools::PutBool(OS, aTriangulation->HasUVNodes() ? 1 : 0);
-      if (FormatNb() >= BinTools_FormatVersion_VERSION_4)
-      {
-        BinTools::PutBool(OS, (aTriangulation->HasNormals() && NeedToWriteNormals) ? 1 : 0);
-      }
-      BinTools::PutReal(OS, aTriangulation->Deflection());
-
-      // write the 3d nodes
-      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-      {
-        const gp_Pnt aPnt = aTriangulation->Node (aNodeIter);
-        BinTools::PutReal(OS, aPnt.X());
-        BinTools::PutReal(OS, aPnt.Y());
-        BinTools::PutReal(OS, aPnt.Z());
-      }
-
-      if (aTriangulation->HasUVNodes())
-      {
-        for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-        {
-          const gp_Pnt2d aUV = aTriangulation->UVNode (aNodeIter);
-          BinTools::PutReal(OS, aUV.X());
-          BinTools::PutReal(OS, aUV.Y());
-        }
-      }
-
-      for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+      NCollection_Array1<Handle(Poly_Triangulation)> aTriangulations (0, aNbTriangulations);
+      NCollection_Array1<Standard_Boolean> aNeedNormals (0, aNbTriangulations);
+      for (Standard_Integer aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations; ++aTriangulationIter)
       {
-        const Poly_Triangle aTri = aTriangulation->Triangle (aTriIter);
-        BinTools::PutInteger(OS, aTri.Value (1));
-        BinTools::PutInteger(OS, aTri.Value (2));
-        BinTools::PutInteger(OS, aTri.Value (3));
+        aTriangulations (aTriangulationIter) = myTriangulations.FindKey (aTriangulationIter);
+        aNeedNormals (aTriangulationIter) = myTriangulations.FindFromIndex (aTriangulationIter);
       }
+      const BinTools_TableParams aParams = tableParams (*this);
+      writeTable (OS, BinTools_TriangulationCodec (aTriangulations, aNeedNormals, aParams),
+                  aNbTriangulations, aParams, theRange);
+      return;
+    }
 
-      // write the normals
-      if (FormatNb() >= BinTools_FormatVersion_VERSION_4)
-      {
-        if (aTriangulation->HasNormals() && NeedToWriteNormals)
-        {
-          gp_Vec3f aNormal;
-          for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
-          {
-            aTriangulation->Normal (aNormalIter, aNormal);
-            BinTools::PutShortReal (OS, aNormal.x());
-            BinTools::PutShortReal (OS, aNormal.y());
-            BinTools::PutShortReal (OS, aNormal.z());
-          }
-        }
-      }
+    Message_ProgressScope aPS(theRange, "Writing triangulation", aNbTriangulations);
+    for (Standard_Integer aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More(); ++aTriangulationIter, aPS.Next())
+    {
+      writeTriangulation (OS, myTriangulations.FindKey (aTriangulationIter),
+                          myTriangulations.FindFromIndex (aTriangulationIter),
+                          FormatNb() >= BinTools_FormatVersion_VERSION_4);
     }
   }
   catch (Standard_Failure const& anException)
@@ -1520,9 +2692,40 @@ void BinTools_ShapeSet::ReadTriangulation (Standard_IStream& IS,
   try
   {
     OCC_CATCH_SIGNALS
+    if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+    {
+      // the compact entries cannot be located without decoding, so that they are read immediately
+      if (myDeferredFile.IsEmpty()
+       || FormatNb() >= BinTools_FormatVersion_VERSION_6)
+      {
+        NCollection_Array1<Handle(Poly_Triangulation)> aTriangulations (0, aNbTriangulations);
+        NCollection_Array1<Standard_Boolean> aHasNormals (0, aNbTriangulations);
+        const BinTools_TableParams aParams = tableParams (*this);
+        readTable (IS, BinTools_TriangulationCodec (aTriangulations, aHasNormals, aParams),
+                   aNbTriangulations, aParams, theRange);
+        for (Standard_Integer aTriangulationIter = 1;
+             aTriangulationIter <= aNbTriangulations && !aTriangulations (aTriangulationIter).IsNull(); ++aTriangulationIter)
+        {
+          myTriangulations.Add (aTriangulations (aTriangulationIter), aHasNormals (aTriangulationIter));
+        }
+        return;
+      }
+
+      // the entries follow each other, so that the offsets are not needed to refer to them
+      IS.seekg (std::streamoff (sizeof(uint64_t)) * (aNbTriangulations + 1), std::ios::cur);
+    }
+
     Message_ProgressScope aPS(theRange, "Reading triangulation", aNbTriangulations);
     for (Standard_Integer aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More(); ++aTriangulationIter, aPS.Next())
     {
+      if (myDeferredFile.IsEmpty())
+      {
+        Handle(Poly_Triangulation) aTriangulation;
+        readTriangulation (IS, aTriangulation, FormatNb() >= BinTools_FormatVersion_VERSION_4);
+        myTriangulations.Add (aTriangulation, aTriangulation->HasNormals());
+        continue;
+      }
+
       Standard_Integer aNbNodes = 0, aNbTriangles = 0;
       Standard_Boolean hasUV = Standard_False;
       Standard_Boolean hasNormals = Standard_False;
@@ -1535,52 +2738,17 @@ void BinTools_ShapeSet::ReadTriangulation (Standard_IStream& IS,
         BinTools::GetBool(IS, hasNormals);
       }
       BinTools::GetReal(IS, aDefl); //deflection
-      Handle(Poly_Triangulation) aTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, hasUV, hasNormals);
-      aTriangulation->Deflection (aDefl);
-
-      gp_Pnt aNode;
-      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-      {
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (1));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (2));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (3));
-        aTriangulation->SetNode (aNodeIter, aNode);
-      }
-
-      if (hasUV)
-      {
-        gp_Pnt2d aNode2d;
-        for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-        {
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (1));
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (2));
-          aTriangulation->SetUVNode (aNodeIter, aNode2d);
-        }
-      }
-
-      // read the triangles
-      Standard_Integer aTriNodes[3] = {};
-      for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
-      {
-        BinTools::GetInteger(IS, aTriNodes[0]);
-        BinTools::GetInteger(IS, aTriNodes[1]);
-        BinTools::GetInteger(IS, aTriNodes[2]);
-        aTriangulation->SetTriangle (aTriIter, Poly_Triangle (aTriNodes[0], aTriNodes[1], aTriNodes[2]));
-      }
-      //IS.ignore(sizeof(Standard_Real) * (hasUV ? 5 : 3) * aNbNodes + sizeof(Standard_Integer) * 3 * aNbTriangles);
 
-      if (hasNormals)
+      // keep the position of the data and skip it
+      const int64_t aDataPos = IS.tellg();
+      Handle(BinTools_TriangulationSource) aTriangulation =
+        new BinTools_TriangulationSource (myDeferredFile, aDataPos, aNbNodes, aNbTriangles, hasUV, hasNormals);
+      aTriangulation->Deflection (aDefl);
+      IS.seekg (aTriangulation->DataSize(), std::ios::cur);
+      if (aDataPos < 0 || IS.fail())
       {
-        gp_Vec3f aNormal;
-        for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
-        {
-          BinTools::GetShortReal(IS, aNormal.x());
-          BinTools::GetShortReal(IS, aNormal.y());
-          BinTools::GetShortReal(IS, aNormal.z());
-          aTriangulation->SetNormal (aNormalIter, aNormal);
-        }
+        throw Standard_Failure("BinTools_ShapeSet::ReadTriangulation: cannot skip triangulation data");
       }
-
       myTriangulations.Add (aTriangulation, hasNormals);
     }
   }
@@ -27,6 +27,7 @@
 #include <TColStd_IndexedMapOfTransient.hxx>
 #include <Standard_OStream.hxx>
 #include <Standard_IStream.hxx>
+#include <TCollection_AsciiString.hxx>
 
 
 //! Writes topology in OStream in binary format
@@ -61,6 +62,44 @@ public:
   
   //! Returns number of shapes read from file.
   Standard_EXPORT Standard_Integer NbShapes() const;
+
+  //! Returns path to the file from which triangulations are loaded on demand;
+  //! empty by default, which means that triangulations are read immediately.
+  const TCollection_AsciiString& DeferredFile() const { return myDeferredFile; }
+
+  //! Defines the path to the file being read in order to defer loading of triangulations.
+  //! When defined, ReadTriangulation() only skips the data of triangulations in the stream
+  //! and creates BinTools_TriangulationSource objects pointing to its position in the file,
+  //! so that nodes and triangles are read by Poly_Triangulation::LoadDeferredData() later.
+  //! The stream passed to Read() should be opened on this file from its beginning.
+  //! Ignored for format BinTools_FormatVersion_VERSION_6 and later, whose triangulations are read immediately.
+  void SetDeferredFile (const TCollection_AsciiString& theFile) { myDeferredFile = theFile; }
+
+  //! Sets the flag of parallel processing of the tables of geometry, polygons and triangulations.
+  //! Has effect for format BinTools_FormatVersion_VERSION_5 and later only,
+  //! which stores the offsets of the entries of these tables.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing of the tables.
+  Standard_Boolean IsRunParallel() const { return myIsParallel; }
+
+  //! Sets the precision of quantization of triangulation nodes and normals.
+  //! Has effect for writing in format BinTools_FormatVersion_VERSION_6 and later only;
+  //! the nodes are stored as integer steps of 2 * thePrecision from the corner of bounding box,
+  //! so that each node deviates from its original position by thePrecision at most.
+  //! Zero value (default) means lossless storage of nodes and normals.
+  void SetNodesPrecision (const Standard_Real thePrecision) { myNodesPrecision = thePrecision; }
+
+  //! Returns the precision of quantization of triangulation nodes.
+  Standard_Real NodesPrecision() const { return myNodesPrecision; }
+
+  //! Sets the flag of compression of the tables of geometry, polygons and triangulations
+  //! by BinTools_BlockCompressor (FALSE by default).
+  //! Has effect for writing in format BinTools_FormatVersion_VERSION_6 and later only.
+  void SetCompressTables (const Standard_Boolean theToCompress) { myToCompress = theToCompress; }
+
+  //! Returns the flag of compression of the tables.
+  Standard_Boolean ToCompressTables() const { return myToCompress; }
   
   //! Writes the content of  me  on the stream <OS> in binary
   //! format that can be read back by Read.
@@ -189,6 +228,10 @@ private:
                              Standard_Boolean> myTriangulations; //!< Contains a boolean flag with information
                                                                  //!  to save normals for triangulation
   NCollection_IndexedMap<Handle(Poly_PolygonOnTriangulation), TColStd_MapTransientHasher> myNodes;
+  TCollection_AsciiString myDeferredFile; //!< file to load triangulations from on demand
+  Standard_Boolean myIsParallel; //!< flag of parallel processing of the tables
+  Standard_Real myNodesPrecision; //!< precision of quantization of triangulation nodes
+  Standard_Boolean myToCompress; //!< flag of compression of the tables
 };
 
 #endif // _BinTools_ShapeSet_HeaderFile
@@ -13,6 +13,7 @@
 
 #include <BinTools.hxx>
 #include <BinTools_ShapeSetBase.hxx>
+#include <Poly_Triangulation.hxx>
 #include <TopoDS_Shape.hxx>
 
 const Standard_CString BinTools_ShapeSetBase::THE_ASCII_VERSIONS[BinTools_FormatVersion_UPPER + 1] =
@@ -21,7 +22,9 @@ const Standard_CString BinTools_ShapeSetBase::THE_ASCII_VERSIONS[BinTools_Format
   "Open CASCADE Topology V1 (c)",
   "Open CASCADE Topology V2 (c)",
   "Open CASCADE Topology V3 (c)",
-  "Open CASCADE Topology V4, (c) Open Cascade"
+  "Open CASCADE Topology V4, (c) Open Cascade",
+  "Open CASCADE Topology V5, (c) Open Cascade",
+  "Open CASCADE Topology V6, (c) Open Cascade"
 };
 
 //=======================================================================
@@ -67,3 +70,23 @@ void BinTools_ShapeSetBase::SetFormatNb (const Standard_Integer theFormatNb)
 
   myFormatNb = theFormatNb;
 }
+
+//=======================================================================
+//function : TriangulationToWrite
+//purpose  : 
+//=======================================================================
+Handle(Poly_Triangulation) BinTools_ShapeSetBase::TriangulationToWrite
+  (const Handle(Poly_Triangulation)& theTriangulation)
+{
+  if (theTriangulation->HasDeferredData()
+  && !theTriangulation->HasGeometry())
+  {
+    // the triangulation is not loaded yet, write its deferred data
+    Handle(Poly_Triangulation) aLoaded = theTriangulation->DetachedLoadDeferredData();
+    if (!aLoaded.IsNull())
+    {
+      return aLoaded;
+    }
+  }
+  return theTriangulation;
+}
@@ -25,6 +25,7 @@
 
 class TopoDS_Shape;
 class gp_Pnt;
+class Poly_Triangulation;
 
 //! Writes to the stream a gp_Pnt data
 Standard_OStream& operator << (Standard_OStream& OS, const gp_Pnt& P);
@@ -106,6 +107,12 @@ public:
   
   //! An empty virtual method for redefinition in shape-reader.
   Standard_EXPORT virtual void Read (Standard_IStream& /*theStream*/, TopoDS_Shape& /*theShape*/) {}
+
+  //! Returns the triangulation holding the data to be written for the given one:
+  //! the detached copy with the loaded deferred data if the triangulation is not loaded yet,
+  //! or the given triangulation itself otherwise (also if its deferred data fail to be loaded).
+  Standard_EXPORT static Handle(Poly_Triangulation) TriangulationToWrite
+    (const Handle(Poly_Triangulation)& theTriangulation);
                                                                                     
   static const Standard_CString THE_ASCII_VERSIONS[BinTools_FormatVersion_UPPER + 1];
 private:
@@ -231,7 +231,7 @@ void BinTools_ShapeWriter::WriteShape (BinTools_OStream& theStream, const TopoDS
         {
           theStream << (Standard_Byte)2;
           WriteTriangulation (theStream, aTF->Triangulation(),
-            aTF->Triangulation()->HasNormals() && (IsWithNormals() || aTF->Surface().IsNull()));
+            IsWithNormals() || aTF->Surface().IsNull());
         }
         else
           theStream << (Standard_Byte)1;
@@ -467,29 +467,32 @@ void BinTools_ShapeWriter::WriteTriangulation (BinTools_OStream& theStream,
   myTriangulationPos.Bind (theTriangulation, theStream.Position());
   theStream << BinTools_ObjectType_Triangulation;
 
-  const Standard_Integer aNbNodes = theTriangulation->NbNodes();
-  const Standard_Integer aNbTriangles = theTriangulation->NbTriangles();
-  theStream << aNbNodes << aNbTriangles << theTriangulation->HasUVNodes();
-  theStream << theNeedToWriteNormals << theTriangulation->Deflection();
+  const Handle(Poly_Triangulation) aData = TriangulationToWrite (theTriangulation);
+  const Standard_Boolean toWriteNormals = theNeedToWriteNormals && aData->HasNormals();
+
+  const Standard_Integer aNbNodes = aData->NbNodes();
+  const Standard_Integer aNbTriangles = aData->NbTriangles();
+  theStream << aNbNodes << aNbTriangles << aData->HasUVNodes();
+  theStream << toWriteNormals << aData->Deflection();
   // write the 3d nodes
   for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-    theStream << theTriangulation->Node (aNodeIter);
+    theStream << aData->Node (aNodeIter);
   //theStream.write ((char*)(theTriangulation->InternalNodes().value(0)) , sizeof (gp_Pnt) * aNbNodes);  
 
-  if (theTriangulation->HasUVNodes())
+  if (aData->HasUVNodes())
   {
     for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-      theStream << theTriangulation->UVNode (aNodeIter);
+      theStream << aData->UVNode (aNodeIter);
   }
   for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
-    theStream << theTriangulation->Triangle (aTriIter);
+    theStream << aData->Triangle (aTriIter);
 
-  if (theNeedToWriteNormals)
+  if (toWriteNormals)
   {
     gp_Vec3f aNormal;
     for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
     {
-      theTriangulation->Normal (aNormalIter, aNormal);
+      aData->Normal (aNormalIter, aNormal);
       theStream << aNormal;
     }
   }
@@ -0,0 +1,146 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools_TriangulationSource.hxx>
+
+#include <BinTools.hxx>
+#include <Message.hxx>
+#include <OSD_FileSystem.hxx>
+#include <Standard_ErrorHandler.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BinTools_TriangulationSource, Poly_Triangulation)
+
+//=======================================================================
+//function : BinTools_TriangulationSource
+//purpose  :
+//=======================================================================
+BinTools_TriangulationSource::BinTools_TriangulationSource (const TCollection_AsciiString& theFile,
+                                                            const int64_t theOffset,
+                                                            const Standard_Integer theNbNodes,
+                                                            const Standard_Integer theNbTris,
+                                                            const Standard_Boolean theHasUV,
+                                                            const Standard_Boolean theHasNormals)
+: myFile (theFile),
+  myOffset (theOffset),
+  myNbDefNodes (theNbNodes),
+  myNbDefTriangles (theNbTris),
+  myHasUV (theHasUV),
+  myHasNormals (theHasNormals)
+{
+  //
+}
+
+//=======================================================================
+//function : DataSize
+//purpose  :
+//=======================================================================
+int64_t BinTools_TriangulationSource::DataSize (const Standard_Integer theNbNodes,
+                                                const Standard_Integer theNbTris,
+                                                const Standard_Boolean theHasUV,
+                                                const Standard_Boolean theHasNormals)
+{
+  int64_t aNodeSize = 3 * sizeof(Standard_Real);
+  if (theHasUV)
+  {
+    aNodeSize += 2 * sizeof(Standard_Real);
+  }
+  if (theHasNormals)
+  {
+    aNodeSize += 3 * sizeof(Standard_ShortReal);
+  }
+  return int64_t(theNbNodes) * aNodeSize
+       + int64_t(theNbTris) * 3 * sizeof(Standard_Integer);
+}
+
+//=======================================================================
+//function : DataSize
+//purpose  :
+//=======================================================================
+int64_t BinTools_TriangulationSource::DataSize() const
+{
+  return DataSize (myNbDefNodes, myNbDefTriangles, myHasUV, myHasNormals);
+}
+
+//=======================================================================
+//function : loadDeferredData
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_TriangulationSource::loadDeferredData (const Handle(OSD_FileSystem)& theFileSystem,
+                                                                 const Handle(Poly_Triangulation)& theDestTriangulation) const
+{
+  const Handle(OSD_FileSystem)& aFileSystem = !theFileSystem.IsNull() ? theFileSystem : OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream> aSharedStream = aFileSystem->OpenIStream (myFile, std::ios::in | std::ios::binary, myOffset);
+  if (aSharedStream.get() == NULL)
+  {
+    Message::SendFail (TCollection_AsciiString ("Error: triangulation refers to invalid file '") + myFile + "'");
+    return false;
+  }
+
+  Standard_IStream& aStream = *aSharedStream;
+  theDestTriangulation->Deflection (Deflection());
+  theDestTriangulation->ResizeNodes (myNbDefNodes, Standard_False);
+  theDestTriangulation->ResizeTriangles (myNbDefTriangles, Standard_False);
+  try
+  {
+    OCC_CATCH_SIGNALS
+    gp_Pnt aNode;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= myNbDefNodes; ++aNodeIter)
+    {
+      BinTools::GetReal (aStream, aNode.ChangeCoord().ChangeCoord (1));
+      BinTools::GetReal (aStream, aNode.ChangeCoord().ChangeCoord (2));
+      BinTools::GetReal (aStream, aNode.ChangeCoord().ChangeCoord (3));
+      theDestTriangulation->SetNode (aNodeIter, aNode);
+    }
+
+    if (myHasUV)
+    {
+      theDestTriangulation->AddUVNodes();
+      gp_Pnt2d aNode2d;
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= myNbDefNodes; ++aNodeIter)
+      {
+        BinTools::GetReal (aStream, aNode2d.ChangeCoord().ChangeCoord (1));
+        BinTools::GetReal (aStream, aNode2d.ChangeCoord().ChangeCoord (2));
+        theDestTriangulation->SetUVNode (aNodeIter, aNode2d);
+      }
+    }
+
+    Standard_Integer aTriNodes[3] = {};
+    for (Standard_Integer aTriIter = 1; aTriIter <= myNbDefTriangles; ++aTriIter)
+    {
+      BinTools::GetInteger (aStream, aTriNodes[0]);
+      BinTools::GetInteger (aStream, aTriNodes[1]);
+      BinTools::GetInteger (aStream, aTriNodes[2]);
+      theDestTriangulation->SetTriangle (aTriIter, Poly_Triangle (aTriNodes[0], aTriNodes[1], aTriNodes[2]));
+    }
+
+    if (myHasNormals)
+    {
+      theDestTriangulation->AddNormals();
+      gp_Vec3f aNormal;
+      for (Standard_Integer aNormalIter = 1; aNormalIter <= myNbDefNodes; ++aNormalIter)
+      {
+        BinTools::GetShortReal (aStream, aNormal.x());
+        BinTools::GetShortReal (aStream, aNormal.y());
+        BinTools::GetShortReal (aStream, aNormal.z());
+        theDestTriangulation->SetNormal (aNormalIter, aNormal);
+      }
+    }
+  }
+  catch (Standard_Failure const&)
+  {
+    Message::SendFail (TCollection_AsciiString ("Error: cannot read triangulation data from the file '") + myFile + "'");
+    theDestTriangulation->Clear();
+    return false;
+  }
+  return true;
+}
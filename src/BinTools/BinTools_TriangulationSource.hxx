@@ -0,0 +1,88 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_TriangulationSource_HeaderFile
+#define _BinTools_TriangulationSource_HeaderFile
+
+#include <Poly_Triangulation.hxx>
+#include <TCollection_AsciiString.hxx>
+
+//! Triangulation stored in the binary BRep file and loaded on demand.
+//! The object keeps only the header of the triangulation record (number of nodes and triangles,
+//! presence of UV nodes and normals, deflection) and the position of its data within the file.
+//! Nodes, UV nodes, triangles and normals are read by Poly_Triangulation::LoadDeferredData().
+class BinTools_TriangulationSource : public Poly_Triangulation
+{
+  DEFINE_STANDARD_RTTIEXT(BinTools_TriangulationSource, Poly_Triangulation)
+public:
+
+  //! Constructor.
+  //! @param theFile      [in] path to the binary BRep file
+  //! @param theOffset    [in] position of the nodes of the triangulation within the file
+  //! @param theNbNodes   [in] number of nodes
+  //! @param theNbTris    [in] number of triangles
+  //! @param theHasUV     [in] flag indicating that UV nodes follow the 3D nodes
+  //! @param theHasNormals [in] flag indicating that normals follow the triangles
+  Standard_EXPORT BinTools_TriangulationSource (const TCollection_AsciiString& theFile,
+                                                const int64_t theOffset,
+                                                const Standard_Integer theNbNodes,
+                                                const Standard_Integer theNbTris,
+                                                const Standard_Boolean theHasUV,
+                                                const Standard_Boolean theHasNormals);
+
+  //! Returns path to the file containing triangulation data.
+  const TCollection_AsciiString& File() const { return myFile; }
+
+  //! Returns position of triangulation data within the file.
+  int64_t Offset() const { return myOffset; }
+
+  //! Returns size of triangulation data in the file in bytes.
+  Standard_EXPORT int64_t DataSize() const;
+
+  //! Returns TRUE if the stored triangulation has normals.
+  Standard_Boolean HasDeferredNormals() const { return myHasNormals; }
+
+public: //! @name late-load deferred data interface
+
+  //! Returns number of nodes for deferred loading.
+  virtual Standard_Integer NbDeferredNodes() const Standard_OVERRIDE { return myNbDefNodes; }
+
+  //! Returns number of triangles for deferred loading.
+  virtual Standard_Integer NbDeferredTriangles() const Standard_OVERRIDE { return myNbDefTriangles; }
+
+  //! Returns size of triangulation data in bytes for the given header.
+  Standard_EXPORT static int64_t DataSize (const Standard_Integer theNbNodes,
+                                           const Standard_Integer theNbTris,
+                                           const Standard_Boolean theHasUV,
+                                           const Standard_Boolean theHasNormals);
+
+protected:
+
+  //! Loads triangulation data from the file using specified shared input file system.
+  Standard_EXPORT virtual Standard_Boolean loadDeferredData (const Handle(OSD_FileSystem)& theFileSystem,
+                                                             const Handle(Poly_Triangulation)& theDestTriangulation) const Standard_OVERRIDE;
+
+protected:
+
+  TCollection_AsciiString myFile;
+  int64_t                 myOffset;
+  Standard_Integer        myNbDefNodes;
+  Standard_Integer        myNbDefTriangles;
+  Standard_Boolean        myHasUV;
+  Standard_Boolean        myHasNormals;
+
+};
+
+DEFINE_STANDARD_HANDLE(BinTools_TriangulationSource, Poly_Triangulation)
+
+#endif // _BinTools_TriangulationSource_HeaderFile
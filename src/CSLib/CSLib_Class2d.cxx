@@ -24,6 +24,74 @@ static inline
 			    const Standard_Real umin,
 			    const Standard_Real umaxmumin);
 
+namespace
+{
+  //! Minimal number of the segments of the polygon to build the slabs
+  static const Standard_Integer THE_MIN_NB_SEGMENTS_FOR_SLABS = 64;
+
+  //! Maximal number of the slabs
+  static const Standard_Integer THE_MAX_NB_SLABS = 1024;
+
+  //! Returns 1 if the segment [i, i+1] of the polygon is crossed by the
+  //! horizontal ray started from the point (Px, Py) in positive direction.
+  inline Standard_Integer SegmentCrossing (const TColStd_Array1OfReal& theX,
+                                           const TColStd_Array1OfReal& theY,
+                                           const Standard_Integer      i,
+                                           const Standard_Real         Px,
+                                           const Standard_Real         Py)
+  {
+    const Standard_Real x  = theX.Value(i)   - Px;
+    const Standard_Real y  = theY.Value(i)   - Py;
+    const Standard_Real nx = theX.Value(i+1) - Px;
+    const Standard_Real ny = theY.Value(i+1) - Py;
+    const Standard_Integer SH = (y<0.)? -1 : 1;
+    const Standard_Integer NH = (ny<0.)? -1 : 1;
+    if(NH!=SH) { 
+      if(x>0. && nx>0.) {
+        return 1;
+      }
+      if(x>0. || nx>0.) { 
+        if((x-y*(nx-x)/(ny-y))>0.) {
+          return 1;
+        }
+      }
+    }
+    return 0;
+  }
+
+  //! Same as above + test on ON (returns -1 in this case).
+  inline Standard_Integer SegmentCrossingOrOn (const TColStd_Array1OfReal& theX,
+                                               const TColStd_Array1OfReal& theY,
+                                               const Standard_Integer      i,
+                                               const Standard_Real         Px,
+                                               const Standard_Real         Py,
+                                               const Standard_Real         Tolu,
+                                               const Standard_Real         Tolv)
+  {
+    const Standard_Integer ip1 = i + 1;
+    const Standard_Real nx = theX.Value(ip1) - Px;
+    const Standard_Real ny = theY.Value(ip1) - Py;
+    //-- le 14 oct 97 
+    if(nx<Tolu && nx>-Tolu && ny<Tolv && ny>-Tolv) { 
+      return -1;
+    }
+    //find Y coordinate of polyline for current X gka
+    //in order to detect possible status ON
+    Standard_Real aDx = (theX.Value(ip1) - theX.Value(i));
+    if( (theX.Value(i) - Px) * nx < 0.)
+    {
+      Standard_Real aCurPY = theY.Value(ip1) - (theY.Value(ip1) - theY.Value(i))/aDx *nx;
+      Standard_Real aDeltaY = aCurPY - Py;
+      if(aDeltaY >= -Tolv && aDeltaY <= Tolv)
+      {
+        return -1;
+      }
+    }
+    //
+    return SegmentCrossing (theX, theY, i, Px, Py);
+  }
+}
+
 //=======================================================================
 //function : Init
 //purpose  :
@@ -35,12 +103,16 @@ void CSLib_Class2d::Init(const TCol_Containers2d& TP2d,
                  const Standard_Real umin,
                  const Standard_Real vmin,
                  const Standard_Real umax,
-                 const Standard_Real vmax)
+                 const Standard_Real vmax,
+                 const Standard_Boolean theToUseSlabs)
 {
   Umin = umin;
   Vmin = vmin;
   Umax = umax;
   Vmax = vmax;
+  MySlabFirst.Nullify();
+  MySlabSegments.Nullify();
+  MySlabYMin = MySlabYMax = MySlabInvStep = 0.;
   //
   if ((umax <= umin) || (vmax <= vmin) || (TP2d.Length() < 3))
   {
@@ -81,9 +153,92 @@ void CSLib_Class2d::Init(const TCol_Containers2d& TP2d,
     {
       Tolv /= dv;
     }
+    //
+    if (theToUseSlabs)
+    {
+      InitSlabs();
+    }
   }
 }
 
+//=======================================================================
+//function : InitSlabs
+//purpose  : 
+//=======================================================================
+void CSLib_Class2d::InitSlabs()
+{
+  if (N < THE_MIN_NB_SEGMENTS_FOR_SLABS)
+  {
+    return;
+  }
+  //
+  const TColStd_Array1OfReal& aY = *MyPnts2dY;
+  Standard_Real aYMin = aY.Value(0), aYMax = aY.Value(0);
+  for (Standard_Integer i = 1; i < N; ++i)
+  {
+    aYMin = Min (aYMin, aY.Value(i));
+    aYMax = Max (aYMax, aY.Value(i));
+  }
+  //
+  // The segments are extended by tolerance to detect the ON state,
+  // and by small value to cover the round-off errors of the interpolation.
+  const Standard_Real aDelta = Tolv + 1.e-9 * Max (1., Max (Abs (aYMin), Abs (aYMax)));
+  MySlabYMin = aYMin - aDelta;
+  MySlabYMax = aYMax + aDelta;
+  const Standard_Integer aNbSlabs = Min (N / 4, THE_MAX_NB_SLABS);
+  MySlabInvStep = aNbSlabs / (MySlabYMax - MySlabYMin);
+  //
+  // count the segments in each slab
+  MySlabFirst = new TColStd_Array1OfInteger (0, aNbSlabs);
+  TColStd_Array1OfInteger& aFirst = *MySlabFirst;
+  aFirst.Init (0);
+  for (Standard_Integer i = 0; i < N; ++i)
+  {
+    const Standard_Integer aS1 = SlabIndex (Min (aY.Value(i), aY.Value(i+1)) - aDelta);
+    const Standard_Integer aS2 = SlabIndex (Max (aY.Value(i), aY.Value(i+1)) + aDelta);
+    for (Standard_Integer k = aS1; k <= aS2; ++k)
+    {
+      ++aFirst.ChangeValue(k + 1);
+    }
+  }
+  for (Standard_Integer k = 1; k <= aNbSlabs; ++k)
+  {
+    aFirst.ChangeValue(k) += aFirst.Value(k - 1);
+  }
+  //
+  // fill the slabs
+  MySlabSegments = new TColStd_Array1OfInteger (0, Max (aFirst.Last() - 1, 0));
+  TColStd_Array1OfInteger aNext (0, aNbSlabs - 1);
+  for (Standard_Integer k = 0; k < aNbSlabs; ++k)
+  {
+    aNext.ChangeValue(k) = aFirst.Value(k);
+  }
+  for (Standard_Integer i = 0; i < N; ++i)
+  {
+    const Standard_Integer aS1 = SlabIndex (Min (aY.Value(i), aY.Value(i+1)) - aDelta);
+    const Standard_Integer aS2 = SlabIndex (Max (aY.Value(i), aY.Value(i+1)) + aDelta);
+    for (Standard_Integer k = aS1; k <= aS2; ++k)
+    {
+      MySlabSegments->ChangeValue (aNext.ChangeValue(k)++) = i;
+    }
+  }
+}
+
+//=======================================================================
+//function : SlabIndex
+//purpose  : 
+//=======================================================================
+Standard_Integer CSLib_Class2d::SlabIndex (const Standard_Real theY) const
+{
+  if (theY < MySlabYMin || theY > MySlabYMax)
+  {
+    return -1;
+  }
+  const Standard_Integer aNbSlabs = MySlabFirst->Upper();
+  const Standard_Integer anIndex = (Standard_Integer )((theY - MySlabYMin) * MySlabInvStep);
+  return Min (anIndex, aNbSlabs - 1);
+}
+
 //=======================================================================
 //function : CSLib_Class2d
 //purpose  : 
@@ -94,10 +249,11 @@ CSLib_Class2d::CSLib_Class2d(const TColgp_Array1OfPnt2d& thePnts2d,
                              const Standard_Real theUMin,
                              const Standard_Real theVMin,
                              const Standard_Real theUMax,
-                             const Standard_Real theVMax)
+                             const Standard_Real theVMax,
+                             const Standard_Boolean theToUseSlabs)
 {
   Init(thePnts2d, theTolU, theTolV, theUMin,
-       theVMin, theUMax, theVMax);
+       theVMin, theUMax, theVMax, theToUseSlabs);
 }
 
 //=======================================================================
@@ -110,10 +266,11 @@ CSLib_Class2d::CSLib_Class2d(const TColgp_SequenceOfPnt2d& thePnts2d,
                              const Standard_Real theUMin,
                              const Standard_Real theVMin,
                              const Standard_Real theUMax,
-                             const Standard_Real theVMax)
+                             const Standard_Real theVMax,
+                             const Standard_Boolean theToUseSlabs)
 {
   Init(thePnts2d, theTolU, theTolV, theUMin,
-       theVMin, theUMax, theVMax);
+       theVMin, theUMax, theVMax, theToUseSlabs);
 }
 
 //=======================================================================
@@ -200,35 +357,24 @@ Standard_Integer CSLib_Class2d::SiDans_OnMode(const gp_Pnt2d& P,
 Standard_Integer CSLib_Class2d::InternalSiDans(const Standard_Real Px,
 					       const Standard_Real Py) const
 { 
-  Standard_Integer nbc, i, ip1, SH, NH;
-  Standard_Real  x, y, nx, ny;
-  //
-  nbc = 0;
-  i   = 0;
-  ip1 = 1;
-  x   = (MyPnts2dX->Value(i)-Px);
-  y   = (MyPnts2dY->Value(i)-Py);
-  SH  = (y<0.)? -1 : 1;
+  const TColStd_Array1OfReal& aX = *MyPnts2dX;
+  const TColStd_Array1OfReal& aY = *MyPnts2dY;
+  Standard_Integer nbc = 0;
   //
-  for(i=0; i<N ; i++,ip1++) { 
-    nx = MyPnts2dX->Value(ip1) - Px;
-    ny = MyPnts2dY->Value(ip1) - Py;
-    
-    NH = (ny<0.)? -1 : 1;
-    if(NH!=SH) { 
-      if(x>0. && nx>0.) {
-	nbc++;
-      }
-      else { 
-	if(x>0.0 || nx>0.) { 
-	  if((x-y*(nx-x)/(ny-y))>0.) {
-	    nbc++;
-	  }
-	}
-      }
-      SH = NH;
+  if (MySlabFirst.IsNull()) {
+    for(Standard_Integer i=0; i<N ; i++) { 
+      nbc += SegmentCrossing (aX, aY, i, Px, Py);
+    }
+  }
+  else {
+    // only the segments of the slab may be crossed by the ray
+    const Standard_Integer aSlab = SlabIndex (Py);
+    if (aSlab < 0) {
+      return 0;
+    }
+    for (Standard_Integer j = MySlabFirst->Value(aSlab); j < MySlabFirst->Value(aSlab + 1); j++) {
+      nbc += SegmentCrossing (aX, aY, MySlabSegments->Value(j), Px, Py);
     }
-    x = nx; y = ny;
   }
   return(nbc&1);
 }
@@ -240,67 +386,34 @@ Standard_Integer CSLib_Class2d::InternalSiDans(const Standard_Real Px,
 Standard_Integer CSLib_Class2d::InternalSiDansOuOn(const Standard_Real Px,
 						   const Standard_Real Py) const 
 { 
-  Standard_Integer nbc, i, ip1, SH, NH, iRet;
-  Standard_Real x, y, nx, ny, aX;
-  Standard_Real aYmin;
+  const TColStd_Array1OfReal& aX = *MyPnts2dX;
+  const TColStd_Array1OfReal& aY = *MyPnts2dY;
+  Standard_Integer nbc = 0, aRes;
   //
-  nbc = 0;
-  i   = 0;
-  ip1 = 1;
-  x   = (MyPnts2dX->Value(i)-Px);
-  y   = (MyPnts2dY->Value(i)-Py);
-  aYmin=y;
-  SH  = (y<0.)? -1 : 1;
-  for(i=0; i<N ; i++, ip1++) { 
-   
-    nx = MyPnts2dX->Value(ip1) - Px;
-    ny = MyPnts2dY->Value(ip1) - Py;
-    //-- le 14 oct 97 
-    if(nx<Tolu && nx>-Tolu && ny<Tolv && ny>-Tolv) { 
-      iRet=-1;
-      return iRet;
-    }
-    //find Y coordinate of polyline for current X gka
-    //in order to detect possible status ON
-    Standard_Real aDx = (MyPnts2dX->Value(ip1) - MyPnts2dX->Value(ip1-1));
-    if( (MyPnts2dX->Value(ip1-1) - Px) * nx < 0.)
-    {
-     
-      Standard_Real aCurPY = MyPnts2dY->Value(ip1) - (MyPnts2dY->Value(ip1) - MyPnts2dY->Value(ip1-1))/aDx *nx;
-      Standard_Real aDeltaY = aCurPY - Py;
-      if(aDeltaY >= -Tolv && aDeltaY <= Tolv)
-      {
-         iRet=-1;
-         return iRet;
+  if (MySlabFirst.IsNull()) {
+    for(Standard_Integer i=0; i<N ; i++) { 
+      aRes = SegmentCrossingOrOn (aX, aY, i, Px, Py, Tolu, Tolv);
+      if (aRes < 0) {
+        return -1;
       }
+      nbc += aRes;
     }
-    //
-      
-    NH = (ny<0.)? -1 : 1;
-    if(NH!=SH) { 
-      if(x>0. && nx>0.) {
-	nbc++;
-      }
-      else { 
-	if(x>0. || nx>0.) { 
-	  aX=x-y*(nx-x)/(ny-y);
-	  if(aX>0.){
-	    nbc++;
-	  }
-	}
-      }
-      SH = NH;
+  }
+  else {
+    // only the segments of the slab may be crossed by the ray or contain the point
+    const Standard_Integer aSlab = SlabIndex (Py);
+    if (aSlab < 0) {
+      return 0;
     }
-    else {// y has same sign as ny  
-      if (ny<aYmin) {
-	aYmin=ny;
+    for (Standard_Integer j = MySlabFirst->Value(aSlab); j < MySlabFirst->Value(aSlab + 1); j++) {
+      aRes = SegmentCrossingOrOn (aX, aY, MySlabSegments->Value(j), Px, Py, Tolu, Tolv);
+      if (aRes < 0) {
+        return -1;
       }
+      nbc += aRes;
     }
-    x = nx; y = ny; 
-  }// for(i=0; i<N ; i++,ip1++) { 
- 
-  iRet=nbc&1;
-  return iRet;
+  }
+  return(nbc&1);
 }
 //modified by NIZNHY-PKV Fri Jan 15 09:03:55 2010t
 //=======================================================================
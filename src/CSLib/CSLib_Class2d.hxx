@@ -23,6 +23,7 @@
 
 #include <TColgp_Array1OfPnt2d.hxx>
 #include <NCollection_Handle.hxx>
+#include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_Array1OfReal.hxx>
 #include <TColgp_SequenceOfPnt2d.hxx>
 
@@ -47,13 +48,16 @@ public:
     //! theTolu and theTolv are tolerances.
     //! theUmin, theVmin, theUmax, theVmax are
     //! UV-bounds of the polygon.
+    //! theToUseSlabs enables the index of the segments by slabs;
+    //! the index does not change the result of the classification.
     Standard_EXPORT CSLib_Class2d(const TColgp_Array1OfPnt2d& thePnts2d,
                                   const Standard_Real theTolU,
                                   const Standard_Real theTolV,
                                   const Standard_Real theUMin,
                                   const Standard_Real theVMin,
                                   const Standard_Real theUMax,
-                                  const Standard_Real theVMax);
+                                  const Standard_Real theVMax,
+                                  const Standard_Boolean theToUseSlabs = Standard_True);
 
   //! Constructs the 2D-polygon.
   //! thePnts2d is the set of the vertices (closed polygon
@@ -63,13 +67,16 @@ public:
   //! theTolu and theTolv are tolerances.
   //! theUmin, theVmin, theUmax, theVmax are
   //! UV-bounds of the polygon.
+  //! theToUseSlabs enables the index of the segments by slabs;
+  //! the index does not change the result of the classification.
   Standard_EXPORT CSLib_Class2d(const TColgp_SequenceOfPnt2d& thePnts2d,
                                 const Standard_Real theTolU,
                                 const Standard_Real theTolV,
                                 const Standard_Real theUMin,
                                 const Standard_Real theVMin,
                                 const Standard_Real theUMax,
-                                const Standard_Real theVMax);
+                                const Standard_Real theVMax,
+                                const Standard_Boolean theToUseSlabs = Standard_True);
 
   Standard_EXPORT Standard_Integer SiDans (const gp_Pnt2d& P) const;
   
@@ -92,7 +99,17 @@ private:
                           const Standard_Real umin,
                           const Standard_Real vmin,
                           const Standard_Real umax,
-                          const Standard_Real vmax);
+                          const Standard_Real vmax,
+                          const Standard_Boolean theToUseSlabs);
+
+  //! Builds the index of the segments of the polygon by horizontal slabs,
+  //! so that only the segments which may be crossed by the horizontal ray
+  //! started from the point are checked during classification.
+  void InitSlabs();
+
+  //! Returns the index of the slab containing the given (transformed) V coordinate,
+  //! or -1 if there are no segments close to this coordinate.
+  Standard_Integer SlabIndex (const Standard_Real theY) const;
 
   //! Assign operator is forbidden
   const CSLib_Class2d& operator= (const CSLib_Class2d& Other) const;
@@ -105,6 +122,11 @@ private:
   Standard_Real Vmin;
   Standard_Real Umax;
   Standard_Real Vmax;
+  NCollection_Handle <TColStd_Array1OfInteger> MySlabFirst;    //!< first segment of each slab in MySlabSegments
+  NCollection_Handle <TColStd_Array1OfInteger> MySlabSegments; //!< indices of the segments of the slabs
+  Standard_Real MySlabYMin;                                    //!< lower bound of the first slab
+  Standard_Real MySlabYMax;                                    //!< upper bound of the last slab
+  Standard_Real MySlabInvStep;                                 //!< inverted height of the slab
 
 
 };
@@ -30,12 +30,16 @@
 #include <ChFiDS_SurfData.hxx>
 #include <Geom2d_Curve.hxx>
 #include <gp_Pnt2d.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <ShapeFix.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_NotImplemented.hxx>
 #include <TColStd_ListIteratorOfListOfInteger.hxx>
+#include <TColStd_ListOfInteger.hxx>
 #include <TColStd_MapOfInteger.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 #include <TopExp_Explorer.hxx>
@@ -176,6 +180,137 @@ void ChFi3d_Builder::ExtentAnalyse ()
   }
 }
 
+namespace
+{
+  //! Functor checking the intersections between the fillets of the stripe
+  //! and the fillets of the following stripes sharing the faces with it (OCC119).
+  //! The check only reads the stripes, so the stripes are processed in parallel.
+  class ChFi3d_StripeInterFunctor
+  {
+  public:
+    ChFi3d_StripeInterFunctor (const NCollection_Array1<Handle(ChFiDS_Stripe)>& theStripes,
+                               const NCollection_Array1<TColStd_ListOfInteger>& theCandidates,
+                               TopOpeBRepDS_DataStructure&                      theDS,
+                               const Standard_Real                              theTol2d,
+                               NCollection_Array1<Standard_Boolean>&            theIsBad)
+    : myStripes (theStripes),
+      myCandidates (theCandidates),
+      myDS (theDS),
+      myTol2d (theTol2d),
+      myIsBad (theIsBad)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      for (TColStd_ListIteratorOfListOfInteger anIt (myCandidates (theIndex)); anIt.More(); anIt.Next())
+      {
+        try
+        {
+          OCC_CATCH_SIGNALS
+          ChFi3d_StripeEdgeInter (myStripes (theIndex), myStripes (anIt.Value()), myDS, myTol2d);
+        }
+        catch (Standard_Failure const& anException)
+        {
+#ifdef OCCT_DEBUG
+          std::cout << "EXCEPTION Fillets compute " << anException << std::endl;
+#endif
+          (void)anException;
+          myIsBad (theIndex) = Standard_True;
+          break;
+        }
+      }
+    }
+
+  private:
+    ChFi3d_StripeInterFunctor& operator= (const ChFi3d_StripeInterFunctor&);
+
+  private:
+    const NCollection_Array1<Handle(ChFiDS_Stripe)>& myStripes;
+    const NCollection_Array1<TColStd_ListOfInteger>& myCandidates;
+    TopOpeBRepDS_DataStructure& myDS;
+    const Standard_Real myTol2d;
+    NCollection_Array1<Standard_Boolean>& myIsBad;
+  };
+
+  //=======================================================================
+  //function : stripeCandidates
+  //purpose  : For each stripe finds the following stripes which may have
+  //           intersecting fillets, i.e. the stripes with fillets lying
+  //           on the same faces. The fillets of the other stripes are not
+  //           intersected by ChFi3d_StripeEdgeInter.
+  //=======================================================================
+  void stripeCandidates (const NCollection_Array1<Handle(ChFiDS_Stripe)>& theStripes,
+                         NCollection_Array1<TColStd_ListOfInteger>&       theCandidates)
+  {
+    const Standard_Integer aNbStripes = theStripes.Upper();
+    NCollection_DataMap<Standard_Integer, TColStd_ListOfInteger> aFaceStripes;
+    TColStd_MapOfInteger aNoDataStripes;
+    for (Standard_Integer i = 1; i <= aNbStripes; ++i)
+    {
+      const Handle(ChFiDS_HData)& aData = theStripes (i)->SetOfSurfData();
+      if (aData.IsNull())
+      {
+        aNoDataStripes.Add (i);
+        continue;
+      }
+      for (Standard_Integer iPart = 1; iPart <= aData->Length(); ++iPart)
+      {
+        const Handle(ChFiDS_SurfData)& aDat = aData->Value (iPart);
+        const Standard_Integer aFaces[2] = { aDat->IndexOfS1(), aDat->IndexOfS2() };
+        for (Standard_Integer k = 0; k < 2; ++k)
+        {
+          TColStd_ListOfInteger* aList = aFaceStripes.ChangeSeek (aFaces[k]);
+          if (aList == NULL)
+          {
+            aList = aFaceStripes.Bound (aFaces[k], TColStd_ListOfInteger());
+          }
+          if (aList->IsEmpty() || aList->Last() != i)
+          {
+            aList->Append (i);
+          }
+        }
+      }
+    }
+
+    for (Standard_Integer i = 1; i <= aNbStripes; ++i)
+    {
+      TColStd_ListOfInteger& aCandidates = theCandidates (i);
+      TColStd_MapOfInteger aMap;
+      const Handle(ChFiDS_HData)& aData = theStripes (i)->SetOfSurfData();
+      // The stripes without fillets are checked against all others as before
+      for (Standard_Integer j = i + 1; j <= aNbStripes; ++j)
+      {
+        if (aData.IsNull() || aNoDataStripes.Contains (j))
+        {
+          aCandidates.Append (j);
+          aMap.Add (j);
+        }
+      }
+      if (aData.IsNull())
+      {
+        continue;
+      }
+
+      for (Standard_Integer iPart = 1; iPart <= aData->Length(); ++iPart)
+      {
+        const Handle(ChFiDS_SurfData)& aDat = aData->Value (iPart);
+        const Standard_Integer aFaces[2] = { aDat->IndexOfS1(), aDat->IndexOfS2() };
+        for (Standard_Integer k = 0; k < 2; ++k)
+        {
+          for (TColStd_ListIteratorOfListOfInteger anIt (aFaceStripes (aFaces[k])); anIt.More(); anIt.Next())
+          {
+            const Standard_Integer j = anIt.Value();
+            if (j > i && aMap.Add (j))
+            {
+              aCandidates.Append (j);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
 //=======================================================================
 //function : Compute
 //purpose  : 
@@ -302,38 +437,31 @@ void  ChFi3d_Builder::Compute()
     MapIndSo.Add(indcursh);
   }
   if (done) {
-    Standard_Integer i1;
-    for (itel.Initialize(myListStripe), i1=0;
-	 itel.More(); 
-	 itel.Next(), i1++) {
-      const Handle(ChFiDS_Stripe)& st = itel.Value();
-      // 05/02/02 akm vvv : (OCC119) First we'll check ain't there 
-      //                    intersections between fillets
-      ChFiDS_ListIteratorOfListOfStripe itel1;
-      Standard_Integer i2;
-      for (itel1.Initialize(myListStripe), i2=0;
-	   itel1.More(); 
-	   itel1.Next(), i2++) {
-	if (i2 <= i1)
-	  // Do not twice intersect the stripes
-	  continue;
-	Handle(ChFiDS_Stripe) aCheckStripe = itel1.Value();
-	try {
-	  OCC_CATCH_SIGNALS
-	  ChFi3d_StripeEdgeInter (st, aCheckStripe, DStr, tol2d);
-	}
-	catch(Standard_Failure const& anException) {
-#ifdef OCCT_DEBUG
-	  std::cout <<"EXCEPTION Fillets compute " << anException << std::endl;
-#endif
-	  (void)anException;
-	  badstripes.Append(itel.Value());
-	  hasresult=Standard_False;
-	  done = Standard_False;
-	  break;
-	}
+    // 05/02/02 akm vvv : (OCC119) First we'll check ain't there 
+    //                    intersections between fillets.
+    // Only the stripes with fillets on the same faces may intersect,
+    // so each stripe is checked against such stripes only, and the
+    // independent stripes are checked simultaneously.
+    const Standard_Integer aNbStripes = myListStripe.Extent();
+    NCollection_Array1<Handle(ChFiDS_Stripe)> aStripes (1, aNbStripes);
+    Standard_Integer i1 = 1;
+    for (itel.Initialize(myListStripe); itel.More(); itel.Next(), i1++)
+      aStripes (i1) = itel.Value();
+    NCollection_Array1<TColStd_ListOfInteger> aCandidates (1, aNbStripes);
+    stripeCandidates (aStripes, aCandidates);
+    NCollection_Array1<Standard_Boolean> anIsBad (1, aNbStripes);
+    anIsBad.Init (Standard_False);
+    ChFi3d_StripeInterFunctor aFunctor (aStripes, aCandidates, DStr, tol2d, anIsBad);
+    OSD_Parallel::For (1, aNbStripes + 1, aFunctor, !myIsParallel);
+    // 05/02/02 akm ^^^
+
+    for (i1 = 1; i1 <= aNbStripes; i1++) {
+      const Handle(ChFiDS_Stripe)& st = aStripes (i1);
+      if (anIsBad (i1)) {
+	badstripes.Append(st);
+	hasresult=Standard_False;
+	done = Standard_False;
       }
-      // 05/02/02 akm ^^^
       Standard_Integer solidindex = st->SolidIndex();
       ChFi3d_FilDS(solidindex,st,DStr,myRegul,tolesp,tol2d);
       if (!done) break;
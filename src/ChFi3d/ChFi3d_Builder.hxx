@@ -136,6 +136,15 @@ public:
   //! returns True if the computation  is  success
   Standard_EXPORT Standard_Boolean IsDone() const;
   
+  //! Sets the flag of parallel processing.
+  //! In parallel mode the check of the intersections
+  //! between the fillets is performed for the independent
+  //! stripes simultaneously.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+  
+  //! Returns the flag of parallel processing.
+  Standard_Boolean IsRunParallel() const { return myIsParallel; }
+  
   //! if (Isdone()) makes the result.
   //! if (!Isdone())
   Standard_EXPORT TopoDS_Shape Shape() const;
@@ -772,6 +781,7 @@ protected:
   TopTools_DataMapOfShapeShape myEdgeFirstFace;
   Standard_Boolean done;
   Standard_Boolean hasresult;
+  Standard_Boolean myIsParallel;
 
 
 private:
@@ -316,7 +316,7 @@ static TopOpeBRepDS_BuildTool mkbuildtool()
 //=======================================================================
 ChFi3d_Builder::ChFi3d_Builder(const TopoDS_Shape& S,
 			       const Standard_Real Ta) :  
-   done(Standard_False), myShape(S)
+   done(Standard_False), myIsParallel(Standard_False), myShape(S)
 {
   myDS = new TopOpeBRepDS_HDataStructure();
   myCoup = new TopOpeBRepBuild_HBuilder(mkbuildtool());
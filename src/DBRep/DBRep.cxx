@@ -1440,6 +1440,10 @@ static Standard_Integer writebrep (Draw_Interpretor& theDI,
   Standard_Boolean isBinaryFormat(Standard_False);
   Standard_Boolean isWithTriangles(Standard_True);
   Standard_Boolean isWithNormals(Standard_False);
+  Standard_Boolean toCompress(Standard_False);
+  Standard_Boolean toRunParallel(Standard_False);
+  Standard_Boolean isUnbuffered(Standard_False);
+  Standard_Real aNodesPrecision = 0.0;
   if (!strcasecmp (theArgVec[0], "binsave"))
   {
     isBinaryFormat = Standard_True;
@@ -1477,6 +1481,28 @@ static Standard_Integer writebrep (Draw_Interpretor& theDI,
         isWithNormals = !isWithNormals;
       }
     }
+    else if (aParam == "-compress")
+    {
+      toCompress = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aParam == "-parallel")
+    {
+      toRunParallel = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aParam == "-unbuffered")
+    {
+      isUnbuffered = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aParam == "-precision"
+          && anArgIter + 1 < theNbArgs)
+    {
+      aNodesPrecision = Draw::Atof (theArgVec[++anArgIter]);
+      if (aNodesPrecision < 0.0)
+      {
+        theDI << "Syntax error: negative precision";
+        return 1;
+      }
+    }
     else if (aShapeName.IsEmpty())
     {
       aShapeName = theArgVec[anArgIter];
@@ -1518,11 +1544,18 @@ static Standard_Integer writebrep (Draw_Interpretor& theDI,
       theDI << "Error: vertex normals require binary format version 4 or later";
       return 1;
     }
+    if ((toCompress || aNodesPrecision > 0.0)
+      && aVersion < BinTools_FormatVersion_VERSION_6)
+    {
+      theDI << "Error: compact encoding requires binary format version 6 or later";
+      return 1;
+    }
 
     BinTools_FormatVersion aBinToolsVersion = aVersion > 0
                                             ? static_cast<BinTools_FormatVersion> (aVersion)
                                             : BinTools_FormatVersion_CURRENT;
-    if (!BinTools::Write (aShape, aFileName.ToCString(), isWithTriangles, isWithNormals, aBinToolsVersion, aProgress->Start()))
+    if (!BinTools::Write (aShape, aFileName.ToCString(), isWithTriangles, isWithNormals, aBinToolsVersion,
+                          aNodesPrecision, toCompress, toRunParallel, aProgress->Start()))
     {
       theDI << "Cannot write to the file " << aFileName;
       return 1;
@@ -1546,7 +1579,28 @@ static Standard_Integer writebrep (Draw_Interpretor& theDI,
     TopTools_FormatVersion aTopToolsVersion = aVersion > 0
                                             ? static_cast<TopTools_FormatVersion> (aVersion)
                                             : TopTools_FormatVersion_CURRENT;
-    if (!BRepTools::Write (aShape, aFileName.ToCString(), isWithTriangles, isWithNormals, aTopToolsVersion, aProgress->Start()))
+    if (isUnbuffered)
+    {
+      // formatted output directly into the stream flushed after each value
+      const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+      std::shared_ptr<std::ostream> aStream = aFileSystem->OpenOStream (aFileName, std::ios::out | std::ios::binary);
+      if (aStream.get() == NULL || !aStream->good())
+      {
+        theDI << "Cannot write to the file " << aFileName;
+        return 1;
+      }
+
+      *aStream << "DBRep_DrawableShape\n";
+      aStream->setf (std::ios::unitbuf);
+      BRepTools::Write (aShape, *aStream, isWithTriangles, isWithNormals, aTopToolsVersion, aProgress->Start());
+      aStream->flush();
+      if (!aStream->good())
+      {
+        theDI << "Cannot write to the file " << aFileName;
+        return 1;
+      }
+    }
+    else if (!BRepTools::Write (aShape, aFileName.ToCString(), isWithTriangles, isWithNormals, aTopToolsVersion, aProgress->Start()))
     {
       theDI << "Cannot write to the file " << aFileName;
       return 1;
@@ -1563,7 +1617,7 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
                                   Standard_Integer theNbArgs,
                                   const char** theArgVec)
 {
-  if (theNbArgs != 3)
+  if (theNbArgs < 3)
   {
     theDI << "Syntax error: wrong number of arguments";
     return 1;
@@ -1571,6 +1625,26 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
 
   Standard_CString aFileName  = theArgVec[1];
   Standard_CString aShapeName = theArgVec[2];
+  bool isDeferred = false;
+  bool toRunParallel = false;
+  for (Standard_Integer anArgIter = 3; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArg (theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-deferred")
+    {
+      isDeferred = true;
+    }
+    else if (anArg == "-parallel")
+    {
+      toRunParallel = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else
+    {
+      theDI << "Syntax error: unknown argument '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
   bool isBinaryFormat = true;
   {
     // probe file header to recognize format
@@ -1596,7 +1670,7 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
   TopoDS_Shape aShape;
   if (isBinaryFormat)
   {
-    if (!BinTools::Read (aShape, aFileName, aProgress->Start()))
+    if (!BinTools::Read (aShape, aFileName, isDeferred, toRunParallel, aProgress->Start()))
     {
       theDI << "Error: cannot read from the file '" << aFileName << "'";
       return 1;
@@ -1604,6 +1678,10 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
   }
   else
   {
+    if (isDeferred)
+    {
+      theDI << "Warning: deferred loading of triangulations is not supported by the ASCII format, option -deferred is ignored\n";
+    }
     if (!BRepTools::Read (aShape, aFileName, BRep_Builder(), aProgress->Start()))
     {
       theDI << "Error: cannot read from the file '" << aFileName << "'";
@@ -1719,18 +1797,36 @@ void  DBRep::BasicCommands(Draw_Interpretor& theCommands)
   theCommands.Add("writebrep",
                   "writebrep shape filename [-binary {0|1}]=0 [-version Version]=4"
                   "\n\t\t:                          [-triangles {0|1}]=1 [-normals {0|1}]=0"
+                  "\n\t\t:                          [-precision Value]=0 [-compress {0|1}]=0"
+                  "\n\t\t:                          [-parallel {0|1}]=0 [-unbuffered {0|1}]=0"
                   "\n\t\t: Save the shape in the ASCII (default) or binary format file."
                   "\n\t\t:  -binary  write into the binary format (ASCII when unspecified)"
                   "\n\t\t:  -version a number of format version to save;"
                   "\n\t\t:           ASCII  versions: 1, 2 and 3    (3 for ASCII  when unspecified);"
-                  "\n\t\t:           Binary versions: 1, 2, 3 and 4 (4 for Binary when unspecified)."
+                  "\n\t\t:           Binary versions: 1, 2, 3, 4, 5 and 6 (4 for Binary when unspecified);"
+                  "\n\t\t:           version 5 allows parallel writing and reading of geometry and triangulations;"
+                  "\n\t\t:           version 6 encodes triangulations compactly (triangulations are always read immediately)."
                   "\n\t\t:  -triangles write triangulation data (TRUE when unspecified)."
                   "\n\t\t:           Ignored (always written) if face defines only triangulation (no surface)."
-                  "\n\t\t:  -normals include vertex normals while writing triangulation data (FALSE when unspecified).",
+                  "\n\t\t:  -normals include vertex normals while writing triangulation data (FALSE when unspecified)."
+                  "\n\t\t:  -precision quantize triangulation nodes and normals with specified precision"
+                  "\n\t\t:           (0, lossless, when unspecified); binary version 6 only."
+                  "\n\t\t:  -compress compress the tables of geometry and triangulations (FALSE when unspecified);"
+                  "\n\t\t:           binary version 6 only."
+                  "\n\t\t:  -parallel write the tables of geometry and triangulations in parallel threads"
+                  "\n\t\t:           (FALSE when unspecified); binary version 5 and later only."
+                  "\n\t\t:  -unbuffered format the values directly into the file stream flushed after each value"
+                  "\n\t\t:           (FALSE when unspecified); ASCII format only. This option is intended"
+                  "\n\t\t:           for checking that the output is equal to the one of buffered writing.",
                   __FILE__, writebrep, g);
   theCommands.Add("readbrep",
-                  "readbrep filename shape"
-                  "\n\t\t: Restore the shape from the binary or ASCII format file.",
+                  "readbrep filename shape [-deferred] [-parallel {0|1}]=0"
+                  "\n\t\t: Restore the shape from the binary or ASCII format file."
+                  "\n\t\t:  -deferred do not read triangulation data from the binary file, but"
+                  "\n\t\t:            only keep the reference to it to load later by 'trlateload' command;"
+                  "\n\t\t:            ignored with a warning for the ASCII file."
+                  "\n\t\t:  -parallel read the tables of geometry and triangulations in parallel threads"
+                  "\n\t\t:            (FALSE when unspecified); binary version 5 and later only.",
                   __FILE__, readbrep, g);
   theCommands.Add("binsave", "binsave shape filename", __FILE__, writebrep, g);
   theCommands.Add("binrestore",
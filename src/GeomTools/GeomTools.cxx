@@ -91,6 +91,144 @@ Handle(GeomTools_UndefinedTypeHandler) GeomTools::GetUndefinedTypeHandler()
   return theActiveHandler;
 }
 
+namespace
+{
+  //! Powers of 10 exactly represented by Standard_Real.
+  static const Standard_Real THE_POWERS_OF_TEN[] =
+  {
+    1.0e0,  1.0e1,  1.0e2,  1.0e3,  1.0e4,  1.0e5,  1.0e6,  1.0e7,  1.0e8,  1.0e9,  1.0e10, 1.0e11,
+    1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22
+  };
+
+  //! Returns TRUE for the whitespace characters of classic locale.
+  static bool isSpace (const int theChar)
+  {
+    return theChar == ' ' || (theChar >= '\t' && theChar <= '\r');
+  }
+
+  //! Returns TRUE for the decimal digit.
+  static bool isDigit (const int theChar)
+  {
+    return theChar >= '0' && theChar <= '9';
+  }
+
+  //! Skips whitespaces in the stream buffer and returns the next character
+  //! (eof if the stream cannot be read further, the state of the stream is updated in this case).
+  static int skipSpaces (Standard_IStream& theStream)
+  {
+    typedef std::char_traits<char> Traits;
+    if (!theStream.good())
+    {
+      theStream.setstate (std::ios::failbit);
+      return Traits::eof();
+    }
+
+    std::streambuf* aBuffer = theStream.rdbuf();
+    int aChar = aBuffer->sgetc();
+    while (aChar != Traits::eof() && isSpace (aChar))
+    {
+      aChar = aBuffer->snextc();
+    }
+    if (aChar == Traits::eof())
+    {
+      theStream.setstate (std::ios::eofbit | std::ios::failbit);
+    }
+    return aChar;
+  }
+
+  //! Converts the decimal number with up to 15 significant digits and decimal exponent within [-22, 22].
+  //! Both the mantissa and the power of 10 are represented exactly by Standard_Real in this case,
+  //! so that a single multiplication or division gives correctly rounded result (the same as Strtod()).
+  //! @return FALSE if the string is not such a number
+  static bool parseShortDecimal (const char* theStr, Standard_Real& theValue)
+  {
+    const char* aPos = theStr;
+    const bool isNegative = *aPos == '-';
+    if (*aPos == '-' || *aPos == '+')
+    {
+      ++aPos;
+    }
+
+    uint64_t aMantissa = 0;
+    int aNbDigits = 0, anExp = 0;
+    bool hasDigits = false;
+    for (; isDigit (*aPos); ++aPos)
+    {
+      hasDigits = true;
+      if (aMantissa == 0 && *aPos == '0')
+      {
+        continue;
+      }
+      if (++aNbDigits > 15)
+      {
+        return false;
+      }
+      aMantissa = aMantissa * 10 + (*aPos - '0');
+    }
+    if (*aPos == '.')
+    {
+      for (++aPos; isDigit (*aPos); ++aPos)
+      {
+        hasDigits = true;
+        --anExp;
+        if (aMantissa == 0 && *aPos == '0')
+        {
+          continue;
+        }
+        if (++aNbDigits > 15)
+        {
+          return false;
+        }
+        aMantissa = aMantissa * 10 + (*aPos - '0');
+      }
+    }
+    if (!hasDigits)
+    {
+      return false;
+    }
+
+    if (*aPos == 'e' || *aPos == 'E')
+    {
+      ++aPos;
+      const bool isNegativeExp = *aPos == '-';
+      if (*aPos == '-' || *aPos == '+')
+      {
+        ++aPos;
+      }
+      if (!isDigit (*aPos))
+      {
+        return false;
+      }
+      int aDecExp = 0;
+      for (; isDigit (*aPos); ++aPos)
+      {
+        aDecExp = aDecExp * 10 + (*aPos - '0');
+        if (aDecExp > 1000)
+        {
+          return false;
+        }
+      }
+      anExp += isNegativeExp ? -aDecExp : aDecExp;
+    }
+    if (*aPos != '\0')
+    {
+      return false;
+    }
+
+    Standard_Real aValue = Standard_Real (aMantissa);
+    if (aMantissa != 0)
+    {
+      if (anExp < -22 || anExp > 22)
+      {
+        return false;
+      }
+      aValue = anExp < 0 ? aValue / THE_POWERS_OF_TEN[-anExp] : aValue * THE_POWERS_OF_TEN[anExp];
+    }
+    theValue = isNegative ? -aValue : aValue;
+    return true;
+  }
+}
+
 //=======================================================================
 //function : GetReal
 //purpose  : 
@@ -102,10 +240,84 @@ void GeomTools::GetReal(Standard_IStream& IS,Standard_Real& theValue)
   if (IS.eof()) 
     return;
 
+  // extract the token of up to 255 characters, as operator>> with width 256 does
   char buffer[256];
-  buffer[0] = '\0';
-  std::streamsize anOldWide = IS.width(256);
-  IS >> buffer;
-  IS.width(anOldWide);
-  theValue = Strtod(buffer, NULL);
+  int aLength = 0;
+  int aChar = skipSpaces (IS);
+  std::streambuf* aStreamBuffer = IS.rdbuf();
+  while (aChar != std::char_traits<char>::eof() && !isSpace (aChar) && aLength < 255)
+  {
+    buffer[aLength++] = char (aChar);
+    aChar = aStreamBuffer->snextc();
+  }
+  buffer[aLength] = '\0';
+  if (aLength == 0)
+  {
+    // no token up to the end of the stream, the error state is set by skipSpaces()
+    theValue = 0.0;
+    return;
+  }
+  if (aChar == std::char_traits<char>::eof())
+  {
+    IS.setstate (std::ios::eofbit);
+  }
+
+  if (!parseShortDecimal (buffer, theValue))
+  {
+    theValue = Strtod(buffer, NULL);
+  }
+}
+
+//=======================================================================
+//function : GetInteger
+//purpose  :
+//=======================================================================
+
+void GeomTools::GetInteger (Standard_IStream& IS, Standard_Integer& theValue)
+{
+  theValue = 0;
+  int aChar = skipSpaces (IS);
+  if (aChar == std::char_traits<char>::eof())
+  {
+    return;
+  }
+
+  std::streambuf* aStreamBuffer = IS.rdbuf();
+  const bool isNegative = aChar == '-';
+  if (aChar == '-' || aChar == '+')
+  {
+    aChar = aStreamBuffer->snextc();
+  }
+  if (!isDigit (aChar))
+  {
+    IS.setstate (aChar == std::char_traits<char>::eof() ? (std::ios::eofbit | std::ios::failbit) : std::ios::failbit);
+    return;
+  }
+
+  int64_t aValue = 0;
+  bool isOverflow = false;
+  for (; isDigit (aChar); aChar = aStreamBuffer->snextc())
+  {
+    aValue = aValue * 10 + (aChar - '0');
+    if (aValue > int64_t (IntegerLast()) + 1)
+    {
+      isOverflow = true;
+      aValue = int64_t (IntegerLast()) + 1;
+    }
+  }
+  if (aChar == std::char_traits<char>::eof())
+  {
+    IS.setstate (std::ios::eofbit);
+  }
+
+  aValue = isNegative ? -aValue : aValue;
+  if (isOverflow
+   || aValue > int64_t (IntegerLast())
+   || aValue < int64_t (IntegerFirst()))
+  {
+    theValue = aValue > 0 ? IntegerLast() : IntegerFirst();
+    IS.setstate (std::ios::failbit);
+    return;
+  }
+  theValue = Standard_Integer (aValue);
 }
@@ -76,9 +76,17 @@ public:
   Standard_EXPORT static Handle(GeomTools_UndefinedTypeHandler) GetUndefinedTypeHandler();
   
   //! Reads the Standard_Real value from the stream. Zero is read
-  //! in case of error
+  //! in case of error.
+  //! The value is extracted directly from the stream buffer independently on the stream locale;
+  //! numbers with up to 15 significant digits are converted without calling Strtod(),
+  //! giving the same (correctly rounded) result.
   Standard_EXPORT static void GetReal (Standard_IStream& IS, Standard_Real& theValue);
 
+  //! Reads the Standard_Integer value from the stream in the same way as operator>>
+  //! (leading whitespaces are skipped, failbit is set in case of error),
+  //! but directly from the stream buffer independently on the stream locale.
+  Standard_EXPORT static void GetInteger (Standard_IStream& IS, Standard_Integer& theValue);
+
 };
 
 #endif // _GeomTools_HeaderFile
@@ -16,15 +16,101 @@
 
 #include <HLRAlgo_PolyAlgo.hxx>
 
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Traverse.hxx>
 #include <HLRAlgo_BiPoint.hxx>
-#include <HLRAlgo_EdgeStatus.hxx>
 #include <HLRAlgo_ListOfBPoint.hxx>
 #include <HLRAlgo_PolyShellData.hxx>
 #include <HLRAlgo_PolyMask.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 
+#include <algorithm>
+#include <vector>
+
 IMPLEMENT_STANDARD_RTTIEXT(HLRAlgo_PolyAlgo,Standard_Transient)
 
+namespace
+{
+  typedef BVH_BoxSet<Standard_Real, 2, Standard_Integer> HLRAlgo_HidingTree;
+
+  //! Selects the hiding triangles which boxes overlap the box of the segment.
+  class HLRAlgo_HidingSelector :
+    public BVH_Traverse<Standard_Real, 2, HLRAlgo_HidingTree, Standard_Boolean>
+  {
+  public:
+
+    //! Sets the box of the segment
+    void SetBox (const BVH_Box<Standard_Real, 2>& theBox) { myBox = theBox; }
+
+    //! Returns the indices of the selected triangles
+    std::vector<Standard_Integer>& Indices() { return myIndices; }
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec2d& theCMin,
+                                         const BVH_Vec2d& theCMax,
+                                         Standard_Boolean& theIsInside) const Standard_OVERRIDE
+    {
+      Standard_Boolean hasOverlap;
+      theIsInside = myBox.Contains (theCMin, theCMax, hasOverlap);
+      return !hasOverlap;
+    }
+
+    virtual Standard_Boolean AcceptMetric (const Standard_Boolean& theIsInside) const Standard_OVERRIDE
+    {
+      return theIsInside;
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Boolean& theIsInside) Standard_OVERRIDE
+    {
+      if (theIsInside || !myBox.IsOut (myBVHSet->Box (theIndex)))
+      {
+        myIndices.push_back (myBVHSet->Element (theIndex));
+        return Standard_True;
+      }
+      return Standard_False;
+    }
+
+  private:
+
+    BVH_Box<Standard_Real, 2> myBox;
+    std::vector<Standard_Integer> myIndices;
+  };
+
+  //! Computes the statuses of the segments.
+  class HLRAlgo_HideSegmentFunctor
+  {
+  public:
+
+    HLRAlgo_HideSegmentFunctor (const HLRAlgo_PolyAlgo& theAlgo,
+                                const NCollection_Array1<HLRAlgo_BiPoint*>& theSegments,
+                                const NCollection_Array1<Standard_Integer>& theShells,
+                                NCollection_Array1<HLRAlgo_EdgeStatus>& theStatuses)
+    : myAlgo (theAlgo),
+      mySegments (theSegments),
+      myShells (theShells),
+      myStatuses (theStatuses)
+    {
+    }
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      myAlgo.HideSegment (*mySegments (theIndex), myShells (theIndex), myStatuses.ChangeValue (theIndex));
+    }
+
+  private:
+
+    HLRAlgo_HideSegmentFunctor& operator= (const HLRAlgo_HideSegmentFunctor&);
+
+  private:
+
+    const HLRAlgo_PolyAlgo& myAlgo;
+    const NCollection_Array1<HLRAlgo_BiPoint*>& mySegments;
+    const NCollection_Array1<Standard_Integer>& myShells;
+    NCollection_Array1<HLRAlgo_EdgeStatus>& myStatuses;
+  };
+}
+
 //=======================================================================
 //function : HLRAlgo_PolyAlgo
 //purpose  : 
@@ -33,7 +119,9 @@ IMPLEMENT_STANDARD_RTTIEXT(HLRAlgo_PolyAlgo,Standard_Transient)
 HLRAlgo_PolyAlgo::HLRAlgo_PolyAlgo ()
 : myNbrShell(0),
   myCurShell(0),
-  myFound(Standard_False)
+  myCurSeg(0),
+  myFound(Standard_False),
+  myIsParallel(Standard_False)
 {
   myTriangle.TolParam   = 0.00000001;
   myTriangle.TolAng = 0.0001;
@@ -57,6 +145,10 @@ void HLRAlgo_PolyAlgo::Clear()
   NCollection_Array1<Handle(HLRAlgo_PolyShellData)> anEmpty;
   myHShell.Move (anEmpty);
   myNbrShell = 0;
+  myHidingTriangles.Clear();
+  myHidingTree.Nullify();
+  NCollection_Array1<HLRAlgo_EdgeStatus> anEmptyStatuses;
+  myStatuses.Move (anEmptyStatuses);
 }
 
 //=======================================================================
@@ -102,6 +194,13 @@ void HLRAlgo_PolyAlgo::Update ()
   Standard_Real DecaY = - aBox.YMin + precad;
   Standard_Real DecaZ = - aBox.ZMin + precad;
 
+  // The boxes of the triangles in the tree are enlarged by two cells of the
+  // packed indices so that the tree never rejects a triangle accepted by them.
+  const Standard_Real aGapX = 2.0 / SurDX;
+  const Standard_Real aGapY = 2.0 / SurDY;
+  myHidingTriangles.Clear();
+  myHidingTree = new HLRAlgo_HidingTree (new BVH_LinearBuilder<Standard_Real, 2>());
+
   for (Standard_Integer aShellIter = myHShell.Lower(); aShellIter <= myHShell.Upper(); ++aShellIter)
   {
     const Handle(HLRAlgo_PolyShellData)& aPsd = myHShell.ChangeValue (aShellIter);
@@ -232,6 +331,13 @@ void HLRAlgo_PolyAlgo::Update ()
 	    d = a * X1 + b * Y1 + c * Z1;
 	    nbHide++;
 	    PHDat(nbHide).Set(otheri,MinTrian,MaxTrian,a,b,c,d);
+	    HidingTriangle& aHT = myHidingTriangles.Appended();
+	    aHT.Shell  = aShellIter;
+	    aHT.Face   = nbFaHi;
+	    aHT.Hiding = nbHide;
+	    myHidingTree->Add (myHidingTriangles.Length() - 1,
+			       BVH_Box<Standard_Real, 2> (BVH_Vec2d (xTrianMin - aGapX, yTrianMin - aGapY),
+							  BVH_Vec2d (xTrianMax + aGapX, yTrianMax + aGapY)));
 	    adx1 = dx1;
 	    ady1 = dy1;
 	    if (dx1 < 0) adx1 = -dx1;
@@ -309,6 +415,47 @@ void HLRAlgo_PolyAlgo::Update ()
       aShellIndices.Max = 0;
     }
   }
+  // build the tree now, so that it is not built lazily by concurrent queries
+  myHidingTree->Build();
+}
+
+//=======================================================================
+//function : InitHide
+//purpose  : 
+//=======================================================================
+void HLRAlgo_PolyAlgo::InitHide()
+{
+  NCollection_Array1<HLRAlgo_EdgeStatus> anEmptyStatuses;
+  myStatuses.Move (anEmptyStatuses);
+  if (myIsParallel)
+  {
+    Standard_Integer aNbSegments = 0;
+    for (Standard_Integer aShellIter = 1; aShellIter <= myNbrShell; ++aShellIter)
+    {
+      aNbSegments += myHShell.Value (aShellIter)->Edges().Extent();
+    }
+    if (aNbSegments > 0)
+    {
+      NCollection_Array1<HLRAlgo_BiPoint*> aSegments (1, aNbSegments);
+      NCollection_Array1<Standard_Integer> aShells (1, aNbSegments);
+      Standard_Integer aSegIter = 0;
+      for (Standard_Integer aShellIter = 1; aShellIter <= myNbrShell; ++aShellIter)
+      {
+        for (HLRAlgo_ListIteratorOfListOfBPoint anIt (myHShell.Value (aShellIter)->Edges()); anIt.More(); anIt.Next())
+        {
+          ++aSegIter;
+          aSegments (aSegIter) = &anIt.Value();
+          aShells (aSegIter) = aShellIter;
+        }
+      }
+      myStatuses.Resize (1, aNbSegments, Standard_False);
+      HLRAlgo_HideSegmentFunctor aFunctor (*this, aSegments, aShells, myStatuses);
+      OSD_Parallel::For (1, aNbSegments + 1, aFunctor);
+    }
+  }
+  myCurShell = 0;
+  myCurSeg = 0;
+  NextHide();
 }
 
 //=======================================================================
@@ -336,6 +483,7 @@ void HLRAlgo_PolyAlgo::NextHide()
       else                    { myCurShell++; }
     }
   }
+  if (myFound) myCurSeg++;
 }
 
 //=======================================================================
@@ -350,48 +498,80 @@ HLRAlgo_BiPoint::PointsT& HLRAlgo_PolyAlgo::Hide (HLRAlgo_EdgeStatus& theStatus,
                                                   Standard_Boolean& theIntl)
 {
   HLRAlgo_BiPoint& aBP = mySegListIt.Value();
-  HLRAlgo_BiPoint::PointsT&  aPoints   = aBP.Points();
-  HLRAlgo_BiPoint::IndicesT& anIndices = aBP.Indices();
-  theStatus = HLRAlgo_EdgeStatus (0.0, (Standard_ShortReal)myTriangle.TolParam,
-                                  1.0, (Standard_ShortReal)myTriangle.TolParam);
-  theIndex = anIndices.ShapeIndex;
+  theIndex = aBP.Indices().ShapeIndex;
   theReg1  = aBP.Rg1Line();
   theRegn  = aBP.RgNLine();
   theOutl  = aBP.OutLine();
   theIntl  = aBP.IntLine();
-  if (aBP.Hidden())
+  if (!myStatuses.IsEmpty())
+  {
+    theStatus = myStatuses.Value (myCurSeg);
+  }
+  else
+  {
+    HideSegment (aBP, myCurShell, theStatus);
+  }
+  return aBP.Points();
+}
+
+//=======================================================================
+//function : HideSegment
+//purpose  :
+//=======================================================================
+void HLRAlgo_PolyAlgo::HideSegment (HLRAlgo_BiPoint& theSegment,
+                                    const Standard_Integer theShell,
+                                    HLRAlgo_EdgeStatus& theStatus) const
+{
+  theStatus = HLRAlgo_EdgeStatus (0.0, (Standard_ShortReal)myTriangle.TolParam,
+                                  1.0, (Standard_ShortReal)myTriangle.TolParam);
+  if (theSegment.Hidden())
   {
     theStatus.HideAll();
-    return aPoints;
+    return;
+  }
+  if (myHidingTree.IsNull() || myHidingTree->Size() == 0)
+  {
+    return;
   }
 
-  for (Standard_Integer s = 1; s <= myNbrShell; s++)
+  HLRAlgo_BiPoint::PointsT&  aPoints   = theSegment.Points();
+  HLRAlgo_BiPoint::IndicesT& anIndices = theSegment.Indices();
+  const gp_XYZ& aP1 = aPoints.PntP1;
+  const gp_XYZ& aP2 = aPoints.PntP2;
+  HLRAlgo_HidingSelector aSelector;
+  aSelector.SetBox (BVH_Box<Standard_Real, 2> (BVH_Vec2d (Min (aP1.X(), aP2.X()), Min (aP1.Y(), aP2.Y())),
+                                               BVH_Vec2d (Max (aP1.X(), aP2.X()), Max (aP1.Y(), aP2.Y()))));
+  aSelector.SetBVHSet (myHidingTree.get());
+  if (aSelector.Select() == 0)
   {
-    const Handle(HLRAlgo_PolyShellData)& aPsd = myHShell.ChangeValue (s);
-    if (!aPsd->Hiding())
+    return;
+  }
+
+  // process the triangles in the order of the shells and faces,
+  // as the result of hiding depends on it
+  std::vector<Standard_Integer>& aCandidates = aSelector.Indices();
+  std::sort (aCandidates.begin(), aCandidates.end());
+
+  HLRAlgo_PolyData::Triangle aTriangle = myTriangle;
+  Standard_Integer aCurShell = 0;
+  Standard_Boolean isShellOverlap = Standard_False;
+  for (std::vector<Standard_Integer>::const_iterator anIt = aCandidates.begin(); anIt != aCandidates.end(); ++anIt)
+  {
+    const HidingTriangle& aHT = myHidingTriangles.Value (*anIt);
+    const Handle(HLRAlgo_PolyShellData)& aPsd = myHShell.Value (aHT.Shell);
+    if (aHT.Shell != aCurShell)
     {
-      continue;
+      aCurShell = aHT.Shell;
+      HLRAlgo_PolyShellData::ShellIndices& aShellIndices = aPsd->Indices();
+      isShellOverlap = ((aShellIndices.Max - anIndices.MinSeg) & 0x80100200) == 0 &&
+                       ((anIndices.MaxSeg - aShellIndices.Min) & 0x80100000) == 0;
     }
-
-    HLRAlgo_PolyShellData::ShellIndices& aShellIndices = aPsd->Indices();
-    if (((aShellIndices.Max - anIndices.MinSeg) & 0x80100200) == 0 &&
-        ((anIndices.MaxSeg - aShellIndices.Min) & 0x80100000) == 0)
+    if (isShellOverlap)
     {
-      const Standard_Boolean isHidingShell = (s == myCurShell);
-      NCollection_Array1<Handle(HLRAlgo_PolyData)>& aFace = aPsd->HidingPolyData();
-      const Standard_Integer nbFace = aFace.Upper();
-      for (Standard_Integer f = 1; f <= nbFace; f++)
-      {
-        const Handle(HLRAlgo_PolyData)& aPd = aFace.ChangeValue (f);
-        aPd->HideByPolyData (aPoints,
-                              myTriangle,
-                              anIndices,
-                              isHidingShell,
-                              theStatus);
-      }
+      const Handle(HLRAlgo_PolyData)& aPd = aPsd->HidingPolyData().Value (aHT.Face);
+      aPd->HideByTriangle (aHT.Hiding, aPoints, aTriangle, anIndices, aHT.Shell == theShell, theStatus);
     }
   }
-  return aPoints;
 }
 
 //=======================================================================
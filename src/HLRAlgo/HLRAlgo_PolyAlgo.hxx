@@ -17,16 +17,24 @@
 #ifndef _HLRAlgo_PolyAlgo_HeaderFile
 #define _HLRAlgo_PolyAlgo_HeaderFile
 
+#include <BVH_BoxSet.hxx>
+#include <HLRAlgo_EdgeStatus.hxx>
 #include <HLRAlgo_PolyData.hxx>
 #include <HLRAlgo_ListIteratorOfListOfBPoint.hxx>
+#include <NCollection_Vector.hxx>
 
-class HLRAlgo_EdgeStatus;
 class HLRAlgo_PolyShellData;
 
 class HLRAlgo_PolyAlgo;
 DEFINE_STANDARD_HANDLE(HLRAlgo_PolyAlgo, Standard_Transient)
 
 //! to remove Hidden lines on Triangulations.
+//!
+//! The hiding triangles are stored in the BVH tree built on their
+//! projections, so that each segment is checked only against the
+//! triangles overlapping it in the projection plane.
+//! If parallel mode is on, the statuses of all segments are computed
+//! in parallel at InitHide(); the results do not depend on the mode.
 class HLRAlgo_PolyAlgo : public Standard_Transient
 {
 
@@ -45,11 +53,20 @@ public:
   //! Prepare all the data to process the algo.
   Standard_EXPORT void Update();
 
-  void InitHide()
-  {
-    myCurShell = 0;
-    NextHide();
-  }
+  //! Sets the flag of parallel computation of the segments statuses.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of parallel computation.
+  Standard_Boolean IsRunParallel() const { return myIsParallel; }
+
+  //! Computes the hiding status of the segment <theSegment>
+  //! of the shell <theShell>.
+  //! Can be called concurrently for different segments after Update().
+  Standard_EXPORT void HideSegment (HLRAlgo_BiPoint& theSegment,
+                                    const Standard_Integer theShell,
+                                    HLRAlgo_EdgeStatus& theStatus) const;
+
+  Standard_EXPORT void InitHide();
 
   Standard_Boolean MoreHide() const { return myFound; }
 
@@ -82,14 +99,29 @@ public:
 
   DEFINE_STANDARD_RTTIEXT(HLRAlgo_PolyAlgo,Standard_Transient)
 
+private:
+
+  //! Position of the hiding triangle in the data of the shells.
+  struct HidingTriangle
+  {
+    Standard_Integer Shell;  //!< Index of the shell
+    Standard_Integer Face;   //!< Index of the face in HidingPolyData() of the shell
+    Standard_Integer Hiding; //!< Index of the triangle in PHDat() of the face
+  };
+
 private:
 
   NCollection_Array1<Handle(HLRAlgo_PolyShellData)> myHShell;
   HLRAlgo_PolyData::Triangle myTriangle;
   HLRAlgo_ListIteratorOfListOfBPoint mySegListIt;
+  NCollection_Vector<HidingTriangle> myHidingTriangles;
+  opencascade::handle<BVH_BoxSet<Standard_Real, 2, Standard_Integer> > myHidingTree;
+  NCollection_Array1<HLRAlgo_EdgeStatus> myStatuses;
   Standard_Integer myNbrShell;
   Standard_Integer myCurShell;
+  Standard_Integer myCurSeg;
   Standard_Boolean myFound;
+  Standard_Boolean myIsParallel;
 
 };
 
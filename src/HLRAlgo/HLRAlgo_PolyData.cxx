@@ -124,104 +124,102 @@ void HLRAlgo_PolyData::HideByPolyData (const HLRAlgo_BiPoint::PointsT& thePoints
   if (((myFaceIndices.Max - theIndices.MinSeg) & 0x80100200) == 0 &&
       ((theIndices.MaxSeg - myFaceIndices.Min) & 0x80100000) == 0) {
     HLRAlgo_Array1OfPHDat& PHDat = myHPHDat->ChangeArray1();
-    const HLRAlgo_Array1OfTData& TData = myHTData->Array1();
-    Standard_Real d1,d2;
-    Standard_Boolean NotConnex    = Standard_False;
-    Standard_Boolean isCrossing   = Standard_False;
-    Standard_Boolean toHideBefore = Standard_False;
-    Standard_Integer TFlag = 0;
     Standard_Integer h,h2 = PHDat.Upper();
-    HLRAlgo_PolyHidingData* PH = &(PHDat(1));
     
-    for (h = 1; h <= h2; h++) {
-      HLRAlgo_PolyHidingData::TriangleIndices& aTriangleIndices = PH->Indices();
-      if (((aTriangleIndices.Max - theIndices.MinSeg) & 0x80100200) == 0 &&
-	  ((theIndices.MaxSeg - aTriangleIndices.Min) & 0x80100000) == 0) {
-	const HLRAlgo_TriangleData& aTriangle = TData(aTriangleIndices.Index);
-	NotConnex = Standard_True;
-	if (HidingShell) {
-	  if      (myFaceIndices.Index == theIndices.FaceConex1) {
-	    if      (theIndices.Face1Pt1 == aTriangle.Node1)
-	      NotConnex = theIndices.Face1Pt2 != aTriangle.Node2 && theIndices.Face1Pt2 != aTriangle.Node3;
-	    else if (theIndices.Face1Pt1 == aTriangle.Node2)
-	      NotConnex = theIndices.Face1Pt2 != aTriangle.Node3 && theIndices.Face1Pt2 != aTriangle.Node1;
-	    else if (theIndices.Face1Pt1 == aTriangle.Node3)
-	      NotConnex = theIndices.Face1Pt2 != aTriangle.Node1 && theIndices.Face1Pt2 != aTriangle.Node2;
-	  }
-	  else if (myFaceIndices.Index == theIndices.FaceConex2) {
-	    if      (theIndices.Face2Pt1 == aTriangle.Node1)
-	      NotConnex = theIndices.Face2Pt2 != aTriangle.Node2 && theIndices.Face2Pt2 != aTriangle.Node3;
-	    else if (theIndices.Face2Pt1 == aTriangle.Node2)
-	      NotConnex = theIndices.Face2Pt2 != aTriangle.Node3 && theIndices.Face2Pt2 != aTriangle.Node1;
-	    else if (theIndices.Face2Pt1 == aTriangle.Node3)
-	      NotConnex = theIndices.Face2Pt2 != aTriangle.Node1 && theIndices.Face2Pt2 != aTriangle.Node2;
-	  }
-	}
-	if (NotConnex) {
-	  HLRAlgo_PolyHidingData::PlaneT& aPlane = PH->Plane();
-	  d1 = aPlane.Normal * thePoints.PntP1 - aPlane.D;
-	  d2 = aPlane.Normal * thePoints.PntP2 - aPlane.D;
-	  if      (d1 > theTriangle.Tolerance) {
-	    if    (d2 < -theTriangle.Tolerance) {
-	      theTriangle.Param = d1 / ( d1 - d2 );
-	      toHideBefore = Standard_False;
-	      isCrossing   = Standard_True;
-	      TFlag = aTriangle.Flags;
-	      const TColgp_Array1OfXYZ& Nodes = myHNodes->Array1();
-	      const gp_XYZ            & P1    = Nodes(aTriangle.Node1);
-	      const gp_XYZ            & P2    = Nodes(aTriangle.Node2);
-	      const gp_XYZ            & P3    = Nodes(aTriangle.Node3);
-        theTriangle.V1 = gp_XY(P1.X(), P1.Y());
-        theTriangle.V2 = gp_XY(P2.X(), P2.Y());
-        theTriangle.V3 = gp_XY(P3.X(), P3.Y());
-	      hideByOneTriangle (thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
-	    }
-	  }
-	  else if (d1 < -theTriangle.Tolerance) {
-	    if    (d2 > theTriangle.Tolerance) {
-	      theTriangle.Param = d1 / ( d1 - d2 );
-	      toHideBefore = Standard_True;
-	      isCrossing   = Standard_True;
-	      TFlag = aTriangle.Flags;
-	      const TColgp_Array1OfXYZ& Nodes = myHNodes->Array1();
-	      const gp_XYZ            & P1    = Nodes(aTriangle.Node1);
-	      const gp_XYZ            & P2    = Nodes(aTriangle.Node2);
-	      const gp_XYZ            & P3    = Nodes(aTriangle.Node3);
-	      theTriangle.V1 = gp_XY(P1.X(), P1.Y());
-	      theTriangle.V2 = gp_XY(P2.X(), P2.Y());
-	      theTriangle.V3 = gp_XY(P3.X(), P3.Y());
-	      hideByOneTriangle (thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
-	    }
-	    else {
-	      isCrossing = Standard_False;
-	      TFlag = aTriangle.Flags;
-	      const TColgp_Array1OfXYZ& Nodes = myHNodes->Array1();
-	      const gp_XYZ            & P1    = Nodes(aTriangle.Node1);
-	      const gp_XYZ            & P2    = Nodes(aTriangle.Node2);
-	      const gp_XYZ            & P3    = Nodes(aTriangle.Node3);
-	      theTriangle.V1 = gp_XY(P1.X(), P1.Y());
-	      theTriangle.V2 = gp_XY(P2.X(), P2.Y());
-	      theTriangle.V3 = gp_XY(P3.X(), P3.Y());
-	      hideByOneTriangle (thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
-	    }
-	  }
-	  else if (d2 < -theTriangle.Tolerance) {
-	    isCrossing = Standard_False;
-	    TFlag = aTriangle.Flags;
-	    const TColgp_Array1OfXYZ& Nodes = myHNodes->Array1();
-	    const gp_XYZ            & P1    = Nodes(aTriangle.Node1);
-	    const gp_XYZ            & P2    = Nodes(aTriangle.Node2);
-	    const gp_XYZ            & P3    = Nodes(aTriangle.Node3);
-	    theTriangle.V1 = gp_XY(P1.X(), P1.Y());
-	    theTriangle.V2 = gp_XY(P2.X(), P2.Y());
-	    theTriangle.V3 = gp_XY(P3.X(), P3.Y());
-	    hideByOneTriangle(thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
-	  }
-	}
-      }
-      PH++;
+    for (h = 1; h <= h2; h++)
+      hideByHidingData (thePoints, theTriangle, theIndices, HidingShell, PHDat.ChangeValue (h), status);
+  }
+}
+
+//=======================================================================
+//function : HideByTriangle
+//purpose  : 
+//=======================================================================
+
+void HLRAlgo_PolyData::HideByTriangle (const Standard_Integer theHiding,
+				       const HLRAlgo_BiPoint::PointsT& thePoints,
+				       Triangle& theTriangle,
+				       HLRAlgo_BiPoint::IndicesT& theIndices,
+				       const Standard_Boolean HidingShell,
+				       HLRAlgo_EdgeStatus& status)
+{
+  if (((myFaceIndices.Max - theIndices.MinSeg) & 0x80100200) == 0 &&
+      ((theIndices.MaxSeg - myFaceIndices.Min) & 0x80100000) == 0)
+    hideByHidingData (thePoints, theTriangle, theIndices, HidingShell,
+		      myHPHDat->ChangeValue (theHiding), status);
+}
+
+//=======================================================================
+//function : hideByHidingData
+//purpose  : 
+//=======================================================================
+
+void HLRAlgo_PolyData::hideByHidingData (const HLRAlgo_BiPoint::PointsT& thePoints,
+					 Triangle& theTriangle,
+					 HLRAlgo_BiPoint::IndicesT& theIndices,
+					 const Standard_Boolean HidingShell,
+					 HLRAlgo_PolyHidingData& thePH,
+					 HLRAlgo_EdgeStatus& status)
+{
+  HLRAlgo_PolyHidingData::TriangleIndices& aTriangleIndices = thePH.Indices();
+  if (((aTriangleIndices.Max - theIndices.MinSeg) & 0x80100200) != 0 ||
+      ((theIndices.MaxSeg - aTriangleIndices.Min) & 0x80100000) != 0)
+    return;
+
+  const HLRAlgo_Array1OfTData& TData = myHTData->Array1();
+  const HLRAlgo_TriangleData& aTriangle = TData(aTriangleIndices.Index);
+  Standard_Boolean NotConnex = Standard_True;
+  if (HidingShell) {
+    if      (myFaceIndices.Index == theIndices.FaceConex1) {
+      if      (theIndices.Face1Pt1 == aTriangle.Node1)
+	NotConnex = theIndices.Face1Pt2 != aTriangle.Node2 && theIndices.Face1Pt2 != aTriangle.Node3;
+      else if (theIndices.Face1Pt1 == aTriangle.Node2)
+	NotConnex = theIndices.Face1Pt2 != aTriangle.Node3 && theIndices.Face1Pt2 != aTriangle.Node1;
+      else if (theIndices.Face1Pt1 == aTriangle.Node3)
+	NotConnex = theIndices.Face1Pt2 != aTriangle.Node1 && theIndices.Face1Pt2 != aTriangle.Node2;
+    }
+    else if (myFaceIndices.Index == theIndices.FaceConex2) {
+      if      (theIndices.Face2Pt1 == aTriangle.Node1)
+	NotConnex = theIndices.Face2Pt2 != aTriangle.Node2 && theIndices.Face2Pt2 != aTriangle.Node3;
+      else if (theIndices.Face2Pt1 == aTriangle.Node2)
+	NotConnex = theIndices.Face2Pt2 != aTriangle.Node3 && theIndices.Face2Pt2 != aTriangle.Node1;
+      else if (theIndices.Face2Pt1 == aTriangle.Node3)
+	NotConnex = theIndices.Face2Pt2 != aTriangle.Node1 && theIndices.Face2Pt2 != aTriangle.Node2;
+    }
+  }
+  if (!NotConnex)
+    return;
+
+  // the flag of hiding before the crossing point is meaningful only for crossing
+  Standard_Boolean isCrossing   = Standard_False;
+  Standard_Boolean toHideBefore = Standard_False;
+  HLRAlgo_PolyHidingData::PlaneT& aPlane = thePH.Plane();
+  const Standard_Real d1 = aPlane.Normal * thePoints.PntP1 - aPlane.D;
+  const Standard_Real d2 = aPlane.Normal * thePoints.PntP2 - aPlane.D;
+  if      (d1 > theTriangle.Tolerance) {
+    if (d2 >= -theTriangle.Tolerance)
+      return;
+    theTriangle.Param = d1 / ( d1 - d2 );
+    isCrossing = Standard_True;
+  }
+  else if (d1 < -theTriangle.Tolerance) {
+    if (d2 > theTriangle.Tolerance) {
+      theTriangle.Param = d1 / ( d1 - d2 );
+      toHideBefore = Standard_True;
+      isCrossing   = Standard_True;
     }
   }
+  else if (d2 >= -theTriangle.Tolerance)
+    return;
+
+  const TColgp_Array1OfXYZ& Nodes = myHNodes->Array1();
+  const gp_XYZ            & P1    = Nodes(aTriangle.Node1);
+  const gp_XYZ            & P2    = Nodes(aTriangle.Node2);
+  const gp_XYZ            & P3    = Nodes(aTriangle.Node3);
+  theTriangle.V1 = gp_XY(P1.X(), P1.Y());
+  theTriangle.V2 = gp_XY(P2.X(), P2.Y());
+  theTriangle.V3 = gp_XY(P3.X(), P3.Y());
+  hideByOneTriangle (thePoints, theTriangle, isCrossing, toHideBefore, aTriangle.Flags, status);
 }
 
 //=======================================================================
@@ -114,6 +114,10 @@ public:
   
   //! process hiding between <Pt1> and <Pt2>.
   Standard_EXPORT void HideByPolyData (const HLRAlgo_BiPoint::PointsT& thePoints, Triangle& theTriangle, HLRAlgo_BiPoint::IndicesT& theIndices, const Standard_Boolean HidingShell, HLRAlgo_EdgeStatus& status);
+
+  //! process hiding between <Pt1> and <Pt2> by the hiding
+  //! triangle of index <theHiding> in PHDat() only.
+  Standard_EXPORT void HideByTriangle (const Standard_Integer theHiding, const HLRAlgo_BiPoint::PointsT& thePoints, Triangle& theTriangle, HLRAlgo_BiPoint::IndicesT& theIndices, const Standard_Boolean HidingShell, HLRAlgo_EdgeStatus& status);
   
   FaceIndices& Indices()
   {
@@ -124,6 +128,14 @@ public:
 
 private:
 
+  //! process hiding between <Pt1> and <Pt2> by one hiding triangle.
+  void hideByHidingData (const HLRAlgo_BiPoint::PointsT& thePoints,
+                         Triangle& theTriangle,
+                         HLRAlgo_BiPoint::IndicesT& theIndices,
+                         const Standard_Boolean HidingShell,
+                         HLRAlgo_PolyHidingData& thePH,
+                         HLRAlgo_EdgeStatus& status);
+
   //! evident.
   void hideByOneTriangle (const HLRAlgo_BiPoint::PointsT& thePoints,
                           Triangle& theTriangle,
@@ -44,6 +44,9 @@
 #include <stdio.h>
 IMPLEMENT_STANDARD_RTTIEXT(HLRBRep_Data,Standard_Transient)
 
+#ifdef OCCT_DEBUG
+// statistics printed by HLRBRep_InternalAlgo in debug mode;
+// the counters are not synchronized between threads
 Standard_Integer nbOkIntersection;
 Standard_Integer nbPtIntersection;
 Standard_Integer nbSegIntersection;
@@ -51,6 +54,7 @@ Standard_Integer nbClassification;
 Standard_Integer nbCal1Intersection; // pairs of unrejected edges
 Standard_Integer nbCal2Intersection; // true intersections (not vertex)
 Standard_Integer nbCal3Intersection; // Curve-Surface intersections
+#endif
 
 static const Standard_Real CutLar = 2.e-1;
 static const Standard_Real CutBig = 1.e-1;
@@ -411,7 +415,9 @@ HLRBRep_Data::HLRBRep_Data (const Standard_Integer NV,
 			    myLLProps(2,Epsilon(1.)),
 			    myFLProps(2,Epsilon(1.)),
 			    mySLProps(2,Epsilon(1.)),
-			    myHideCount(0)
+			    myHideCount(0),
+			    myNbEdgesParts(1),
+			    myEdgesPart(0)
 {
   myReject = new TableauRejection();
   ((TableauRejection *)myReject)->SetDim(myNbEdges);
@@ -808,6 +814,8 @@ HLRBRep_Data::InitBoundSort (const HLRAlgo_EdgesBlock::MinMaxIndices& MinMaxTot,
   const HLRAlgo_EdgesBlock::MinMaxIndices& MinMaxShap = MinMaxTot;
 
   for (Standard_Integer e = e1; e <= e2; e++) {
+    if (myNbEdgesParts > 1 && e % myNbEdgesParts != myEdgesPart)
+      continue;
     HLRBRep_EdgeData& ed = myEData(e);
     if (!ed.Status().AllHidden()) {
       myLEMinMax = &ed.MinMax();
@@ -1128,7 +1136,9 @@ void HLRBRep_Data::NextInterference ()
 	      }
 	    }
 	    if (!rej) {
+#ifdef OCCT_DEBUG
 	      nbCal1Intersection++;
+#endif
 	      Standard_Boolean h1 = Standard_False;
 	      Standard_Boolean e1 = Standard_False;
 	      Standard_Boolean h2 = Standard_False;
@@ -1167,7 +1177,9 @@ void HLRBRep_Data::NextInterference ()
 	      iInterf = 1;
 	      
 	      if (myIntersected) {           // compute real intersection
+#ifdef OCCT_DEBUG
 		nbCal2Intersection++;
+#endif
 		
 		Standard_Real da1 = 0;
 		Standard_Real db1 = 0;
@@ -1214,7 +1226,9 @@ void HLRBRep_Data::NextInterference ()
 		    myNbPoints   = myIntersector.NbPoints();
 		    myNbSegments = myIntersector.NbSegments();
 		    if ((myNbSegments + myNbPoints) > 0) { 
+#ifdef OCCT_DEBUG
 		      nbOkIntersection++;
+#endif
 		    }
 		    else { 
 		      ((TableauRejection *)myReject)->
@@ -1235,8 +1249,10 @@ void HLRBRep_Data::NextInterference ()
 		  }
 		}
 	      }
+#ifdef OCCT_DEBUG
 	      nbPtIntersection  += myNbPoints;
 	      nbSegIntersection += myNbSegments;
+#endif
 	    }
 	  }
 	  else { 
@@ -1720,7 +1736,9 @@ HLRBRep_Data::Classify (const Standard_Integer E,
 {
   (void)E; // avoid compiler warning
 
+#ifdef OCCT_DEBUG
   nbClassification++;
+#endif
   HLRAlgo_EdgesBlock::MinMaxIndices VertMin, VertMax, MinMaxVert;
   Standard_Real TotMin[16],TotMax[16];
   
@@ -1891,7 +1909,9 @@ HLRBRep_Data::Classify (const Standard_Integer E,
     }
   }
 
+#ifdef OCCT_DEBUG
   nbCal3Intersection++;
+#endif
   gp_Pnt   PLim;
   gp_Pnt2d Psta;
   Psta = EC.Value  (sta);
@@ -1973,7 +1993,9 @@ TopAbs_State HLRBRep_Data::SimplClassify (const Standard_Integer /*E*/,
 					  const Standard_Real p1,
 					  const Standard_Real p2)
 {
+#ifdef OCCT_DEBUG
   nbClassification++;
+#endif
   HLRAlgo_EdgesBlock::MinMaxIndices VertMin, VertMax, MinMaxVert;
   Standard_Real TotMin[16],TotMax[16];
   
@@ -94,6 +94,13 @@ public:
   
     TopTools_IndexedMapOfShape& FaceMap();
   
+  //! Restricts the  edges compared  with  the  hiding
+  //! faces by InitBoundSort to the edges whose index
+  //! gives the remainder <thePart> when divided by
+  //! <theNbParts>.  Used to hide the edges by several
+  //! data structures in parallel.
+    void EdgesPart (const Standard_Integer theNbParts, const Standard_Integer thePart);
+  
   //! to compare with only non rejected edges.
   Standard_EXPORT void InitBoundSort (const HLRAlgo_EdgesBlock::MinMaxIndices& MinMaxTot, const Standard_Integer e1, const Standard_Integer e2);
   
@@ -229,6 +236,8 @@ private:
   Standard_Real mySurD[16];
   Standard_Integer myCurSortEd;
   Standard_Integer myNbrSortEd;
+  Standard_Integer myNbEdgesParts;
+  Standard_Integer myEdgesPart;
   Standard_Integer myLE;
   Standard_Boolean myLEOutLine;
   Standard_Boolean myLEInternal;
@@ -22,6 +22,8 @@
 #include <HLRBRep_ShapeBounds.hxx>
 #include <HLRBRep_ShapeToHLR.hxx>
 #include <HLRTopoBRep_OutLiner.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_Transient.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_OutOfRange.hxx>
@@ -32,6 +34,7 @@
 #include <stdio.h>
 IMPLEMENT_STANDARD_RTTIEXT(HLRBRep_InternalAlgo,Standard_Transient)
 
+#ifdef OCCT_DEBUG
 extern Standard_Integer nbPtIntersection;   // total P.I.
 extern Standard_Integer nbSegIntersection;  // total S.I
 extern Standard_Integer nbClassification;   // total classification
@@ -39,6 +42,7 @@ extern Standard_Integer nbOkIntersection;   // pairs of intersecting edges
 extern Standard_Integer nbCal1Intersection; // pairs of unrejected edges
 extern Standard_Integer nbCal2Intersection; // true intersections (not vertex)
 extern Standard_Integer nbCal3Intersection; // curve-surface intersections
+#endif
 
 static Standard_Integer HLRBRep_InternalAlgo_TRACE = Standard_True;
 static Standard_Integer HLRBRep_InternalAlgo_TRACE10 = Standard_True; 
@@ -49,7 +53,8 @@ static Standard_Integer HLRBRep_InternalAlgo_TRACE10 = Standard_True;
 //=======================================================================
 
 HLRBRep_InternalAlgo::HLRBRep_InternalAlgo () :
-myDebug       (Standard_False)
+myDebug       (Standard_False),
+myIsParallel  (Standard_False)
 {
 }
 
@@ -65,6 +70,7 @@ HLRBRep_InternalAlgo (const Handle(HLRBRep_InternalAlgo)& A)
   myProj        = A->Projector();
   myShapes      = A->SeqOfShapeBounds();
   myDebug       = A->Debug();
+  myIsParallel  = A->IsRunParallel();
 }
 
 //=======================================================================
@@ -552,13 +558,10 @@ void HLRBRep_InternalAlgo::HideAll (const Standard_Integer I)
 void HLRBRep_InternalAlgo::PartialHide ()
 {
   if (!myDS.IsNull()) {
-    Standard_Integer i,n = myShapes.Length();
-
     if (myDebug)
       std::cout << " Partial hiding" << std::endl << std::endl;
 
-    for (i = 1; i <= n; i++)
-      Hide(i);
+    HideShapes(Standard_False);
     
     Select();
   }
@@ -572,17 +575,10 @@ void HLRBRep_InternalAlgo::PartialHide ()
 void HLRBRep_InternalAlgo::Hide ()
 {
   if (!myDS.IsNull()) {
-    Standard_Integer i,j,n = myShapes.Length();
-
     if (myDebug)
       std::cout << " Total hiding" << std::endl;
 
-    for (i = 1; i <= n; i++)
-      Hide(i);
-    
-    for (i = 1; i <= n; i++)
-      for (j = 1; j <= n; j++)
-	if (i != j) Hide(i,j);
+    HideShapes(Standard_True);
     
     Select();
   }
@@ -653,6 +649,118 @@ void HLRBRep_InternalAlgo::Hide (const Standard_Integer I,
   }
 }
 
+namespace
+{
+  //! Maximal number of parts of the edges hidden by separate data structures
+  //! in parallel mode. The partition does not depend on the number of threads,
+  //! so that the result is the same on any machine.
+  static const Standard_Integer THE_MAX_NB_EDGES_PARTS = 8;
+
+  //! Minimal number of edges in one part.
+  static const Standard_Integer THE_MIN_NB_EDGES_IN_PART = 16;
+
+  //! Hides the shapes of the algorithm by themselves and,
+  //! if requested, by each other.
+  void hideShapes (HLRBRep_InternalAlgo&  theAlgo,
+                   const Standard_Boolean theToHideByOthers)
+  {
+    const Standard_Integer aNbShapes = theAlgo.NbShapes();
+    for (Standard_Integer i = 1; i <= aNbShapes; i++)
+      theAlgo.Hide(i);
+
+    if (theToHideByOthers)
+    {
+      for (Standard_Integer i = 1; i <= aNbShapes; i++)
+        for (Standard_Integer j = 1; j <= aNbShapes; j++)
+          if (i != j) theAlgo.Hide(i,j);
+    }
+  }
+
+  //! Functor hiding the part of the edges in its own algorithm.
+  class HLRBRep_HidePartFunctor
+  {
+  public:
+    HLRBRep_HidePartFunctor (const NCollection_Array1<HLRBRep_InternalAlgo*>& theAlgos,
+                             const Standard_Boolean                          theToHideByOthers)
+    : myAlgos (theAlgos),
+      myToHideByOthers (theToHideByOthers)
+    {}
+
+    void operator() (const Standard_Integer thePart) const
+    {
+      hideShapes (*myAlgos (thePart), myToHideByOthers);
+    }
+
+  private:
+    HLRBRep_HidePartFunctor& operator= (const HLRBRep_HidePartFunctor&);
+
+  private:
+    const NCollection_Array1<HLRBRep_InternalAlgo*>& myAlgos;
+    const Standard_Boolean myToHideByOthers;
+  };
+}
+
+//=======================================================================
+//function : HideShapes
+//purpose  : The edges are hidden by the faces independently of each
+//           other, but the data structure keeps the state of the current
+//           face and edge and the geometric tools are not shared safely.
+//           Thus in parallel mode the algorithm loads its shapes into
+//           additional data structures, and each of them hides its own
+//           part of the edges by all the faces. The statuses of the edges
+//           are collected back at the end. The number of parts depends on
+//           the number of edges only.
+//=======================================================================
+
+void HLRBRep_InternalAlgo::HideShapes (const Standard_Boolean theToHideByOthers)
+{
+  const Standard_Integer aNbEdges = myDS->NbEdges();
+  const Standard_Integer aNbParts = !myIsParallel ? 1 :
+    Min (THE_MAX_NB_EDGES_PARTS, aNbEdges / THE_MIN_NB_EDGES_IN_PART);
+  if (aNbParts < 2) {
+    hideShapes(*this, theToHideByOthers);
+    return;
+  }
+
+  // The outlined shapes are already computed, so the data
+  // structures of the parts are loaded without outlining.
+  NCollection_Array1<Handle(HLRBRep_InternalAlgo)> aPartAlgos (1, aNbParts - 1);
+  NCollection_Array1<HLRBRep_InternalAlgo*> anAlgos (0, aNbParts - 1);
+  anAlgos(0) = this;
+  Standard_Integer i, k;
+  for (k = 1; k < aNbParts; k++) {
+    Handle(HLRBRep_InternalAlgo) anAlgo = new HLRBRep_InternalAlgo();
+    for (i = 1; i <= myShapes.Length(); i++) {
+      HLRBRep_ShapeBounds& SB = myShapes(i);
+      anAlgo->Load(SB.Shape(),SB.ShapeData(),SB.NbOfIso());
+    }
+    anAlgo->Projector(myProj);
+    anAlgo->Update();
+    if (anAlgo->myDS.IsNull() || anAlgo->myDS->NbEdges() != aNbEdges) {
+      // should not happen, the shapes are loaded in the same way
+      hideShapes(*this, theToHideByOthers);
+      return;
+    }
+    aPartAlgos(k) = anAlgo;
+    anAlgos(k) = anAlgo.get();
+  }
+
+  for (k = 0; k < aNbParts; k++)
+    anAlgos(k)->myDS->EdgesPart(aNbParts, k);
+
+  HLRBRep_HidePartFunctor aFunctor (anAlgos, theToHideByOthers);
+  OSD_Parallel::For (0, aNbParts, aFunctor);
+
+  myDS->EdgesPart(1, 0);
+  HLRBRep_Array1OfEData& aEDataArray = myDS->EDataArray();
+  for (Standard_Integer e = 1; e <= aNbEdges; e++) {
+    k = e % aNbParts;
+    if (k != 0)
+      aEDataArray.ChangeValue(e).Status() =
+        anAlgos(k)->myDS->EDataArray().ChangeValue(e).Status();
+  }
+}
+
 //=======================================================================
 //function : HideSelected
 //purpose  : 
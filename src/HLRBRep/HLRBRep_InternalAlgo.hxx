@@ -120,6 +120,22 @@ public:
   
   Standard_EXPORT Standard_Boolean Debug() const;
   
+  //! Sets the flag of parallel processing.
+  //! In parallel mode Hide() and PartialHide() split
+  //! the edges  between several  data structures loaded
+  //! from the same shapes and hide them simultaneously.
+  //! The  number of  parts depends on the number of the
+  //! edges only, thus the result does not depend on the
+  //! number of threads. The intersections of the  edges
+  //! of different parts are computed in each part while
+  //! sequential  mode reuses them, so the result  of the
+  //! parallel mode may differ from the sequential one in
+  //! splitting of the edges within the tolerance.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+  
+  //! Returns the flag of parallel processing.
+  Standard_Boolean IsRunParallel() const { return myIsParallel; }
+  
   Standard_EXPORT Handle(HLRBRep_Data) DataStructure() const;
 
 
@@ -139,12 +155,17 @@ private:
   //! After hiding  of    the  selected  parts  of   the
   //! DataStructure.
   Standard_EXPORT void HideSelected (const Standard_Integer I, const Standard_Boolean SideFace);
+  
+  //! Hides the shapes by themselves and, if <theToHideByOthers>,
+  //! by each other.
+  void HideShapes (const Standard_Boolean theToHideByOthers);
 
   Handle(HLRBRep_Data) myDS;
   HLRAlgo_Projector myProj;
   HLRBRep_SeqOfShapeBounds myShapes;
   BRepTopAdaptor_MapOfShapeTool myMapOfShapeTool;
   Standard_Boolean myDebug;
+  Standard_Boolean myIsParallel;
 
 
 };
@@ -0,0 +1,102 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <HLRBRep_MultiViewAlgo.hxx>
+
+#include <OSD_Parallel.hxx>
+
+namespace
+{
+  //! Functor hiding the lines of the views.
+  class HLRBRep_HideViewFunctor
+  {
+  public:
+    HLRBRep_HideViewFunctor (const NCollection_Vector<Handle(HLRBRep_Algo)>& theAlgos)
+    : myAlgos (theAlgos)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      myAlgos.Value (theIndex)->Hide();
+    }
+
+  private:
+    HLRBRep_HideViewFunctor& operator= (const HLRBRep_HideViewFunctor&);
+
+  private:
+    const NCollection_Vector<Handle(HLRBRep_Algo)>& myAlgos;
+  };
+}
+
+//=======================================================================
+//function : HLRBRep_MultiViewAlgo
+//purpose  : 
+//=======================================================================
+HLRBRep_MultiViewAlgo::HLRBRep_MultiViewAlgo()
+: myIsParallel (Standard_False),
+  myIsDone (Standard_False)
+{
+}
+
+//=======================================================================
+//function : Add
+//purpose  : 
+//=======================================================================
+void HLRBRep_MultiViewAlgo::Add (const TopoDS_Shape&    theShape,
+                                 const Standard_Integer theNbIso)
+{
+  myShapes.Append (theShape);
+  myNbIsos.Append (theNbIso);
+  myIsDone = Standard_False;
+}
+
+//=======================================================================
+//function : AddView
+//purpose  : 
+//=======================================================================
+Standard_Integer HLRBRep_MultiViewAlgo::AddView (const HLRAlgo_Projector& theProjector)
+{
+  myProjectors.Append (theProjector);
+  myIsDone = Standard_False;
+  return myProjectors.Length();
+}
+
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+void HLRBRep_MultiViewAlgo::Perform()
+{
+  myAlgos.Clear();
+  myIsDone = Standard_False;
+
+  const Standard_Integer aNbViews = myProjectors.Length();
+  for (Standard_Integer i = 1; i <= aNbViews; ++i)
+  {
+    Handle(HLRBRep_Algo) anAlgo = new HLRBRep_Algo();
+    for (Standard_Integer j = 1; j <= myShapes.Length(); ++j)
+    {
+      anAlgo->Add (myShapes (j), myNbIsos (j));
+    }
+    anAlgo->Projector (myProjectors (i));
+    anAlgo->SetRunParallel (myIsParallel && aNbViews == 1);
+    // outlining of the shapes adds the representations of the new
+    // edges to the vertices of the shapes, so it is not parallel
+    anAlgo->Update();
+    myAlgos.Append (anAlgo);
+  }
+
+  HLRBRep_HideViewFunctor aFunctor (myAlgos);
+  OSD_Parallel::For (0, aNbViews, aFunctor, !myIsParallel || aNbViews < 2);
+  myIsDone = Standard_True;
+}
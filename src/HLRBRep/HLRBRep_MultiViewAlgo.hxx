@@ -0,0 +1,82 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _HLRBRep_MultiViewAlgo_HeaderFile
+#define _HLRBRep_MultiViewAlgo_HeaderFile
+
+#include <HLRAlgo_Projector.hxx>
+#include <HLRBRep_Algo.hxx>
+#include <NCollection_Sequence.hxx>
+#include <NCollection_Vector.hxx>
+#include <TColStd_SequenceOfInteger.hxx>
+#include <TopTools_SequenceOfShape.hxx>
+
+//! Computes the visible and hidden lines of the same set of shapes
+//! for several projectors (e.g. front, top, side and isometric views
+//! of a drawing).
+//!
+//! Each view is computed by its own HLRBRep_Algo, which can be used
+//! with HLRBRep_HLRToShape to extract the result of the view.
+//! The outlines of the views are computed one after another, as the
+//! outlining updates the vertices of the shapes, and then the views
+//! are hidden simultaneously in parallel mode.
+//! If there is only one view, it is hidden in parallel by itself
+//! (see HLRBRep_InternalAlgo::SetRunParallel()).
+class HLRBRep_MultiViewAlgo
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Empty constructor
+  Standard_EXPORT HLRBRep_MultiViewAlgo();
+
+  //! Adds the shape to be visualized in all the views
+  //! with the number of isoparameters <theNbIso>.
+  Standard_EXPORT void Add (const TopoDS_Shape&    theShape,
+                            const Standard_Integer theNbIso = 0);
+
+  //! Adds the view with the given projector.
+  //! Returns the index of the view.
+  Standard_EXPORT Standard_Integer AddView (const HLRAlgo_Projector& theProjector);
+
+  //! Returns the number of views.
+  Standard_Integer NbViews() const { return myProjectors.Length(); }
+
+  //! Sets the flag of parallel processing.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  Standard_Boolean IsRunParallel() const { return myIsParallel; }
+
+  //! Computes the visible and hidden lines of all the views.
+  Standard_EXPORT void Perform();
+
+  //! Returns true if the views have been computed.
+  Standard_Boolean IsDone() const { return myIsDone; }
+
+  //! Returns the algorithm of the view <theIndex>
+  //! (in the range [1, NbViews()]) after Perform().
+  const Handle(HLRBRep_Algo)& View (const Standard_Integer theIndex) const { return myAlgos.Value (theIndex - 1); }
+
+private:
+
+  TopTools_SequenceOfShape myShapes;                 //!< Shapes to visualize
+  TColStd_SequenceOfInteger myNbIsos;                //!< Numbers of isoparameters of the shapes
+  NCollection_Sequence<HLRAlgo_Projector> myProjectors; //!< Projectors of the views
+  NCollection_Vector<Handle(HLRBRep_Algo)> myAlgos;  //!< Algorithms of the views
+  Standard_Boolean myIsParallel;                     //!< Parallel processing flag
+  Standard_Boolean myIsDone;                         //!< State of the algorithm
+};
+
+#endif // _HLRBRep_MultiViewAlgo_HeaderFile
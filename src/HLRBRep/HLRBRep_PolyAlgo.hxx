@@ -150,6 +150,12 @@ public:
   //! defining the shape or shapes to be visualized.
   Standard_EXPORT void Update();
 
+  //! Sets the flag of parallel computation of the hiding.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myAlgo->SetRunParallel (theIsParallel); }
+
+  //! Returns the flag of parallel computation of the hiding.
+  Standard_Boolean IsRunParallel() const { return myAlgo->IsRunParallel(); }
+
   void InitHide() { myAlgo->InitHide(); }
 
   Standard_Boolean MoreHide() const { return myAlgo->MoreHide(); }
@@ -21,11 +21,16 @@
 #include <HLRAppli_ReflectLines.hxx>
 #include <HLRBRep_Algo.hxx>
 #include <HLRBRep_HLRToShape.hxx>
+#include <HLRBRep_MultiViewAlgo.hxx>
+#include <HLRBRep_PolyAlgo.hxx>
+#include <HLRBRep_PolyHLRToShape.hxx>
 #include <HLRTest_OutLiner.hxx>
 #include <HLRTest_Projector.hxx>
 #include <HLRTopoBRep_OutLiner.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopoDS_Shape.hxx>
 #include <BRep_Builder.hxx>
+#include <TCollection_AsciiString.hxx>
 
 static Handle(HLRBRep_Algo) hider;
 #ifdef _WIN32
@@ -311,8 +316,9 @@ upda (Draw_Interpretor& , Standard_Integer, const char**)
 //=======================================================================
 
 static Standard_Integer
-hide (Draw_Interpretor& , Standard_Integer, const char**)
+hide (Draw_Interpretor& , Standard_Integer n, const char** a)
 {
+  hider->SetRunParallel(n > 1 && !strcasecmp(a[1], "-parallel"));
   hider->Hide();
   return 0;
 }
@@ -409,6 +415,102 @@ hres (Draw_Interpretor& , Standard_Integer n, const char** a)
   return 0;
 }
 
+//=======================================================================
+//function : hviews
+//purpose  : 
+//=======================================================================
+
+static Standard_Integer
+hviews (Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  if (n < 4) return 1;
+  TopoDS_Shape S = DBRep::Get(a[2]);
+  if (S.IsNull()) {
+    di << a[2] << " is not a shape.\n";
+    return 1;
+  }
+  HLRBRep_MultiViewAlgo anAlgo;
+  anAlgo.Add(S);
+  for (Standard_Integer i = 3; i < n; i++) {
+    if (!strcasecmp(a[i], "-parallel")) {
+      anAlgo.SetRunParallel(Standard_True);
+      continue;
+    }
+    const char *name = a[i];
+    HLRAlgo_Projector P;
+    if (!HLRTest::GetProjector(name,P)) {
+      di << name << " is not a projector.\n";
+      return 1;
+    }
+    anAlgo.AddView(P);
+  }
+  if (anAlgo.NbViews() == 0) return 1;
+  anAlgo.Perform();
+
+  BRep_Builder B;
+  for (Standard_Integer v = 1; v <= anAlgo.NbViews(); v++) {
+    HLRBRep_HLRToShape HS(anAlgo.View(v));
+    TopoDS_Shape aVisible[5] = { HS.VCompound(), HS.Rg1LineVCompound(), HS.RgNLineVCompound(),
+                                 HS.OutLineVCompound(), HS.IsoLineVCompound() };
+    TopoDS_Compound C;
+    B.MakeCompound(C);
+    for (Standard_Integer k = 0; k < 5; k++) {
+      if (!aVisible[k].IsNull()) B.Add(C,aVisible[k]);
+    }
+    TCollection_AsciiString aName = TCollection_AsciiString(a[1]) + "_" + v;
+    DBRep::Set(aName.ToCString(),C);
+    di << aName << " ";
+  }
+  return 0;
+}
+
+//=======================================================================
+//function : hpolyhlr
+//purpose  : 
+//=======================================================================
+
+static Standard_Integer
+hpolyhlr (Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  if (n < 4) return 1;
+  TopoDS_Shape S = DBRep::Get(a[2]);
+  if (S.IsNull()) {
+    di << a[2] << " is not a shape.\n";
+    return 1;
+  }
+  HLRAlgo_Projector P;
+  if (!HLRTest::GetProjector(a[3],P)) {
+    di << a[3] << " is not a projector.\n";
+    return 1;
+  }
+  Standard_Boolean isParallel = Standard_False;
+  if (n > 4) {
+    if (strcasecmp(a[4], "-parallel")) {
+      di << "Syntax error: unknown argument '" << a[4] << "'\n";
+      return 1;
+    }
+    isParallel = Standard_True;
+  }
+
+  Handle(HLRBRep_PolyAlgo) anAlgo = new HLRBRep_PolyAlgo(S);
+  anAlgo->Projector(P);
+  anAlgo->SetRunParallel(isParallel);
+  anAlgo->Update();
+
+  HLRBRep_PolyHLRToShape HS;
+  HS.Update(anAlgo);
+  TopoDS_Shape aVisible[4] = { HS.VCompound(), HS.Rg1LineVCompound(),
+                               HS.RgNLineVCompound(), HS.OutLineVCompound() };
+  BRep_Builder B;
+  TopoDS_Compound C;
+  B.MakeCompound(C);
+  for (Standard_Integer k = 0; k < 4; k++) {
+    if (!aVisible[k].IsNull()) B.Add(C,aVisible[k]);
+  }
+  DBRep::Set(a[1],C);
+  return 0;
+}
+
 //=======================================================================
 //function : reflectlines
 //purpose  : 
@@ -572,11 +674,19 @@ void HLRTest::Commands (Draw_Interpretor& theCommands)
   theCommands.Add("hremove"  ,"hremove [name]"              ,__FILE__,hrem,g);
   theCommands.Add("hsetprj"  ,"hsetprj [name]"              ,__FILE__,sprj,g);
   theCommands.Add("hupdate"  ,"hupdate"                     ,__FILE__,upda,g);
-  theCommands.Add("hhide"    ,"hhide"                       ,__FILE__,hide,g);
+  theCommands.Add("hhide"    ,"hhide [-parallel]"           ,__FILE__,hide,g);
   theCommands.Add("hshowall" ,"hshowall"                    ,__FILE__,show,g);
   theCommands.Add("hdebug"   ,"hdebug"                      ,__FILE__,hdbg,g);
   theCommands.Add("hnullify" ,"hnullify"                    ,__FILE__,hnul,g);
   theCommands.Add("hres2d"   ,"hres2d"                      ,__FILE__,hres,g);
+  theCommands.Add("hviews"   ,"hviews result shape proj1 [proj2 ...] [-parallel]"
+                  "\n\t\t: Computes the visible lines of the shape for several projectors."
+                  "\n\t\t: The lines of i-th view are put into result_i.",
+                  __FILE__,hviews,g);
+  theCommands.Add("hpolyhlr" ,"hpolyhlr result shape proj [-parallel]"
+                  "\n\t\t: Computes the visible lines of the triangulated shape"
+                  "\n\t\t: by the polygonal algorithm.",
+                  __FILE__,hpolyhlr,g);
 
   theCommands.Add("reflectlines",
                   "reflectlines res shape proj_X proj_Y proj_Z",
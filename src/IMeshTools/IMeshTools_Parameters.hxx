@@ -39,7 +39,8 @@ struct IMeshTools_Parameters {
     CleanModel (Standard_True),
     AdjustMinSize (Standard_False),
     ForceFaceDeflection (Standard_False),
-    AllowQualityDecrease (Standard_False)
+    AllowQualityDecrease (Standard_False),
+    ShareInstances (Standard_False)
   {
   }
 
@@ -104,6 +105,12 @@ struct IMeshTools_Parameters {
   //! Allows/forbids the decrease of the quality of the generated mesh
   //! over the existing one.
   Standard_Boolean                                 AllowQualityDecrease;
+
+  //! Enables/disables meshing of each part of the shape once regardless of the number
+  //! of its occurrences with different locations. Parts are meshed in their own coordinate
+  //! systems, so relative deflection does not depend on the location of an occurrence.
+  //! Disabled by default.
+  Standard_Boolean                                 ShareInstances;
 };
 
 #endif
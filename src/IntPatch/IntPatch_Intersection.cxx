@@ -50,6 +50,7 @@ IntPatch_Intersection::IntPatch_Intersection ()
    myTolArc(0.0), myTolTang(0.0),
    myUVMaxStep(0.0), myFleche(0.0),
    myIsStartPnt(Standard_False),
+   myIsRunParallel(Standard_False),
    myU1Start(0.0),
    myV1Start(0.0),
    myU2Start(0.0),
@@ -73,6 +74,7 @@ IntPatch_Intersection::IntPatch_Intersection(const Handle(Adaptor3d_Surface)&  S
    myTolArc(TolArc), myTolTang(TolTang),
    myUVMaxStep(0.0), myFleche(0.0),
    myIsStartPnt(Standard_False),
+   myIsRunParallel(Standard_False),
    myU1Start(0.0),
    myV1Start(0.0),
    myU2Start(0.0),
@@ -99,6 +101,7 @@ IntPatch_Intersection::IntPatch_Intersection(const Handle(Adaptor3d_Surface)&  S
    myTolArc(TolArc), myTolTang(TolTang),
    myUVMaxStep(0.0), myFleche(0.0),
    myIsStartPnt(Standard_False),
+   myIsRunParallel(Standard_False),
    myU1Start(0.0),
    myV1Start(0.0),
    myU2Start(0.0),
@@ -1244,6 +1247,7 @@ void IntPatch_Intersection::ParamParamPerfom(const Handle(Adaptor3d_Surface)&  t
                                              const GeomAbs_SurfaceType typs2)
 {
   IntPatch_PrmPrmIntersection interpp;
+  interpp.SetRunParallel (myIsRunParallel);
   //
   if(!theD1->DomainIsInfinite() && !theD2->DomainIsInfinite())
   {
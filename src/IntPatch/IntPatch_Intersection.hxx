@@ -61,6 +61,14 @@ public:
   //! algorithms  to    compute the  distance between to
   //! points in their respective parametric spaces.
   Standard_EXPORT void SetTolerances (const Standard_Real TolArc, const Standard_Real TolTang, const Standard_Real UVMaxStep, const Standard_Real Fleche);
+
+  //! Sets the flag of parallel processing used by the
+  //! Parametric - Parametric intersection algorithm
+  //! (see IntPatch_PrmPrmIntersection::SetRunParallel()).
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  Standard_Boolean IsRunParallel() const { return myIsRunParallel; }
   
   //! Flag theIsReqToKeepRLine has been entered only for
   //! compatibility with TopOpeBRep package. It shall be deleted
@@ -193,6 +201,7 @@ private:
   Standard_Real myUVMaxStep;
   Standard_Real myFleche;
   Standard_Boolean myIsStartPnt;
+  Standard_Boolean myIsRunParallel;
   Standard_Real myU1Start;
   Standard_Real myV1Start;
   Standard_Real myU2Start;
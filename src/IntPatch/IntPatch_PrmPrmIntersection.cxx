@@ -32,6 +32,9 @@
 #include <IntSurf_ListIteratorOfListOfPntOn2S.hxx>
 #include <IntSurf_PntOn2S.hxx>
 #include <IntWalk_PWalking.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ErrorHandler.hxx>
 #include <Standard_OutOfRange.hxx>
 #include <StdFail_NotDone.hxx>
 #include <TColStd_Array1OfReal.hxx>
@@ -298,7 +301,8 @@ static void DublicateOfLinesProcessing( const IntWalk_PWalking& thePW,
 //==================================================================================
 IntPatch_PrmPrmIntersection::IntPatch_PrmPrmIntersection()
 : done(Standard_False),
-  empt(Standard_True)
+  empt(Standard_True),
+  myIsRunParallel(Standard_False)
 {
 }
 
@@ -2124,6 +2128,263 @@ IntSurf_PntOn2S MakeNewPoint(const IntSurf_PntOn2S& replacePnt,
   return NewPoint;
 }
 
+//=======================================================================
+//struct   : PrmPrmPreWalk
+//purpose  : Walking line computed from one starting point of a section
+//           line in advance of the main (sequential) processing
+//=======================================================================
+namespace
+{
+  struct PrmPrmPreWalk
+  {
+    PrmPrmPreWalk()
+    : Line (0),
+      PointIndex (0),
+      Walker (NULL),
+      HasStartPoint (Standard_False),
+      HasBeenAdded (Standard_False),
+      IsDone (Standard_False)
+    {
+      memset (Params, 0, sizeof (Params));
+      memset (Bounds, 0, sizeof (Bounds));
+      memset (MaxSteps, 0, sizeof (MaxSteps));
+      memset (MinSteps, 0, sizeof (MinSteps));
+    }
+
+    //! Returns TRUE if the walking has been started with the same steps
+    //! as the given tool is going to use.
+    Standard_Boolean IsStartedWith (const IntWalk_PWalking& theWalker) const
+    {
+      for (Standard_Integer i = 0; i < 4; ++i)
+      {
+        if (MaxSteps[i] != theWalker.MaxStep (i)
+         || MinSteps[i] != theWalker.MinStep (i))
+        {
+          return Standard_False;
+        }
+      }
+      return Standard_True;
+    }
+
+    Standard_Integer  Line;           //!< index of the section line
+    Standard_Integer  PointIndex;     //!< index of the starting point in the section line
+    Standard_Real     Params[4];      //!< approximate parameters of the starting point
+    Standard_Real     Bounds[8];      //!< UV-bounds of the section line on both surfaces
+    Standard_Real     MaxSteps[4];    //!< initial steps of the walking
+    Standard_Real     MinSteps[4];    //!< minimal steps of the walking
+    IntWalk_PWalking* Walker;         //!< walking tool keeping the result
+    IntSurf_PntOn2S   StartPOn2S;     //!< refined starting point
+    Standard_Boolean  HasStartPoint;
+    Standard_Boolean  HasBeenAdded;   //!< additional points have been inserted in the line
+    Standard_Boolean  IsDone;         //!< FALSE if the walking has to be repeated sequentially
+  };
+
+  typedef NCollection_Vector<PrmPrmPreWalk> PrmPrmVectorOfPreWalk;
+
+  //=======================================================================
+  //class    : PrmPrmPreWalkFunctor
+  //purpose  : Performs the walking from the given starting point using
+  //           own copies of the surface adaptors (they are not thread-safe)
+  //=======================================================================
+  class PrmPrmPreWalkFunctor
+  {
+  public:
+    PrmPrmPreWalkFunctor (PrmPrmVectorOfPreWalk&           theWalks,
+                          const Handle(Adaptor3d_Surface)& theSurf1,
+                          const Handle(Adaptor3d_Surface)& theSurf2,
+                          const Standard_Real              theTolTangency,
+                          const Standard_Real              theEpsilon,
+                          const Standard_Real              theDeflection,
+                          const Standard_Real              theIncrement)
+    : myWalks (theWalks),
+      mySurf1 (theSurf1),
+      mySurf2 (theSurf2),
+      myTolTangency (theTolTangency),
+      myEpsilon (theEpsilon),
+      myDeflection (theDeflection),
+      myIncrement (theIncrement)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      PrmPrmPreWalk& aWalk = myWalks.ChangeValue (theIndex);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        const Handle(Adaptor3d_Surface) aSurf1 = mySurf1->ShallowCopy();
+        const Handle(Adaptor3d_Surface) aSurf2 = mySurf2->ShallowCopy();
+        aWalk.Walker = new IntWalk_PWalking (aSurf1, aSurf2, myTolTangency,
+                                             myEpsilon, myDeflection, myIncrement);
+        IntWalk_PWalking& aPW = *aWalk.Walker;
+
+        TColStd_Array1OfReal aStartParams (aWalk.Params[0], 1, 4);
+        aWalk.HasStartPoint = aPW.PerformFirstPoint (aStartParams, aWalk.StartPOn2S);
+        if (aWalk.HasStartPoint)
+        {
+          const Standard_Real* aB = aWalk.Bounds;
+          aPW.InitSteps (aB[0], aB[1], aB[2], aB[3], aB[4], aB[5], aB[6], aB[7]);
+          for (Standard_Integer i = 0; i < 4; ++i)
+          {
+            aWalk.MaxSteps[i] = aPW.MaxStep (i);
+            aWalk.MinSteps[i] = aPW.MinStep (i);
+          }
+          aPW.Perform (aStartParams, aB[0], aB[1], aB[2], aB[3], aB[4], aB[5], aB[6], aB[7]);
+          if (aPW.IsDone() && aPW.NbPoints() > 2)
+          {
+            aPW.PutToBoundary (aSurf1, aSurf2);
+            const Standard_Integer aMinNbPoints = 40;
+            if (aPW.NbPoints() > 2 && aPW.NbPoints() < aMinNbPoints)
+            {
+              aWalk.HasBeenAdded = aPW.SeekAdditionalPoints (aSurf1, aSurf2, aMinNbPoints);
+            }
+          }
+        }
+        aWalk.IsDone = Standard_True;
+      }
+      catch (Standard_Failure const&)
+      {
+        aWalk.IsDone = Standard_False;
+      }
+    }
+
+  private:
+    PrmPrmPreWalkFunctor& operator= (const PrmPrmPreWalkFunctor&);
+
+  private:
+    PrmPrmVectorOfPreWalk&          myWalks;
+    const Handle(Adaptor3d_Surface) mySurf1;
+    const Handle(Adaptor3d_Surface) mySurf2;
+    const Standard_Real             myTolTangency;
+    const Standard_Real             myEpsilon;
+    const Standard_Real             myDeflection;
+    const Standard_Real             myIncrement;
+  };
+
+  //=======================================================================
+  //class    : PrmPrmPreWalks
+  //purpose  : Set of walking lines computed in advance, ordered by the
+  //           section lines and owning the walking tools
+  //=======================================================================
+  class PrmPrmPreWalks
+  {
+  public:
+    PrmPrmPreWalks() {}
+
+    ~PrmPrmPreWalks()
+    {
+      for (PrmPrmVectorOfPreWalk::Iterator anIt (myWalks); anIt.More(); anIt.Next())
+      {
+        delete anIt.ChangeValue().Walker;
+      }
+    }
+
+    //! Collects the first starting point of each section line, which is the one
+    //! tried by the sequential processing unless it lies on a line found before,
+    //! and performs the walking from these points in parallel.
+    void Perform (const IntPolyh_Intersection&     theInterference,
+                  const Standard_Integer*          theLines,
+                  const Standard_Integer           theNbLines,
+                  const Handle(Adaptor3d_Surface)& theSurf1,
+                  const Handle(Adaptor3d_Surface)& theSurf2,
+                  const Standard_Real              theTolTangency,
+                  const Standard_Real              theEpsilon,
+                  const Standard_Real              theDeflection,
+                  const Standard_Real              theIncrement)
+    {
+      try
+      {
+        OCC_CATCH_SIGNALS
+        // adaptors of some types cannot be copied
+        theSurf1->ShallowCopy();
+        theSurf2->ShallowCopy();
+      }
+      catch (Standard_Failure const&)
+      {
+        return;
+      }
+
+      for (Standard_Integer ls = 1; ls <= theNbLines; ++ls)
+      {
+        const Standard_Integer nbp = theInterference.NbPointsInLine (theLines[ls]);
+        if (!nbp)
+        {
+          continue;
+        }
+
+        Standard_Real aBounds[8], _x, _y, _z, incidence;
+        theInterference.GetLinePoint (theLines[ls], 1, _x, _y, _z,
+                                      aBounds[0], aBounds[1], aBounds[2], aBounds[3], incidence);
+        aBounds[4] = aBounds[0];
+        aBounds[5] = aBounds[1];
+        aBounds[6] = aBounds[2];
+        aBounds[7] = aBounds[3];
+        for (Standard_Integer ilig = 2; ilig <= nbp; ilig++)
+        {
+          Standard_Real aUV[4];
+          theInterference.GetLinePoint (theLines[ls], ilig, _x, _y, _z,
+                                        aUV[0], aUV[1], aUV[2], aUV[3], incidence);
+          for (Standard_Integer i = 0; i < 4; ++i)
+          {
+            aBounds[i]     = Min (aBounds[i],     aUV[i]);
+            aBounds[i + 4] = Max (aBounds[i + 4], aUV[i]);
+          }
+        }
+
+        // The other starting points of the line are tried by the main
+        // processing only if the walking from the first one has failed.
+        PrmPrmPreWalk& aWalk = myWalks.Appended();
+        aWalk.Line       = ls;
+        aWalk.PointIndex = (nbp > 1) ? nbp / 2 : 1;
+        theInterference.GetLinePoint (theLines[ls], aWalk.PointIndex, _x, _y, _z,
+                                      aWalk.Params[0], aWalk.Params[1],
+                                      aWalk.Params[2], aWalk.Params[3], incidence);
+        // the order of bounds expected by IntWalk_PWalking::Perform()
+        for (Standard_Integer i = 0; i < 8; ++i)
+        {
+          aWalk.Bounds[i] = aBounds[i];
+        }
+      }
+
+      if (myWalks.Size() < 2)
+      {
+        myWalks.Clear();
+        return;
+      }
+
+      PrmPrmPreWalkFunctor aFunctor (myWalks, theSurf1, theSurf2,
+                                     theTolTangency, theEpsilon, theDeflection, theIncrement);
+      OSD_Parallel::For (0, myWalks.Size(), aFunctor);
+    }
+
+    //! Returns the walking for the given starting point of the section line or NULL.
+    PrmPrmPreWalk* Find (const Standard_Integer theLine,
+                         const Standard_Integer thePointIndex)
+    {
+      // the walks are ordered by the section lines
+      for (Standard_Integer i = myWalks.Upper(); i >= myWalks.Lower(); --i)
+      {
+        PrmPrmPreWalk& aWalk = myWalks.ChangeValue (i);
+        if (aWalk.Line < theLine)
+        {
+          break;
+        }
+        if (aWalk.Line == theLine && aWalk.PointIndex == thePointIndex)
+        {
+          return &aWalk;
+        }
+      }
+      return NULL;
+    }
+
+  private:
+    PrmPrmPreWalks (const PrmPrmPreWalks&);
+    PrmPrmPreWalks& operator= (const PrmPrmPreWalks&);
+
+  private:
+    PrmPrmVectorOfPreWalk myWalks;
+  };
+}
+
 //==================================================================================
 // function : Perform
 // purpose  : base SS Int. function
@@ -2176,12 +2437,13 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_Surface)& Surf
 
     if ( D1->IsUniformSampling() || D2->IsUniformSampling() )
     {
-      pInterference = new IntPolyh_Intersection(Surf1,NbU1,NbV1,Surf2,NbU2,NbV2);
+      pInterference = new IntPolyh_Intersection(Surf1,NbU1,NbV1,Surf2,NbU2,NbV2,
+                                                myIsRunParallel);
     }
     else
     {
       pInterference = new IntPolyh_Intersection(Surf1, anUpars1, aVpars1, 
-        Surf2, anUpars2, aVpars2 );
+        Surf2, anUpars2, aVpars2, myIsRunParallel);
     }
 
     if ( !pInterference )
@@ -2248,6 +2510,15 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_Surface)& Surf
         while(triok==Standard_False);
       }
 
+      // Walking from the first starting points of the section lines
+      // is performed in advance in parallel
+      PrmPrmPreWalks aPreWalks;
+      if (myIsRunParallel)
+      {
+        aPreWalks.Perform (Interference, TabL, nbLigSec, Surf1, Surf2,
+                           TolTangency, Epsilon, Deflection, Increment);
+      }
+
       //----------------------------------------
       // 1.2 For the line "ls" get 2D-bounds U,V for surfaces 1,2
       //
@@ -2344,7 +2615,21 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_Surface)& Surf
             StartParams(3) = U2;
             StartParams(4) = V2;
 
-            HasStartPoint = PW.PerformFirstPoint(StartParams,StartPOn2S);
+            PrmPrmPreWalk* aPreWalk = aPreWalks.Find (ls, nbps2);
+            if (aPreWalk != NULL && !aPreWalk->IsDone)
+            {
+              aPreWalk = NULL;
+            }
+
+            if (aPreWalk != NULL)
+            {
+              HasStartPoint = aPreWalk->HasStartPoint;
+              StartPOn2S    = aPreWalk->StartPOn2S;
+            }
+            else
+            {
+              HasStartPoint = PW.PerformFirstPoint(StartParams,StartPOn2S);
+            }
             dminiPointLigne = SeuildPointLigne + SeuildPointLigne;
             if(HasStartPoint)
             {
@@ -2363,37 +2648,69 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_Surface)& Surf
 
               if(dminiPointLigne > SeuildPointLigne)
               {
-                PW.Perform(StartParams, UminLig1, VminLig1, UminLig2, VminLig2,
-                  UmaxLig1, VmaxLig1, UmaxLig2, VmaxLig2);
+                if (aPreWalk != NULL)
+                {
+                  // The walking performed in advance is taken only if it has been
+                  // started with the steps accumulated by the sequential walkings,
+                  // the sequential tool then continues from its final state.
+                  PW.InitSteps(UminLig1, VminLig1, UminLig2, VminLig2,
+                    UmaxLig1, VmaxLig1, UmaxLig2, VmaxLig2);
+                  if (aPreWalk->IsStartedWith (PW))
+                  {
+                    PW.CopySteps (*aPreWalk->Walker);
+                  }
+                  else
+                  {
+                    aPreWalk = NULL;
+                    PW.PerformFirstPoint(StartParams, StartPOn2S);
+                  }
+                }
+                if (aPreWalk == NULL)
+                {
+                  PW.Perform(StartParams, UminLig1, VminLig1, UminLig2, VminLig2,
+                    UmaxLig1, VmaxLig1, UmaxLig2, VmaxLig2);
+                }
+                IntWalk_PWalking& aPW = (aPreWalk != NULL) ? *aPreWalk->Walker : PW;
 
                 //
                 Standard_Boolean bPWIsDone;
                 Standard_Real aD11, aD12, aD21, aD22, aDx;
                 //
-                bPWIsDone=PW.IsDone();
+                bPWIsDone=aPW.IsDone();
 
                 if(bPWIsDone)
                 {
                   Standard_Boolean hasBeenAdded = Standard_False;
-                  if(PW.NbPoints() > 2 )
+                  if(aPW.NbPoints() > 2 )
                   {
-                    //Try to extend the intersection line to the boundary,
-                    //if it is possibly
-                    PW.PutToBoundary(Surf1, Surf2);
-                    //
-                    if (PW.NbPoints() < 3)
-                      continue;
+                    if (aPreWalk != NULL)
+                    {
+                      // the line has been already extended and completed
+                      if (aPW.NbPoints() < 3)
+                        continue;
 
-                    const Standard_Integer aMinNbPoints = 40;
-                    if(PW.NbPoints() < aMinNbPoints)
+                      hasBeenAdded = aPreWalk->HasBeenAdded;
+                    }
+                    else
                     {
-                      hasBeenAdded = PW.SeekAdditionalPoints(Surf1, Surf2, aMinNbPoints);
+                      //Try to extend the intersection line to the boundary,
+                      //if it is possibly
+                      PW.PutToBoundary(Surf1, Surf2);
+                      //
+                      if (PW.NbPoints() < 3)
+                        continue;
+
+                      const Standard_Integer aMinNbPoints = 40;
+                      if(PW.NbPoints() < aMinNbPoints)
+                      {
+                        hasBeenAdded = PW.SeekAdditionalPoints(Surf1, Surf2, aMinNbPoints);
+                      }
                     }
                     
-                    Standard_Integer iPWNbPoints = PW.NbPoints(), aNbPointsVer = 0;
+                    Standard_Integer iPWNbPoints = aPW.NbPoints(), aNbPointsVer = 0;
                     RejectLine = Standard_False;
-                    Point3dDebut = PW.Value(1).Value();
-                    Point3dFin = PW.Value(iPWNbPoints).Value();
+                    Point3dDebut = aPW.Value(1).Value();
+                    Point3dFin = aPW.Value(iPWNbPoints).Value();
                     for( ver = 1; (!RejectLine) && (ver<= NbLigCalculee); ++ver)
                     {
                       const Handle(IntPatch_WLine)& verwline = *((Handle(IntPatch_WLine)*)&SLin.Value(ver));
@@ -2429,8 +2746,8 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_Surface)& Surf
                         const gp_Pnt& aPx=verwline->Point(mx).Value();
                         for(m=1; m<iPWNbPoints; ++m)
                         {
-                          const gp_Pnt& aP1=PW.Value(m).Value();
-                          const gp_Pnt& aP2=PW.Value(m+1).Value();
+                          const gp_Pnt& aP1=aPW.Value(m).Value();
+                          const gp_Pnt& aP2=aPW.Value(m+1).Value();
                           gp_Vec aVec12(aP1, aP2);
                           if (aVec12.SquareMagnitude()<1.e-20)
                           {
@@ -2459,7 +2776,7 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_Surface)& Surf
 
                     if(RejectLine)
                     {
-                      DublicateOfLinesProcessing(PW, ver, SLin, RejectLine);
+                      DublicateOfLinesProcessing(aPW, ver, SLin, RejectLine);
                     }
 
                     if(!RejectLine)
@@ -2469,11 +2786,11 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_Surface)& Surf
                       gp_Vec norm1,norm2,d1u,d1v;
                       gp_Pnt ptbid;
                       Standard_Integer indextg;
-                      gp_Vec tgline(PW.TangentAtLine(indextg));
-                      PW.Line()->Value(indextg).ParametersOnS1(locu,locv);
+                      gp_Vec tgline(aPW.TangentAtLine(indextg));
+                      aPW.Line()->Value(indextg).ParametersOnS1(locu,locv);
                       Surf1->D1(locu,locv,ptbid,d1u,d1v);
                       norm1 = d1u.Crossed(d1v);
-                      PW.Line()->Value(indextg).ParametersOnS2(locu,locv);
+                      aPW.Line()->Value(indextg).ParametersOnS2(locu,locv);
                       Surf2->D1(locu,locv,ptbid,d1u,d1v);
                       norm2 = d1u.Crossed(d1v);
                       if( tgline.DotCross(norm2,norm1) >= 0. )
@@ -2488,7 +2805,7 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_Surface)& Surf
                       }
 
                       Standard_Real TolTang = TolTangency;
-                      Handle(IntPatch_WLine) wline = new IntPatch_WLine(PW.Line(),Standard_False,trans1,trans2);
+                      Handle(IntPatch_WLine) wline = new IntPatch_WLine(aPW.Line(),Standard_False,trans1,trans2);
                       wline->SetCreatingWayInfo(IntPatch_WLine::IntPatch_WLPrmPrm);
                       wline->EnablePurging(!hasBeenAdded);
                       //the method PutVertexOnLine can reduce the number of points in <wline>
@@ -2501,14 +2818,14 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_Surface)& Surf
                       if(wline->NbVertex() == 0)
                       {
                         IntPatch_Point vtx;
-                        IntSurf_PntOn2S POn2S = PW.Line()->Value(1);
+                        IntSurf_PntOn2S POn2S = aPW.Line()->Value(1);
                         POn2S.Parameters(pu1,pv1,pu2,pv2);
                         vtx.SetValue(Point3dDebut,TolTang,Standard_False);
                         vtx.SetParameters(pu1,pv1,pu2,pv2);
                         vtx.SetParameter(1);
                         wline->AddVertex(vtx);
 
-                        POn2S = PW.Line()->Value(wline->NbPnts());
+                        POn2S = aPW.Line()->Value(wline->NbPnts());
                         POn2S.Parameters(pu1,pv1,pu2,pv2);
                         vtx.SetValue(Point3dFin,TolTang,Standard_False);
                         vtx.SetParameters(pu1,pv1,pu2,pv2);
@@ -2519,8 +2836,8 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_Surface)& Surf
                       lignetrouvee = Standard_True;
 
                       SeveralWlinesProcessing(Surf1, Surf2, SLin, Periods, trans1, trans2,
-                                              TolTang, Max(PW.MaxStep(0), PW.MaxStep(1)),
-                                              Max(PW.MaxStep(2), PW.MaxStep(3)), wline);
+                                              TolTang, Max(aPW.MaxStep(0), aPW.MaxStep(1)),
+                                              Max(aPW.MaxStep(2), aPW.MaxStep(3)), wline);
 
                       AddWLine(SLin, wline, Deflection);
                       empt = Standard_False;
@@ -40,6 +40,18 @@ public:
   
   //! Empty Constructor
   Standard_EXPORT IntPatch_PrmPrmIntersection();
+
+  //! Sets the flag of parallel processing.
+  //! When enabled, the couples of triangles of the approximated polyhedrons
+  //! are checked for interference in parallel, and the walking lines starting
+  //! from the first points of different section lines are computed concurrently.
+  //! A line walked in advance is used only if it has been started with the steps
+  //! which the sequential processing would use at this moment, otherwise
+  //! the walking is repeated sequentially, so that the result does not depend on this flag.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  Standard_Boolean IsRunParallel() const { return myIsRunParallel; }
   
   //! Performs the intersection between <Caro1>  and
   //! <Caro2>.  Associated Polyhedrons <Polyhedron1>
@@ -144,6 +156,7 @@ private:
 
   Standard_Boolean done;
   Standard_Boolean empt;
+  Standard_Boolean myIsRunParallel;
   IntPatch_SequenceOfLine SLin;
 
 
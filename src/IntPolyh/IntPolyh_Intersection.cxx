@@ -36,7 +36,8 @@ static Standard_Integer ComputeIntersection(IntPolyh_PMaillageAffinage& theMaill
 //purpose  : 
 //=======================================================================
 IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& theS1,
-                                             const Handle(Adaptor3d_Surface)& theS2)
+                                             const Handle(Adaptor3d_Surface)& theS2,
+                                             const Standard_Boolean            theToRunParallel)
 {
   mySurf1 = theS1;
   mySurf2 = theS2;
@@ -44,6 +45,7 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
   myNbSV1 = 10;
   myNbSU2 = 10;
   myNbSV2 = 10;
+  myToRunParallel = theToRunParallel;
   myIsDone = Standard_False;
   myIsParallel = Standard_False;
   mySectionLines.Init(1000);
@@ -60,7 +62,8 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
                                              const Standard_Integer            theNbSV1,
                                              const Handle(Adaptor3d_Surface)& theS2,
                                              const Standard_Integer            theNbSU2,
-                                             const Standard_Integer            theNbSV2)
+                                             const Standard_Integer            theNbSV2,
+                                             const Standard_Boolean            theToRunParallel)
 {
   mySurf1 = theS1;
   mySurf2 = theS2;
@@ -68,6 +71,7 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
   myNbSV1 = theNbSV1;
   myNbSU2 = theNbSU2;
   myNbSV2 = theNbSV2;
+  myToRunParallel = theToRunParallel;
   myIsDone = Standard_False;
   myIsParallel = Standard_False;
   mySectionLines.Init(1000);
@@ -84,7 +88,8 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
                                              const TColStd_Array1OfReal&       theVPars1,
                                              const Handle(Adaptor3d_Surface)& theS2,
                                              const TColStd_Array1OfReal&       theUPars2,
-                                             const TColStd_Array1OfReal&       theVPars2)
+                                             const TColStd_Array1OfReal&       theVPars2,
+                                             const Standard_Boolean            theToRunParallel)
 {
   mySurf1 = theS1;
   mySurf2 = theS2;
@@ -92,6 +97,7 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
   myNbSV1 = theVPars1.Length();
   myNbSU2 = theUPars2.Length();
   myNbSV2 = theVPars2.Length();
+  myToRunParallel = theToRunParallel;
   myIsDone = Standard_False;
   myIsParallel = Standard_False;
   mySectionLines.Init(1000);
@@ -348,6 +354,7 @@ Standard_Boolean IntPolyh_Intersection::PerformMaillage(const TColStd_Array1OfRe
     new IntPolyh_MaillageAffinage(mySurf1, theUPars1.Length(), theVPars1.Length(),
                                   mySurf2, theUPars2.Length(), theVPars2.Length(),
                                   0);
+  theMaillage->SetRunParallel(myToRunParallel);
 
   theMaillage->FillArrayOfPnt(1, theUPars1, theVPars1, &theDeflTol1);
   theMaillage->FillArrayOfPnt(2, theUPars2, theVPars2, &theDeflTol2);
@@ -398,6 +405,7 @@ Standard_Boolean IntPolyh_Intersection::PerformMaillage(const TColStd_Array1OfRe
     new IntPolyh_MaillageAffinage(mySurf1, theUPars1.Length(), theVPars1.Length(),
                                   mySurf2, theUPars2.Length(), theVPars2.Length(),
                                   0);
+  theMaillage->SetRunParallel(myToRunParallel);
 
   theMaillage->FillArrayOfPnt(1, theIsFirstFwd , thePoints1, theUPars1, theVPars1, theDeflTol1);
   theMaillage->FillArrayOfPnt(2, theIsSecondFwd, thePoints2, theUPars2, theVPars2, theDeflTol2);
@@ -43,6 +43,7 @@
 #include <TColStd_ListIteratorOfListOfInteger.hxx>
 #include <algorithm>
 #include <NCollection_IndexedDataMap.hxx>
+#include <OSD_Parallel.hxx>
 
 typedef NCollection_Array1<Standard_Integer> IntPolyh_ArrayOfInteger;
 typedef NCollection_IndexedDataMap
@@ -217,7 +218,7 @@ static
                                const IntPolyh_ArrayOfPoints& thePoints1,
                                IntPolyh_ArrayOfTriangles& theTriangles2,
                                const IntPolyh_ArrayOfPoints& thePoints2,
-                               IntPolyh_IndexedDataMapOfIntegerListOfInteger& theCouples)
+                               IntPolyh_BoxBndTreeSelector& theSelector)
 {
   // Use linear builder for BVH construction
   opencascade::handle<BVH_LinearBuilder<Standard_Real, 3>> aLBuilder =
@@ -253,10 +254,26 @@ static
   aBBTree2.Build();
 
   // 3. Perform selection of the interfering triangles
+  theSelector.SetBVHSets (&aBBTree1, &aBBTree2);
+  theSelector.Select();
+  theSelector.Sort();
+}
+
+//=======================================================================
+//function : GetInterferingTriangles
+//purpose  : Returns indices of the triangles with interfering bounding boxes
+//=======================================================================
+static
+  void GetInterferingTriangles(IntPolyh_ArrayOfTriangles& theTriangles1,
+                               const IntPolyh_ArrayOfPoints& thePoints1,
+                               IntPolyh_ArrayOfTriangles& theTriangles2,
+                               const IntPolyh_ArrayOfPoints& thePoints2,
+                               IntPolyh_IndexedDataMapOfIntegerListOfInteger& theCouples)
+{
   IntPolyh_BoxBndTreeSelector aSelector;
-  aSelector.SetBVHSets (&aBBTree1, &aBBTree2);
-  aSelector.Select();
-  aSelector.Sort();
+  GetInterferingTriangles(theTriangles1, thePoints1,
+                          theTriangles2, thePoints2,
+                          aSelector);
 
   const std::vector<IntPolyh_BoxBndTreeSelector::PairIDs>& aPairs = aSelector.Pairs();
   const Standard_Integer aNbPairs = static_cast<Standard_Integer>(aPairs.size());
@@ -271,6 +288,159 @@ static
   }
 }
 
+//=======================================================================
+//class : IntPolyh_TriangleBoxes
+//purpose  : Tight bounding boxes of the triangles (without gaps)
+//           stored as structure of arrays, so that the couples can be
+//           rejected by batches with branch-free comparisons
+//=======================================================================
+class IntPolyh_TriangleBoxes
+{
+public:
+
+  //! Computes the boxes of all triangles
+  IntPolyh_TriangleBoxes (const IntPolyh_ArrayOfTriangles& theTriangles,
+                          const IntPolyh_ArrayOfPoints&    thePoints)
+  : myMin (0, 3 * Max (theTriangles.NbItems(), 1) - 1),
+    myMax (0, 3 * Max (theTriangles.NbItems(), 1) - 1),
+    myNbItems (theTriangles.NbItems())
+  {
+    for (Standard_Integer i = 0; i < myNbItems; ++i)
+    {
+      const IntPolyh_Triangle& aT = theTriangles[i];
+      const IntPolyh_Point& aP1 = thePoints[aT.FirstPoint()];
+      const IntPolyh_Point& aP2 = thePoints[aT.SecondPoint()];
+      const IntPolyh_Point& aP3 = thePoints[aT.ThirdPoint()];
+      myMin (i)                  = minSR (aP1.X(), aP2.X(), aP3.X());
+      myMin (i + myNbItems)      = minSR (aP1.Y(), aP2.Y(), aP3.Y());
+      myMin (i + 2 * myNbItems)  = minSR (aP1.Z(), aP2.Z(), aP3.Z());
+      myMax (i)                  = maxSR (aP1.X(), aP2.X(), aP3.X());
+      myMax (i + myNbItems)      = maxSR (aP1.Y(), aP2.Y(), aP3.Y());
+      myMax (i + 2 * myNbItems)  = maxSR (aP1.Z(), aP2.Z(), aP3.Z());
+    }
+  }
+
+  //! Returns the minimal coordinates of the boxes along the given axis
+  const Standard_Real* MinCoords (const Standard_Integer theAxis) const
+  {
+    return &myMin (theAxis * myNbItems);
+  }
+
+  //! Returns the maximal coordinates of the boxes along the given axis
+  const Standard_Real* MaxCoords (const Standard_Integer theAxis) const
+  {
+    return &myMax (theAxis * myNbItems);
+  }
+
+private:
+  NCollection_Array1<Standard_Real> myMin; //!< X, Y and Z minimal coordinates of all boxes
+  NCollection_Array1<Standard_Real> myMax; //!< X, Y and Z maximal coordinates of all boxes
+  Standard_Integer myNbItems;
+};
+
+//=======================================================================
+//class : IntPolyh_TriContactFunctor
+//purpose  : Checks the contact of the triangles of the batch of couples
+//=======================================================================
+class IntPolyh_TriContactFunctor
+{
+public:
+
+  //! Number of couples processed in one batch
+  static const Standard_Integer THE_BATCH_SIZE = 256;
+
+  //! Value of the angle showing that it has not been computed
+  static Standard_Real UndefinedAngle() { return -3.0; }
+
+  //! Constructor
+  IntPolyh_TriContactFunctor (const IntPolyh_MaillageAffinage& theMaillage,
+                              const std::vector<IntPolyh_BoxBndTreeSelector::PairIDs>& thePairs,
+                              const IntPolyh_ArrayOfTriangles& theTriangles1,
+                              const IntPolyh_ArrayOfPoints&    thePoints1,
+                              const IntPolyh_TriangleBoxes&    theBoxes1,
+                              const IntPolyh_ArrayOfTriangles& theTriangles2,
+                              const IntPolyh_ArrayOfPoints&    thePoints2,
+                              const IntPolyh_TriangleBoxes&    theBoxes2,
+                              NCollection_Array1<Standard_Integer>& theContacts,
+                              NCollection_Array1<Standard_Real>&    theAngles)
+  : myMaillage (theMaillage),
+    myPairs (thePairs),
+    myTriangles1 (theTriangles1),
+    myPoints1 (thePoints1),
+    myBoxes1 (theBoxes1),
+    myTriangles2 (theTriangles2),
+    myPoints2 (thePoints2),
+    myBoxes2 (theBoxes2),
+    myContacts (theContacts),
+    myAngles (theAngles)
+  {}
+
+  //! Returns the number of batches
+  Standard_Integer NbBatches() const
+  {
+    return (static_cast<Standard_Integer> (myPairs.size()) + THE_BATCH_SIZE - 1) / THE_BATCH_SIZE;
+  }
+
+  //! Processes the batch of couples
+  void operator() (const Standard_Integer theBatchIndex) const
+  {
+    const Standard_Integer aFirst = theBatchIndex * THE_BATCH_SIZE;
+    const Standard_Integer aLast  = Min (aFirst + THE_BATCH_SIZE,
+                                         static_cast<Standard_Integer> (myPairs.size()));
+
+    // Rejection of the couples by the tight boxes of the triangles
+    for (Standard_Integer aDim = 0; aDim < 3; ++aDim)
+    {
+      const Standard_Real* aMin1 = myBoxes1.MinCoords (aDim);
+      const Standard_Real* aMax1 = myBoxes1.MaxCoords (aDim);
+      const Standard_Real* aMin2 = myBoxes2.MinCoords (aDim);
+      const Standard_Real* aMax2 = myBoxes2.MaxCoords (aDim);
+      for (Standard_Integer i = aFirst; i < aLast; ++i)
+      {
+        const Standard_Integer i1 = myPairs[i].ID1;
+        const Standard_Integer i2 = myPairs[i].ID2;
+        const Standard_Integer isOut = (aMax1[i1] < aMin2[i2]) | (aMin1[i1] > aMax2[i2]);
+        myContacts (i) = (aDim == 0 ? 1 : myContacts (i)) & (1 - isOut);
+      }
+    }
+
+    // Exact check of the remaining couples
+    for (Standard_Integer i = aFirst; i < aLast; ++i)
+    {
+      myAngles (i) = UndefinedAngle();
+      if (!myContacts (i))
+      {
+        continue;
+      }
+
+      const IntPolyh_Triangle& aT1 = myTriangles1[myPairs[i].ID1];
+      const IntPolyh_Triangle& aT2 = myTriangles2[myPairs[i].ID2];
+      myContacts (i) = myMaillage.TriContact (myPoints1[aT1.FirstPoint()],
+                                              myPoints1[aT1.SecondPoint()],
+                                              myPoints1[aT1.ThirdPoint()],
+                                              myPoints2[aT2.FirstPoint()],
+                                              myPoints2[aT2.SecondPoint()],
+                                              myPoints2[aT2.ThirdPoint()],
+                                              myAngles (i));
+    }
+  }
+
+private:
+  IntPolyh_TriContactFunctor& operator= (const IntPolyh_TriContactFunctor&);
+
+private:
+  const IntPolyh_MaillageAffinage& myMaillage;
+  const std::vector<IntPolyh_BoxBndTreeSelector::PairIDs>& myPairs;
+  const IntPolyh_ArrayOfTriangles& myTriangles1;
+  const IntPolyh_ArrayOfPoints&    myPoints1;
+  const IntPolyh_TriangleBoxes&    myBoxes1;
+  const IntPolyh_ArrayOfTriangles& myTriangles2;
+  const IntPolyh_ArrayOfPoints&    myPoints2;
+  const IntPolyh_TriangleBoxes&    myBoxes2;
+  NCollection_Array1<Standard_Integer>& myContacts;
+  NCollection_Array1<Standard_Real>&    myAngles;
+};
+
 //=======================================================================
 //function : IntPolyh_MaillageAffinage
 //purpose  : 
@@ -290,7 +460,8 @@ IntPolyh_MaillageAffinage::IntPolyh_MaillageAffinage
   FlecheMax2(0.0), 
   FlecheMin1(0.0), 
   FlecheMin2(0.0),
-  myEnlargeZone(Standard_False) 
+  myEnlargeZone(Standard_False),
+  myToRunParallel(Standard_False)
 { 
 }
 //=======================================================================
@@ -316,7 +487,8 @@ IntPolyh_MaillageAffinage::IntPolyh_MaillageAffinage
   FlecheMax2(0.0), 
   FlecheMin1(0.0), 
   FlecheMin2(0.0),
-  myEnlargeZone(Standard_False)
+  myEnlargeZone(Standard_False),
+  myToRunParallel(Standard_False)
 { 
 }
 //=======================================================================
@@ -2340,42 +2512,46 @@ Standard_Integer IntPolyh_MaillageAffinage::TriangleEdgeContact
 Standard_Integer IntPolyh_MaillageAffinage::TriangleCompare ()
 {
   // Find couples with interfering bounding boxes
-  IntPolyh_IndexedDataMapOfIntegerListOfInteger aDMILI;
+  IntPolyh_BoxBndTreeSelector aSelector;
   GetInterferingTriangles(TTriangles1, TPoints1,
                           TTriangles2, TPoints2,
-                          aDMILI);
-  if (aDMILI.IsEmpty()) {
+                          aSelector);
+  const std::vector<IntPolyh_BoxBndTreeSelector::PairIDs>& aPairs = aSelector.Pairs();
+  const Standard_Integer aNbPairs = static_cast<Standard_Integer>(aPairs.size());
+  if (aNbPairs == 0) {
     return 0;
   }
   //
-  Standard_Real CoupleAngle = -2.0;
+  // Intersection of the triangles of the couples by batches
+  const IntPolyh_TriangleBoxes aBoxes1(TTriangles1, TPoints1);
+  const IntPolyh_TriangleBoxes aBoxes2(TTriangles2, TPoints2);
+  NCollection_Array1<Standard_Integer> aContacts(0, aNbPairs - 1);
+  NCollection_Array1<Standard_Real> anAngles(0, aNbPairs - 1);
+  IntPolyh_TriContactFunctor aFunctor(*this, aPairs,
+                                      TTriangles1, TPoints1, aBoxes1,
+                                      TTriangles2, TPoints2, aBoxes2,
+                                      aContacts, anAngles);
+  OSD_Parallel::For(0, aFunctor.NbBatches(), aFunctor, !myToRunParallel);
   //
-  // Intersection of the triangles
-  Standard_Integer i, aNb = aDMILI.Extent();
-  for (i = 1; i <= aNb; ++i) {
-    const Standard_Integer i_S1 = aDMILI.FindKey(i);
-    IntPolyh_Triangle &Triangle1 =  TTriangles1[i_S1];
-    const IntPolyh_Point& P1 = TPoints1[Triangle1.FirstPoint()];
-    const IntPolyh_Point& P2 = TPoints1[Triangle1.SecondPoint()];
-    const IntPolyh_Point& P3 = TPoints1[Triangle1.ThirdPoint()];
-    //
-    const TColStd_ListOfInteger& aLI2 = aDMILI(i);
-    TColStd_ListOfInteger::Iterator aItLI(aLI2);
-    for (; aItLI.More(); aItLI.Next()) {
-      const Standard_Integer i_S2 = aItLI.Value();
-      IntPolyh_Triangle &Triangle2 =  TTriangles2[i_S2];
-      const IntPolyh_Point& Q1 = TPoints2[Triangle2.FirstPoint()];
-      const IntPolyh_Point& Q2 = TPoints2[Triangle2.SecondPoint()];
-      const IntPolyh_Point& Q3 = TPoints2[Triangle2.ThirdPoint()];
-      //
-      if (TriContact(P1, P2, P3, Q1, Q2, Q3, CoupleAngle)) {
-        IntPolyh_Couple aCouple(i_S1, i_S2, CoupleAngle);
-        TTrianglesContacts.Append(aCouple);
-        //
-        Triangle1.SetIntersection(Standard_True);
-        Triangle2.SetIntersection(Standard_True);
-      }
+  // Put the couples in contact into the list in the order of the couples.
+  // The angle is not computed for the triangles with degenerated normals,
+  // in this case the one of the previous couple is used.
+  Standard_Real CoupleAngle = -2.0;
+  for (Standard_Integer i = 0; i < aNbPairs; ++i) {
+    if (!aContacts(i)) {
+      continue;
+    }
+    if (anAngles(i) != IntPolyh_TriContactFunctor::UndefinedAngle()) {
+      CoupleAngle = anAngles(i);
     }
+    //
+    const Standard_Integer i_S1 = aPairs[i].ID1;
+    const Standard_Integer i_S2 = aPairs[i].ID2;
+    IntPolyh_Couple aCouple(i_S1, i_S2, CoupleAngle);
+    TTrianglesContacts.Append(aCouple);
+    //
+    TTriangles1[i_S1].SetIntersection(Standard_True);
+    TTriangles2[i_S2].SetIntersection(Standard_True);
   }
   return TTrianglesContacts.Extent();
 }
@@ -2882,6 +3058,22 @@ Standard_Boolean IntPolyh_MaillageAffinage::GetEnlargeZone() const
 {
   return myEnlargeZone;
 }
+//=======================================================================
+//function : SetRunParallel
+//purpose  : 
+//=======================================================================
+void IntPolyh_MaillageAffinage::SetRunParallel(const Standard_Boolean theToRunParallel)
+{
+  myToRunParallel = theToRunParallel;
+}
+//=======================================================================
+//function : IsRunParallel
+//purpose  : 
+//=======================================================================
+Standard_Boolean IntPolyh_MaillageAffinage::IsRunParallel() const
+{
+  return myToRunParallel;
+}
 
 //=======================================================================
 //function : GetMinDeflection
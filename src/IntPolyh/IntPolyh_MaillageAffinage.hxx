@@ -178,6 +178,13 @@ public:
 
   Standard_EXPORT Standard_Boolean GetEnlargeZone() const;
 
+  //! Sets the flag of parallel processing of the couples of
+  //! triangles with interfering boxes in TriangleCompare().
+  Standard_EXPORT void SetRunParallel (const Standard_Boolean theToRunParallel);
+
+  //! Returns the flag of parallel processing.
+  Standard_EXPORT Standard_Boolean IsRunParallel() const;
+
   //! returns FlecheMin
   Standard_EXPORT Standard_Real GetMinDeflection (const Standard_Integer SurfID) const;
 
@@ -212,6 +219,7 @@ private:
   IntPolyh_ListOfCouples TTrianglesContacts;
 
   Standard_Boolean myEnlargeZone;
+  Standard_Boolean myToRunParallel;
 
 };
 
@@ -30,6 +30,7 @@
 #include <gp_Pnt.hxx>
 #include <gp_Pnt2d.hxx>
 #include <IntTools_FClass2d.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <Precision.hxx>
 #include <TColgp_Array1OfPnt2d.hxx>
 #include <TColgp_SequenceOfPnt2d.hxx>
@@ -45,6 +46,7 @@
 #include <Poly.hxx>
 
 #include <stdio.h>
+#include <vector>
 
 //#define DEBUG_PCLASS_POLYGON
 #ifdef DEBUG_PCLASS_POLYGON
@@ -64,10 +66,11 @@ IntTools_FClass2d::IntTools_FClass2d()
 //purpose  : 
 //=======================================================================
 IntTools_FClass2d::IntTools_FClass2d(const TopoDS_Face& aFace,
-				     const Standard_Real TolUV) 
+				     const Standard_Real TolUV,
+				     const Standard_Boolean theToUseSlabs)
 : Toluv(TolUV), Face(aFace)
 {
-  Init(Face, Toluv);
+  Init(Face, Toluv, theToUseSlabs);
 }
 //=======================================================================
 //function : IsHole
@@ -82,7 +85,8 @@ Standard_Boolean IntTools_FClass2d::IsHole() const
 //purpose  : 
 //=======================================================================
 void IntTools_FClass2d::Init(const TopoDS_Face& aFace,
-			     const Standard_Real TolUV) 
+			     const Standard_Real TolUV,
+			     const Standard_Boolean theToUseSlabs)
 {
   Standard_Boolean WireIsNotEmpty, Ancienpnt3dinitialise, degenerated;
   Standard_Integer firstpoint, NbEdges;
@@ -111,8 +115,9 @@ void IntTools_FClass2d::Init(const TopoDS_Face& aFace,
   Toluv=TolUV;
   Face=aFace;
   Face.Orientation(TopAbs_FORWARD);
-  Handle(BRepAdaptor_Surface) surf = new BRepAdaptor_Surface();
-  surf->Initialize(aFace, Standard_False);
+  myFExplorer.reset();
+  mySurf = new BRepAdaptor_Surface();
+  mySurf->Initialize(Face, Standard_False);
   //
   Tole = 0.;
   Tol=0.;
@@ -480,7 +485,8 @@ void IntTools_FClass2d::Init(const TopoDS_Face& aFace,
         TabClass.Append((void *)new CSLib_Class2d(SeqPnt2d,
 						  FlecheU,
 						  FlecheV,
-						  Umin,Vmin,Umax,Vmax));
+						  Umin,Vmin,Umax,Vmax,
+						  theToUseSlabs));
         //
         if(Abs(aS) < Precision::SquareConfusion()) { 
           BadWire=1;
@@ -521,11 +527,11 @@ void IntTools_FClass2d::Init(const TopoDS_Face& aFace,
       TabOrien(1)=-1;
     }
     
-    if(   surf->GetType()==GeomAbs_Cone
-       || surf->GetType()==GeomAbs_Cylinder
-       || surf->GetType()==GeomAbs_Torus
-       || surf->GetType()==GeomAbs_Sphere
-       || surf->GetType()==GeomAbs_SurfaceOfRevolution) { 
+    if(   mySurf->GetType()==GeomAbs_Cone
+       || mySurf->GetType()==GeomAbs_Cylinder
+       || mySurf->GetType()==GeomAbs_Torus
+       || mySurf->GetType()==GeomAbs_Sphere
+       || mySurf->GetType()==GeomAbs_SurfaceOfRevolution) { 
       Standard_Real uuu=M_PI+M_PI-(Umax-Umin);
       if(uuu<0) uuu=0;
       U1 = Umin-uuu*0.5;
@@ -535,7 +541,7 @@ void IntTools_FClass2d::Init(const TopoDS_Face& aFace,
       U1=U2=0.0; 
     } 
     
-    if(surf->GetType()==GeomAbs_Torus) { 
+    if(mySurf->GetType()==GeomAbs_Torus) { 
       Standard_Real uuu=M_PI+M_PI-(Vmax-Vmin);
       if(uuu<0) uuu=0;
       
@@ -567,6 +573,89 @@ TopAbs_State IntTools_FClass2d::PerformInfinitePoint() const
 TopAbs_State IntTools_FClass2d::Perform
   (const gp_Pnt2d& _Puv,
    const Standard_Boolean RecadreOnPeriodic) const
+{ 
+  return Perform (_Puv, RecadreOnPeriodic, myFExplorer);
+}
+
+namespace
+{
+  //=======================================================================
+  //class    : IntTools_FClass2dFunctor
+  //purpose  : Classifies the points using the face explorer of the thread
+  //=======================================================================
+  class IntTools_FClass2dFunctor
+  {
+  public:
+    IntTools_FClass2dFunctor (const IntTools_FClass2d&           theClassifier,
+                              const TColgp_Array1OfPnt2d&        thePnts,
+                              const Standard_Boolean             theRecadreOnPeriodic,
+                              NCollection_Array1<TopAbs_State>&  theStates,
+                              std::vector<std::unique_ptr<BRepClass_FaceExplorer>>& theExplorers)
+    : myClassifier (theClassifier),
+      myPnts (thePnts),
+      myRecadreOnPeriodic (theRecadreOnPeriodic),
+      myStates (theStates),
+      myExplorers (theExplorers)
+    {}
+
+    void operator() (const Standard_Integer theThreadIndex,
+                     const Standard_Integer theIndex) const
+    {
+      myStates.ChangeValue (theIndex) =
+        myClassifier.Perform (myPnts.Value (theIndex), myRecadreOnPeriodic, myExplorers[theThreadIndex]);
+    }
+
+  private:
+    IntTools_FClass2dFunctor& operator= (const IntTools_FClass2dFunctor&);
+
+  private:
+    const IntTools_FClass2d&           myClassifier;
+    const TColgp_Array1OfPnt2d&        myPnts;
+    Standard_Boolean                   myRecadreOnPeriodic;
+    NCollection_Array1<TopAbs_State>&  myStates;
+    std::vector<std::unique_ptr<BRepClass_FaceExplorer>>& myExplorers;
+  };
+}
+
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+void IntTools_FClass2d::Perform (const TColgp_Array1OfPnt2d&       thePnts,
+                                 NCollection_Array1<TopAbs_State>& theStates,
+                                 const Standard_Boolean            theRecadreOnPeriodic,
+                                 const Standard_Boolean            theToRunParallel) const
+{
+  if (thePnts.IsEmpty())
+  {
+    theStates = NCollection_Array1<TopAbs_State>();
+    return;
+  }
+  theStates.Resize (thePnts.Lower(), thePnts.Upper(), Standard_False);
+  if (!mySurf.IsNull())
+  {
+    // compute the resolutions cached in the geometry before the parallel access
+    mySurf->UResolution (Toluv);
+    mySurf->VResolution (Toluv);
+  }
+
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = theToRunParallel ? aThreadPool->NbDefaultThreadsToLaunch() : 1;
+  OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+
+  std::vector<std::unique_ptr<BRepClass_FaceExplorer>> anExplorers (aLauncher.NbThreads());
+  IntTools_FClass2dFunctor aFunctor (*this, thePnts, theRecadreOnPeriodic, theStates, anExplorers);
+  aLauncher.Perform (thePnts.Lower(), thePnts.Upper() + 1, aFunctor);
+}
+
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+TopAbs_State IntTools_FClass2d::Perform
+  (const gp_Pnt2d& _Puv,
+   const Standard_Boolean RecadreOnPeriodic,
+   std::unique_ptr<BRepClass_FaceExplorer>& theFExplorer) const
 { 
   Standard_Integer nbtabclass = TabClass.Length();
   if (nbtabclass == 0)
@@ -581,8 +670,7 @@ TopAbs_State IntTools_FClass2d::Perform
   Standard_Real vv = v;
   TopAbs_State aStatus = TopAbs_UNKNOWN;
 
-  Handle(BRepAdaptor_Surface) surf = new BRepAdaptor_Surface();
-  surf->Initialize( Face, Standard_False );
+  const Handle(BRepAdaptor_Surface)& surf = mySurf;
   
   const Standard_Boolean IsUPer  = surf->IsUPeriodic();
   const Standard_Boolean IsVPer  = surf->IsVPeriodic();
@@ -661,11 +749,11 @@ TopAbs_State IntTools_FClass2d::Perform
       }
       //
 
-      if (myFExplorer.get() == NULL)
-        myFExplorer.reset (new BRepClass_FaceExplorer (Face));
+      if (theFExplorer.get() == NULL)
+        theFExplorer.reset (new BRepClass_FaceExplorer (Face));
 
       BRepClass_FClassifier aClassifier;
-      aClassifier.Perform(*myFExplorer, Puv, aFCTol);
+      aClassifier.Perform(*theFExplorer, Puv, aFCTol);
       aStatus = aClassifier.State();
     }
     
@@ -725,8 +813,7 @@ TopAbs_State IntTools_FClass2d::TestOnRestriction
   Standard_Real v=_Puv.Y();
   Standard_Real uu = u, vv = v;
 
-  Handle(BRepAdaptor_Surface) surf = new BRepAdaptor_Surface();
-  surf->Initialize( Face, Standard_False );
+  const Handle(BRepAdaptor_Surface)& surf = mySurf;
   const Standard_Boolean IsUPer  = surf->IsUPeriodic();
   const Standard_Boolean IsVPer  = surf->IsVPeriodic();
   const Standard_Real    uperiod = IsUPer ? surf->UPeriod() : 0.0;
@@ -22,7 +22,10 @@
 #include <Standard_Handle.hxx>
 
 #include <BRepClass_FaceExplorer.hxx>
+#include <BRepAdaptor_Surface.hxx>
 #include <BRepTopAdaptor_SeqOfPtr.hxx>
+#include <NCollection_Array1.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
 #include <TColStd_SequenceOfInteger.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopAbs_State.hxx>
@@ -42,12 +45,17 @@ public:
   Standard_EXPORT IntTools_FClass2d();
 
   //! Initializes algorithm by the face F
-  //! and tolerance Tol
-  Standard_EXPORT IntTools_FClass2d(const TopoDS_Face& F, const Standard_Real Tol);
+  //! and tolerance Tol.
+  //! theToUseSlabs enables the index of the segments of the polygons of the wires
+  //! (see CSLib_Class2d), it does not change the result of the classification.
+  Standard_EXPORT IntTools_FClass2d(const TopoDS_Face& F, const Standard_Real Tol,
+                                    const Standard_Boolean theToUseSlabs = Standard_True);
 
   //! Initializes algorithm by the face F
-  //! and tolerance Tol
-  Standard_EXPORT void Init (const TopoDS_Face& F, const Standard_Real Tol);
+  //! and tolerance Tol.
+  //! theToUseSlabs enables the index of the segments of the polygons of the wires.
+  Standard_EXPORT void Init (const TopoDS_Face& F, const Standard_Real Tol,
+                             const Standard_Boolean theToUseSlabs = Standard_True);
 
   //! Returns state of infinite 2d point relatively to (0, 0)
   Standard_EXPORT TopAbs_State PerformInfinitePoint() const;
@@ -58,6 +66,23 @@ public:
   //! classified.
   Standard_EXPORT TopAbs_State Perform (const gp_Pnt2d& Puv, const Standard_Boolean RecadreOnPeriodic = Standard_True) const;
 
+  //! Returns state of the 2d point Puv.
+  //! The face explorer theFExplorer is used (and created if empty) when the
+  //! point cannot be classified by the polygons of the wires, instead of the
+  //! one of the classifier. Thus, the method can be called concurrently
+  //! from several threads with different explorers.
+  Standard_EXPORT TopAbs_State Perform (const gp_Pnt2d& Puv,
+                                        const Standard_Boolean RecadreOnPeriodic,
+                                        std::unique_ptr<BRepClass_FaceExplorer>& theFExplorer) const;
+
+  //! Classifies the array of 2d points thePnts.
+  //! The states of the points are returned in theStates with the same bounds.
+  //! If theToRunParallel is true, the points are classified in parallel.
+  Standard_EXPORT void Perform (const TColgp_Array1OfPnt2d& thePnts,
+                                NCollection_Array1<TopAbs_State>& theStates,
+                                const Standard_Boolean theRecadreOnPeriodic = Standard_True,
+                                const Standard_Boolean theToRunParallel = Standard_False) const;
+
   //! Destructor
   Standard_EXPORT ~IntTools_FClass2d();
 
@@ -83,6 +108,7 @@ private:
   Standard_Real Vmin;
   Standard_Real Vmax;
   Standard_Boolean myIsHole;
+  Handle(BRepAdaptor_Surface) mySurf;
 
   mutable std::unique_ptr<BRepClass_FaceExplorer> myFExplorer;
 
@@ -509,6 +509,7 @@ void IntTools_FaceFace::Perform (const TopoDS_Face& aF1,
     }
     myIntersector.SetTolerances(TolArc, TolTang, UVMaxStep, Deflection); 
   }
+  myIntersector.SetRunParallel (theToRunParallel);
   
   if((aType1 != GeomAbs_BSplineSurface) &&
       (aType1 != GeomAbs_BezierSurface)  &&
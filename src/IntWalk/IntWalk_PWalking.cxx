@@ -637,6 +637,47 @@ static Standard_Boolean IsTangentExtCheck(const Handle(Adaptor3d_Surface)& theSu
   return Standard_True;
 }
 
+//==================================================================================
+// function : InitSteps
+// purpose  : 
+//==================================================================================
+void IntWalk_PWalking::InitSteps(const Standard_Real u1min,
+                                 const Standard_Real v1min,
+                                 const Standard_Real u2min,
+                                 const Standard_Real v2min,
+                                 const Standard_Real u1max,
+                                 const Standard_Real v1max,
+                                 const Standard_Real u2max,
+                                 const Standard_Real v2max)
+{
+  ComputePasInit(u1max - u1min,v1max - v1min,u2max - u2min,v2max - v2min);
+
+  for (Standard_Integer i=0; i<4; ++i)
+  {
+    if(pasuv[i]>10)
+    {
+      pasuv[i] = 10;
+    }
+
+    pasInit[i] = pasSav[i] = pasuv[i]; 
+  }
+}
+
+//==================================================================================
+// function : CopySteps
+// purpose  : 
+//==================================================================================
+void IntWalk_PWalking::CopySteps(const IntWalk_PWalking& theOther)
+{
+  for (Standard_Integer i = 0; i < 4; ++i)
+  {
+    pasuv[i]     = theOther.pasuv[i];
+    pasSav[i]    = theOther.pasSav[i];
+    pasInit[i]   = theOther.pasInit[i];
+    myStepMin[i] = theOther.myStepMin[i];
+  }
+}
+
 //==================================================================================
 // function : Perform
 // purpose  : 
@@ -675,17 +716,7 @@ void IntWalk_PWalking::Perform(const TColStd_Array1OfReal& ParDep,
   const Standard_Real ULast2  = Adaptor3d_HSurfaceTool::LastUParameter (Caro2);
   const Standard_Real VLast2  = Adaptor3d_HSurfaceTool::LastVParameter (Caro2);
   //
-  ComputePasInit(u1max - u1min,v1max - v1min,u2max - u2min,v2max - v2min);
-
-  for (Standard_Integer i=0; i<4; ++i)
-  {
-    if(pasuv[i]>10)
-    {
-      pasuv[i] = 10;
-    }
-
-    pasInit[i] = pasSav[i] = pasuv[i]; 
-  }
+  InitSteps(u1min, v1min, u2min, v2min, u1max, v1max, u2max, v2max);
   //
   line = new IntSurf_LineOn2S ();
   //
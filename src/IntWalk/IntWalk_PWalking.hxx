@@ -180,13 +180,38 @@ public:
                                                          const Handle(Adaptor3d_Surface)& theASurf2,
                                                          const Standard_Integer theMinNbPoints);
 
-  Standard_Real MaxStep(Standard_Integer theIndex)
+  Standard_Real MaxStep(Standard_Integer theIndex) const
   {
     Standard_OutOfRange_Raise_if ((theIndex < 0) || (theIndex > 3),
                                   "IntWalk_PWalking::MaxStep() - index is out of range");
     return pasInit[theIndex];
   }
 
+  //! Returns the minimal step of the walking along the given parameter
+  //! (see MaxStep() for the order of parameters).
+  Standard_Real MinStep(Standard_Integer theIndex) const
+  {
+    Standard_OutOfRange_Raise_if ((theIndex < 0) || (theIndex > 3),
+                                  "IntWalk_PWalking::MinStep() - index is out of range");
+    return myStepMin[theIndex];
+  }
+
+  //! Computes the initial steps of the walking inside the given UV-bounds
+  //! in the same way as Perform() does before the marching.
+  //! The steps are accumulated with the ones of the previous walkings.
+  Standard_EXPORT void InitSteps(const Standard_Real u1min,
+                                 const Standard_Real v1min,
+                                 const Standard_Real u2min,
+                                 const Standard_Real v2min,
+                                 const Standard_Real u1max,
+                                 const Standard_Real v1max,
+                                 const Standard_Real u2max,
+                                 const Standard_Real v2max);
+
+  //! Takes the current steps of the given tool, so that the next walking
+  //! starts in the same state as after the last walking of theOther.
+  Standard_EXPORT void CopySteps(const IntWalk_PWalking& theOther);
+
 
 
 protected:
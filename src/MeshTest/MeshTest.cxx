@@ -90,6 +90,9 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
   }
 
   TopoDS_ListOfShape aListOfShapes;
+  TopTools_IndexedMapOfShape aModifiedShapes;
+  bool toMeshUntriangulated = false;
+  TColStd_SequenceOfReal aLodDeflections;
   IMeshTools_Parameters aMeshParams;
   bool hasDefl = false, hasAngDefl = false, isPrsDefl = false;
 
@@ -132,6 +135,36 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
     {
       aMeshParams.AllowQualityDecrease = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
     }
+    else if (aNameCase == "-instances")
+    {
+      aMeshParams.ShareInstances = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aNameCase == "-lod"
+          && anArgIter + 1 < theNbArgs)
+    {
+      Standard_Real aVal = Draw::Atof (theArgVec[++anArgIter]);
+      if (aVal <= Precision::Confusion())
+      {
+        theDI << "Syntax error: invalid input parameter '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+      aLodDeflections.Append (aVal);
+    }
+    else if (aNameCase == "-modified"
+          && anArgIter + 1 < theNbArgs)
+    {
+      TopoDS_Shape aModified = DBRep::Get (theArgVec[++anArgIter]);
+      if (aModified.IsNull())
+      {
+        theDI << "Syntax error: null shapes are not allowed here '" << theArgVec[anArgIter] << "'\n";
+        return 1;
+      }
+      aModifiedShapes.Add (aModified);
+    }
+    else if (aNameCase == "-untriangulated")
+    {
+      toMeshUntriangulated = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
+    }
     else if (aNameCase == "-algo"
           && anArgIter + 1 < theNbArgs)
     {
@@ -282,7 +315,31 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
   BRepMesh_IncrementalMesh aMesher;
   aMesher.SetShape (aShape);
   aMesher.ChangeParameters() = aMeshParams;
-  aMesher.Perform (aContext, aProgress->Start());
+  if (!aLodDeflections.IsEmpty())
+  {
+    if (!aModifiedShapes.IsEmpty()
+     || toMeshUntriangulated)
+    {
+      theDI << "Syntax error: -lod option cannot be combined with -modified and -untriangulated options";
+      return 1;
+    }
+    aLodDeflections.Append (aMeshParams.Deflection);
+    aMesher.PerformLods (aLodDeflections, aProgress->Start());
+  }
+  else if (!aModifiedShapes.IsEmpty()
+        || toMeshUntriangulated)
+  {
+    aMesher.Update (aModifiedShapes, toMeshUntriangulated, aProgress->Start());
+  }
+  else if (aMeshParams.ShareInstances)
+  {
+    // default context created per part (using MeshAlgo) to mesh parts in parallel
+    aMesher.Perform (aProgress->Start());
+  }
+  else
+  {
+    aMesher.Perform (aContext, aProgress->Start());
+  }
 
   theDI << "Meshing statuses: ";
   const Standard_Integer aStatus = aMesher.GetStatusFlags();
@@ -1609,7 +1666,8 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:   [-algo {watson|delabella}]=watson"
     "\n\t\t:   [-di Value] [-ai Angle]=57.29"
     "\n\t\t:   [-int_vert_off {0|1}]=0 [-surf_def_off {0|1}]=0 [-adjust_min {0|1}]=0"
-    "\n\t\t:   [-force_face_def {0|1}]=0 [-decrease {0|1}]=0"
+    "\n\t\t:   [-force_face_def {0|1}]=0 [-decrease {0|1}]=0 [-instances {0|1}]=0"
+    "\n\t\t:   [-lod Deflection [-lod ...]] [-modified SubShape [-modified ...]] [-untriangulated {0|1}]=0"
     "\n\t\t: Builds triangular mesh for the shape."
     "\n\t\t:  LinDefl         linear deflection to control mesh quality;"
     "\n\t\t:  -angular        angular deflection for edges in deg (~28.64 deg = 0.5 rad by default);"
@@ -1629,7 +1687,18 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:  -adjust_min     enables local adjustment of min size depending on edge size (FALSE by default);"
     "\n\t\t:  -force_face_def disables usage of shape tolerances for computing face deflection (FALSE by default);"
     "\n\t\t:  -decrease       enforces the meshing of the shape even if current mesh satisfies the new criteria"
-    "\n\t\t:                  (FALSE by default).",
+    "\n\t\t:                  (FALSE by default);"
+    "\n\t\t:  -instances      meshes each part of the shape once regardless of the number of its occurrences"
+    "\n\t\t:                  with different locations, parts are meshed in parallel (FALSE by default);"
+    "\n\t\t:  -lod            adds the level of detail with the given linear deflection; all levels"
+    "\n\t\t:                  including the one with LinDefl are generated on the shared discrete model and stored"
+    "\n\t\t:                  in the list of triangulations of each face, the finest one becomes active;"
+    "\n\t\t:                  edges are discretized on the finest level, coarser levels take a part of its nodes;"
+    "\n\t\t:  -modified       updates the mesh of already meshed shape remeshing only the faces of the given"
+    "\n\t\t:                  modified sub-shape; triangulations of other faces and discretization of edges"
+    "\n\t\t:                  shared with them are kept as is;"
+    "\n\t\t:  -untriangulated updates the mesh of already meshed shape remeshing also the faces without"
+    "\n\t\t:                  triangulation, which are searched in the whole shape (FALSE by default).",
   __FILE__, incrementalmesh, g);
   theCommands.Add("tessellate","Builds triangular mesh for the surface, run w/o args for help",__FILE__, tessellate, g);
   theCommands.Add("MemLeakTest","MemLeakTest",__FILE__, MemLeakTest, g);
@@ -62,6 +62,7 @@
 #include <TColStd_HSequenceOfReal.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Face.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
 
 #include <stdio.h> 
@@ -1096,14 +1097,20 @@ static Standard_Integer splitface
 static Standard_Integer converttobspline
   (Draw_Interpretor& di, Standard_Integer argc, const char** argv)
 {
+  Standard_Boolean isParallel = Standard_False;
+  if (argc > 1 && !strcmp (argv[argc - 1], "-parallel")) {
+    isParallel = Standard_True;
+    argc--;
+  }
   if (argc<3) {
-    di << "Use: " << argv[0] << " result shape [options=ero]\n";
+    di << "Use: " << argv[0] << " result shape [options=ero] [-parallel]\n";
     di << "where options is combination of letters indicating kinds of\n";
     di << "surfaces to be converted:\n";
     di << "e - extrusion\n";
     di << "r - revolution\n";
     di << "o - offset\n";
-    di << "p - plane";
+    di << "p - plane\n";
+    di << "-parallel converts the geometry in parallel";
     return 1;
   }
   const char *options = ( argc > 3 ? argv[3] : "ero" );
@@ -1118,7 +1125,8 @@ static Standard_Integer converttobspline
     ShapeCustom::ConvertToBSpline (revsh, strchr (options, 'e') != 0,
                                           strchr (options, 'r') != 0,
                                           strchr (options, 'o') != 0,
-                                          strchr (options, 'p') != 0);
+                                          strchr (options, 'p') != 0,
+                                          isParallel);
   ShapeFix::SameParameter ( res, Standard_False );
   DBRep::Set ( argv[1], res );
   return 0;
@@ -1328,7 +1336,7 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
 {
   if (n < 3)
   {
-    di << "Use unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [-t val] [-a val]\n";
+    di << "Use unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [-t val] [-a val] [-parallel]\n";
     di << "options:\n";
     di << "s1 s2 ... to keep the given edges during unification of faces\n";
     di << "-f to switch off 'unify-faces' mode \n";
@@ -1338,6 +1346,7 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
     di << "+i to switch on 'allow internal edges' mode\n";
     di << "-t val to set linear tolerance\n";
     di << "-a val to set angular tolerance (in degrees)\n";
+    di << "-parallel to analyze the surfaces of the faces in parallel\n";
     di << "'unify-faces' and 'unify-edges' modes are switched on by default";
     return 1;
   }
@@ -1352,6 +1361,7 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
   Standard_Boolean anConBS = Standard_False;
   Standard_Boolean isAllowInternal = Standard_False;
   Standard_Boolean isSafeInputMode = Standard_True;
+  Standard_Boolean isParallel = Standard_False;
   Standard_Real aLinTol = Precision::Confusion();
   Standard_Real aAngTol = Precision::Angular();
   TopoDS_Shape aKeepShape;
@@ -1375,6 +1385,8 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
           anConBS = Standard_True;
         else if (!strcmp(a[i], "+i"))
           isAllowInternal = Standard_True;
+        else if (!strcmp(a[i], "-parallel"))
+          isParallel = Standard_True;
         else if (!strcmp(a[i], "-t") || !strcmp(a[i], "-a"))
         {
           if (++i < n)
@@ -1399,6 +1411,7 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
   Unifier().AllowInternalEdges(isAllowInternal);
   Unifier().SetLinearTolerance(aLinTol);
   Unifier().SetAngularTolerance(aAngTol);
+  Unifier().SetRunParallel(isParallel);
   Unifier().Build();
   TopoDS_Shape Result = Unifier().Shape();
 
@@ -1485,6 +1498,40 @@ static Standard_Integer reshape(Draw_Interpretor& /*theDI*/,
 
       aReShaper->Replace(aWhat, aWith);
     }
+    else if ( anOpt == "-replacesubs" )
+    {
+      if ( theArgc - i < 3 )
+      {
+        Message::SendFail() << "Error: not enough arguments for replacement";
+        return 1;
+      }
+
+      TopoDS_Shape aWhat = DBRep::Get(theArgv[++i]);
+      if ( aWhat.IsNull() )
+      {
+        Message::SendFail() << "Error: argument shape ('" << theArgv[i] << "') is null";
+        return 1;
+      }
+
+      TopoDS_Shape aWith = DBRep::Get(theArgv[++i]);
+      if ( aWith.IsNull() )
+      {
+        Message::SendFail() << "Error: replacement shape ('" << theArgv[i] << "') is null";
+        return 1;
+      }
+
+      if ( aWhat.NbChildren() != aWith.NbChildren() )
+      {
+        Message::SendFail() << "Error: different numbers of sub-shapes in '"
+                            << theArgv[i - 1] << "' and '" << theArgv[i] << "'";
+        return 1;
+      }
+
+      for ( TopoDS_Iterator aWhatIt(aWhat), aWithIt(aWith); aWhatIt.More(); aWhatIt.Next(), aWithIt.Next() )
+      {
+        aReShaper->Replace(aWhatIt.Value(), aWithIt.Value());
+      }
+    }
     else if ( anOpt == "-remove" )
     {
       if ( theArgc - i < 2 )
@@ -1654,7 +1701,7 @@ static Standard_Integer reshape(Draw_Interpretor& /*theDI*/,
   theCommands.Add ("splitface","result face [u usplit1 usplit2...] [v vsplit1 vsplit2 ...]",
 		   __FILE__,splitface,g);
   
-  theCommands.Add ("DT_ToBspl","result shape [options=erop]",
+  theCommands.Add ("DT_ToBspl","result shape [options=erop] [-parallel]",
 		   __FILE__,converttobspline,g);
   theCommands.Add ("DT_ClosedSplit","result shape",
 		   __FILE__,splitclosed,g);
@@ -1669,17 +1716,19 @@ static Standard_Integer reshape(Draw_Interpretor& /*theDI*/,
   theCommands.Add ("removeloc","result shape [remove_level(see ShapeEnum)]",__FILE__,removeloc,g);
   
   theCommands.Add ("unifysamedom",
-                   "unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [-t val] [-a val]",
+                   "unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [-t val] [-a val] [-parallel]",
                     __FILE__,unifysamedom,g);
 
   theCommands.Add ("copytranslate","result shape dx dy dz",__FILE__,copytranslate,g);
 
   theCommands.Add ("reshape",
-    "\n    reshape : result shape [-replace what with] [-remove what] [-until level]"
+    "\n    reshape : result shape [-replace what with] [-replacesubs what with] [-remove what] [-until level]"
     "\n    Basic utility for topological modification: "
     "\n      '-replace what with'   Replaces 'what' sub-shape with 'with' sub-shape"
+    "\n      '-replacesubs what with' Replaces each sub-shape of 'what' with the sub-shape"
+    "\n                             of 'with' at the same position"
     "\n      '-remove what'         Removes 'what' sub-shape"
-    "\n    Requests '-replace' and '-remove' can be repeated many times."
+    "\n    Requests '-replace', '-replacesubs' and '-remove' can be repeated many times."
     "\n    '-until level' specifies level until which shape for replcement/removal"
     "\n    will be searched.",
     __FILE__, reshape, g);
@@ -177,23 +177,35 @@ TopoDS_Shape ShapeBuild_ReShape::Apply (const TopoDS_Shape& shape,
   if ( st >= until ) return newsh;    // critere d arret
   if(st == TopAbs_VERTEX || st == TopAbs_SHAPE)
     return shape;
+  // the sub-shapes cannot be modified, skip the whole sub-tree
+  if ( ! HasRecordedSubShapes ( shape ) )
+    return shape;
   // define allowed types of components
 
   BRep_Builder B;
   
-  TopoDS_Shape result = shape.EmptyCopied();
+  // the copy of the shape is made only when the first modified sub-shape is met
+  TopoDS_Shape result;
   TopAbs_Orientation orient = shape.Orientation(); //JR/Hp: or -> orient
-  result.Orientation(TopAbs_FORWARD); // protect against INTERNAL or EXTERNAL shapes
   Standard_Boolean modif = Standard_False;
   Standard_Integer locStatus = myStatus;
   
   // apply recorded modifications to subshapes
-  for ( TopoDS_Iterator it(shape,Standard_False); it.More(); it.Next() ) {
+  Standard_Integer aNbPrevious = 0;
+  for ( TopoDS_Iterator it(shape,Standard_False); it.More(); it.Next(), aNbPrevious++ ) {
     TopoDS_Shape sh = it.Value();
     newsh = Apply ( sh, until );
     if ( newsh != sh ) {
       if ( ShapeExtend::DecodeStatus ( myStatus, ShapeExtend_DONE4 ) )
 	locStatus |= ShapeExtend::EncodeStatus ( ShapeExtend_DONE4 );
+      if ( ! modif ) {
+        result = shape.EmptyCopied();
+        result.Orientation(TopAbs_FORWARD); // protect against INTERNAL or EXTERNAL shapes
+        // add the preceding sub-shapes, which are not modified
+        TopoDS_Iterator aPrevIt(shape,Standard_False);
+        for ( Standard_Integer i = 0; i < aNbPrevious; i++, aPrevIt.Next() )
+          B.Add ( result, aPrevIt.Value() );
+      }
       modif = 1;
     }
     if ( newsh.IsNull() ) {
@@ -201,6 +213,8 @@ TopoDS_Shape ShapeBuild_ReShape::Apply (const TopoDS_Shape& shape,
       continue;
     }
     locStatus |= ShapeExtend::EncodeStatus ( ShapeExtend_DONE3 );
+    if ( ! modif )
+      continue;
     if ( st == TopAbs_COMPOUND || newsh.ShapeType() == sh.ShapeType()) { //fix for SAMTECH bug OCC322 about abcense internal vertices after sewing.
       B.Add ( result, newsh );
       continue;
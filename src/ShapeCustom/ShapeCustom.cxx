@@ -231,7 +231,8 @@ TopoDS_Shape ShapeCustom::ConvertToBSpline (const TopoDS_Shape& S,
 					    const Standard_Boolean extrMode,
 					    const Standard_Boolean revolMode,
 					    const Standard_Boolean offsetMode,
-					    const Standard_Boolean planeMode) 
+					    const Standard_Boolean planeMode,
+					    const Standard_Boolean theIsParallel) 
 {
   // Create a modification description
   Handle(ShapeCustom_ConvertToBSpline) BSRev = new ShapeCustom_ConvertToBSpline();
@@ -241,5 +242,6 @@ TopoDS_Shape ShapeCustom::ConvertToBSpline (const TopoDS_Shape& S,
   BSRev->SetPlaneMode(planeMode);
   TopTools_DataMapOfShapeShape context;
   BRepTools_Modifier MD;
+  MD.SetRunParallel(theIsParallel);
   return ShapeCustom::ApplyModifier ( S, BSRev, context, MD);
 }
@@ -32,6 +32,7 @@
 #include <Precision.hxx>
 #include <ShapeConstruct.hxx>
 #include <ShapeCustom_ConvertToBSpline.hxx>
+#include <ShapeExtend_BasicMsgRegistrator.hxx>
 #include <Standard_Type.hxx>
 #include <TopLoc_Location.hxx>
 #include <TopoDS_Edge.hxx>
@@ -246,6 +247,16 @@ GeomAbs_Shape ShapeCustom_ConvertToBSpline::Continuity (const TopoDS_Edge& E,
   return BRep_Tool::Continuity(E,F1,F2);
 }
 
+//=======================================================================
+//function : IsThreadSafe
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean ShapeCustom_ConvertToBSpline::IsThreadSafe() const
+{
+  return MsgRegistrator().IsNull();
+}
+
 void ShapeCustom_ConvertToBSpline::SetExtrusionMode(const Standard_Boolean extrMode)
 {
   myExtrMode = extrMode;
@@ -68,6 +68,18 @@ ShapeFix_Edge::ShapeFix_Edge()
   myProjector = new ShapeConstruct_ProjectCurveOnSurface;
 }
 
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+Handle(ShapeFix_Edge) ShapeFix_Edge::Copy() const
+{
+  Handle(ShapeFix_Edge) aCopy = new ShapeFix_Edge (*this);
+  aCopy->myProjector = new ShapeConstruct_ProjectCurveOnSurface (*myProjector);
+  return aCopy;
+}
+
 //=======================================================================
 //function : Projector
 //purpose  : 
@@ -54,6 +54,11 @@ public:
   
   //! Empty constructor
   Standard_EXPORT ShapeFix_Edge();
+
+  //! Returns a new tool with the same parameters and its own projector,
+  //! which can be used concurrently with this one.
+  //! The context is shared with this tool.
+  Standard_EXPORT Handle(ShapeFix_Edge) Copy() const;
   
   //! Returns the projector used for recomputing missing pcurves
   //! Can be used for adjusting parameters of projector
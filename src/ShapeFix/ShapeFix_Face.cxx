@@ -136,6 +136,18 @@ ShapeFix_Face::ShapeFix_Face(const TopoDS_Face &face)
   Init( face );
 }
 
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+Handle(ShapeFix_Face) ShapeFix_Face::Copy() const
+{
+  Handle(ShapeFix_Face) aCopy = new ShapeFix_Face (*this);
+  aCopy->myFixWire = myFixWire->Copy();
+  return aCopy;
+}
+
 //=======================================================================
 //function : ClearModes
 //purpose  : 
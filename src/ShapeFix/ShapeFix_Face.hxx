@@ -60,6 +60,12 @@ public:
   
   //! Creates a tool and loads a face
   Standard_EXPORT ShapeFix_Face(const TopoDS_Face& face);
+
+  //! Returns a new tool with the same modes and parameters and its own
+  //! tools for fixing wires and edges, which can be used concurrently
+  //! with this one (on faces without shared sub-shapes).
+  //! The context and message registrator are shared with this tool.
+  Standard_EXPORT Handle(ShapeFix_Face) Copy() const;
   
   //! Sets all modes to default
   Standard_EXPORT virtual void ClearModes();
@@ -101,6 +101,12 @@ public:
   //! Sets maximal allowed tolerance (also to FixSolidTool)
   Standard_EXPORT virtual void SetMaxTolerance (const Standard_Real maxtol) Standard_OVERRIDE;
 
+  //! Sets the flag of parallel fixing of faces of shells (to FixShellTool)
+  Standard_EXPORT void SetRunParallel (const Standard_Boolean theIsParallel);
+
+  //! Returns the flag of parallel fixing of faces of shells
+  Standard_EXPORT Standard_Boolean IsRunParallel() const;
+
   //! Returns (modifiable) the mode for applying fixes of
   //! ShapeFix_Solid, by default True.
     Standard_Integer& FixSolidMode();
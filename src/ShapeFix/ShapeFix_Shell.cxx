@@ -23,10 +23,16 @@
 #include <BRepBndLib.hxx>
 #include <Message_Msg.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Sequence.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <ShapeAnalysis_Shell.hxx>
 #include <ShapeBuild_ReShape.hxx>
+#include <ShapeExtend_BasicMsgRegistrator.hxx>
 #include <ShapeFix_Face.hxx>
+#include <ShapeFix_Edge.hxx>
 #include <ShapeFix_Shell.hxx>
+#include <ShapeFix_Wire.hxx>
 #include <Standard_Type.hxx>
 #include <TColStd_DataMapOfIntegerListOfInteger.hxx>
 #include <TColStd_MapOfInteger.hxx>
@@ -50,6 +56,143 @@
 
 IMPLEMENT_STANDARD_RTTIEXT(ShapeFix_Shell,ShapeFix_Root)
 
+namespace
+{
+  //! Message sent during fixing of a face
+  class ShapeFix_FaceMsgRecord : public Standard_Transient
+  {
+  public:
+
+    ShapeFix_FaceMsgRecord (const TopoDS_Shape& theShape,
+                            const Handle(Standard_Transient)& theObject,
+                            const Message_Msg& theMessage,
+                            const Message_Gravity theGravity)
+    : Shape (theShape), Object (theObject), Message (theMessage), Gravity (theGravity) {}
+
+    TopoDS_Shape               Shape;
+    Handle(Standard_Transient) Object;
+    Message_Msg                Message;
+    Message_Gravity            Gravity;
+  };
+
+  //! Message registrator keeping the messages sent during fixing of a face
+  //! to pass them to the main registrator in the order of faces.
+  class ShapeFix_FaceMsgCollector : public ShapeExtend_BasicMsgRegistrator
+  {
+  public:
+
+    virtual void Send (const Handle(Standard_Transient)& theObject,
+                       const Message_Msg& theMessage,
+                       const Message_Gravity theGravity) Standard_OVERRIDE
+    {
+      myRecords.Append (new ShapeFix_FaceMsgRecord (TopoDS_Shape(), theObject, theMessage, theGravity));
+    }
+
+    virtual void Send (const TopoDS_Shape& theShape,
+                       const Message_Msg& theMessage,
+                       const Message_Gravity theGravity) Standard_OVERRIDE
+    {
+      myRecords.Append (new ShapeFix_FaceMsgRecord (theShape, Handle(Standard_Transient)(), theMessage, theGravity));
+    }
+
+    virtual void Send (const Message_Msg& theMessage,
+                       const Message_Gravity theGravity) Standard_OVERRIDE
+    {
+      myRecords.Append (new ShapeFix_FaceMsgRecord (TopoDS_Shape(), Handle(Standard_Transient)(), theMessage, theGravity));
+    }
+
+    //! Sends the kept messages to the given registrator
+    void Flush (const Handle(ShapeExtend_BasicMsgRegistrator)& theTarget) const
+    {
+      for (NCollection_Sequence<Handle(ShapeFix_FaceMsgRecord)>::Iterator anIt (myRecords); anIt.More(); anIt.Next())
+      {
+        const ShapeFix_FaceMsgRecord& aRecord = *anIt.Value();
+        if (!aRecord.Shape.IsNull())
+        {
+          theTarget->Send (aRecord.Shape, aRecord.Message, aRecord.Gravity);
+        }
+        else if (!aRecord.Object.IsNull())
+        {
+          theTarget->Send (aRecord.Object, aRecord.Message, aRecord.Gravity);
+        }
+        else
+        {
+          theTarget->Send (aRecord.Message, aRecord.Gravity);
+        }
+      }
+    }
+
+  private:
+
+    NCollection_Sequence<Handle(ShapeFix_FaceMsgRecord)> myRecords;
+  };
+
+  //! Data of fixing of one face
+  struct ShapeFix_FaceTask
+  {
+    TopoDS_Face                       Face;     //!< Face to fix
+    Handle(ShapeBuild_ReShape)        Context;  //!< Modifications of the face
+    Handle(ShapeFix_FaceMsgCollector) Messages; //!< Messages sent for the face
+    Standard_Boolean                  IsDone;   //!< Result of ShapeFix_Face::Perform()
+  };
+
+  //! Functor fixing the faces by the tools of the threads
+  class ShapeFix_FaceFunctor
+  {
+  public:
+
+    ShapeFix_FaceFunctor (NCollection_Vector<ShapeFix_FaceTask>& theTasks,
+                          const NCollection_Array1<Handle(ShapeFix_Face)>& theTools)
+    : myTasks (theTasks),
+      myTools (theTools)
+    {}
+
+    void operator() (const Standard_Integer theThreadIndex,
+                     const Standard_Integer theTaskIndex) const
+    {
+      ShapeFix_FaceTask& aTask = myTasks.ChangeValue (theTaskIndex);
+      const Handle(ShapeFix_Face)& aTool = myTools.Value (theThreadIndex);
+      aTool->SetContext (aTask.Context);
+      aTool->FixWireTool()->SetContext (aTask.Context);
+      aTool->FixWireTool()->FixEdgeTool()->SetContext (aTask.Context);
+      if (!aTask.Messages.IsNull())
+      {
+        aTool->SetMsgRegistrator (aTask.Messages);
+      }
+      aTool->Init (aTask.Face);
+      aTask.IsDone = aTool->Perform();
+    }
+
+  private:
+    ShapeFix_FaceFunctor& operator= (const ShapeFix_FaceFunctor&);
+
+  private:
+    NCollection_Vector<ShapeFix_FaceTask>& myTasks;
+    const NCollection_Array1<Handle(ShapeFix_Face)>& myTools;
+  };
+
+  //! Returns true if the face has no edges and vertices in the map
+  Standard_Boolean isIndependent (const TopoDS_Shape& theFace,
+                                  const TopTools_MapOfShape& theUsed)
+  {
+    for (TopExp_Explorer anExp (theFace, TopAbs_VERTEX); anExp.More(); anExp.Next())
+    {
+      if (theUsed.Contains (anExp.Current()))
+      {
+        return Standard_False;
+      }
+    }
+    for (TopExp_Explorer anExp (theFace, TopAbs_EDGE); anExp.More(); anExp.Next())
+    {
+      if (theUsed.Contains (anExp.Current()))
+      {
+        return Standard_False;
+      }
+    }
+    return Standard_True;
+  }
+}
+
 //=======================================================================
 //function : ShapeFix_Shell
 //purpose  : 
@@ -62,6 +205,7 @@ ShapeFix_Shell::ShapeFix_Shell()
   myFixFace = new ShapeFix_Face;
   myNbShells =0;
   myNonManifold = Standard_False;
+  myIsParallel = Standard_False;
 }
 
 //=======================================================================
@@ -77,6 +221,7 @@ ShapeFix_Shell::ShapeFix_Shell(const TopoDS_Shell& shape)
   myFixFace = new ShapeFix_Face;
   Init(shape);
   myNonManifold = Standard_False;
+  myIsParallel = Standard_False;
 }
 
 //=======================================================================
@@ -113,17 +258,28 @@ Standard_Boolean ShapeFix_Shell::Perform(const Message_ProgressRange& theProgres
     // Start progress scope (no need to check if progress exists -- it is safe)
     Message_ProgressScope aPS(theProgress, "Fixing face", aNbFaces);
 
-    for( TopoDS_Iterator iter(S); iter.More() && aPS.More(); iter.Next(), aPS.Next() )
-    { 
-      TopoDS_Shape sh = iter.Value();
-      TopoDS_Face tmpFace = TopoDS::Face(sh);
-      myFixFace->Init(tmpFace);
-      if ( myFixFace->Perform() )
+    if (myIsParallel && aNbFaces > 1)
+    {
+      if (fixFacesParallel (S, aPS))
       {
         status = Standard_True;
         myStatus |= ShapeExtend::EncodeStatus ( ShapeExtend_DONE1 );
       }
     }
+    else
+    {
+      for( TopoDS_Iterator iter(S); iter.More() && aPS.More(); iter.Next(), aPS.Next() )
+      { 
+        TopoDS_Shape sh = iter.Value();
+        TopoDS_Face tmpFace = TopoDS::Face(sh);
+        myFixFace->Init(tmpFace);
+        if ( myFixFace->Perform() )
+        {
+          status = Standard_True;
+          myStatus |= ShapeExtend::EncodeStatus ( ShapeExtend_DONE1 );
+        }
+      }
+    }
 
     // Halt algorithm in case of user's abort
     if ( !aPS.More() )
@@ -1105,6 +1261,101 @@ Standard_Integer ShapeFix_Shell::NbShells() const
   return myNbShells;
 }
 
+//=======================================================================
+//function : fixFacesParallel
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean ShapeFix_Shell::fixFacesParallel (const TopoDS_Shape& theShell,
+                                                   Message_ProgressScope& thePS)
+{
+  Standard_Boolean isDone = Standard_False;
+
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aThreadPool->NbDefaultThreadsToLaunch());
+
+  // Each thread uses its own copy of the face fixing tool
+  NCollection_Array1<Handle(ShapeFix_Face)> aTools (0, aLauncher.NbThreads() - 1);
+  for (Standard_Integer anI = aTools.Lower(); anI <= aTools.Upper(); ++anI)
+  {
+    aTools.ChangeValue (anI) = myFixFace->Copy();
+  }
+
+  const Handle(ShapeExtend_BasicMsgRegistrator) aMsgReg = myFixFace->MsgRegistrator();
+
+  TopTools_SequenceOfShape aFaces;
+  for (TopoDS_Iterator anIt (theShell); anIt.More(); anIt.Next())
+  {
+    aFaces.Append (anIt.Value());
+  }
+
+  while (!aFaces.IsEmpty() && thePS.More())
+  {
+    // Select the faces which share no sub-shapes with the preceding faces
+    // still to be fixed (including the ones selected for this round),
+    // so that each face is fixed after all its preceding neighbours as in
+    // the sequential mode, taking into account the modifications made
+    // on the previous rounds
+    TopTools_MapOfShape aUsed;
+    TopTools_SequenceOfShape aPostponed;
+    NCollection_Vector<ShapeFix_FaceTask> aTasks;
+    Standard_Integer aNbSkipped = 0;
+    for (TopTools_SequenceOfShape::Iterator anIt (aFaces); anIt.More(); anIt.Next())
+    {
+      const TopoDS_Shape aFace = Context()->Apply (anIt.Value());
+      if (aFace.IsNull() || aFace.ShapeType() != TopAbs_FACE)
+      {
+        ++aNbSkipped;
+        continue;
+      }
+
+      const Standard_Boolean isFree = isIndependent (aFace, aUsed);
+      for (TopExp_Explorer anExp (aFace, TopAbs_VERTEX); anExp.More(); anExp.Next())
+      {
+        aUsed.Add (anExp.Current());
+      }
+      for (TopExp_Explorer anExp (aFace, TopAbs_EDGE); anExp.More(); anExp.Next())
+      {
+        aUsed.Add (anExp.Current());
+      }
+      if (!isFree)
+      {
+        aPostponed.Append (anIt.Value());
+        continue;
+      }
+
+      ShapeFix_FaceTask& aTask = aTasks.Appended();
+      aTask.Face = TopoDS::Face (aFace);
+      aTask.Context = new ShapeBuild_ReShape;
+      aTask.Context->ModeConsiderLocation() = Context()->ModeConsiderLocation();
+      if (!aMsgReg.IsNull())
+      {
+        aTask.Messages = new ShapeFix_FaceMsgCollector;
+      }
+      aTask.IsDone = Standard_False;
+    }
+
+    ShapeFix_FaceFunctor aFunctor (aTasks, aTools);
+    aLauncher.Perform (0, aTasks.Size(), aFunctor);
+
+    // Collect the results in the order of faces
+    for (NCollection_Vector<ShapeFix_FaceTask>::Iterator anIt (aTasks); anIt.More(); anIt.Next())
+    {
+      const ShapeFix_FaceTask& aTask = anIt.Value();
+      Context()->AddRecords (*aTask.Context);
+      if (!aTask.Messages.IsNull())
+      {
+        aTask.Messages->Flush (aMsgReg);
+      }
+      isDone = isDone || aTask.IsDone;
+    }
+
+    thePS.Next (aTasks.Size() + aNbSkipped);
+    aFaces = aPostponed;
+  }
+  return isDone;
+}
+
 //=======================================================================
 //function : SetNonManifoldFlag
 //purpose  : 
@@ -27,6 +27,7 @@
 
 class ShapeFix_Face;
 class ShapeExtend_BasicMsgRegistrator;
+class Message_ProgressScope;
 
 // resolve name collisions with X11 headers
 #ifdef Status
@@ -120,6 +121,24 @@ public:
   //! Sets NonManifold flag
   Standard_EXPORT virtual void SetNonManifoldFlag(const Standard_Boolean isNonManifold);
 
+  //! Sets the flag of parallel fixing of faces.
+  //! In parallel mode the faces are fixed in several rounds; in each round
+  //! the faces sharing no edges and vertices with the preceding faces still
+  //! to be fixed are processed concurrently by copies of FixFaceTool() with
+  //! their own contexts, which are then added to the main context in the order
+  //! of faces in the shell. Thus, as in the sequential mode, each face is fixed
+  //! after all the preceding faces adjacent to it.
+  void SetRunParallel (const Standard_Boolean theIsParallel)
+  {
+    myIsParallel = theIsParallel;
+  }
+
+  //! Returns the flag of parallel fixing of faces.
+  Standard_Boolean IsRunParallel() const
+  {
+    return myIsParallel;
+  }
+
 
   DEFINE_STANDARD_RTTIEXT(ShapeFix_Shell,ShapeFix_Root)
 
@@ -134,9 +153,15 @@ protected:
   Standard_Integer myFixOrientationMode;
   Standard_Integer myNbShells;
   Standard_Boolean myNonManifold;
+  Standard_Boolean myIsParallel;
 
 private:
 
+  //! Fixes the faces of the shell in parallel.
+  //! Returns true if at least one face has been fixed.
+  Standard_Boolean fixFacesParallel (const TopoDS_Shape& theShell,
+                                     Message_ProgressScope& thePS);
+
 
 
 
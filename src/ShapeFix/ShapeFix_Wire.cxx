@@ -144,6 +144,20 @@ ShapeFix_Wire::ShapeFix_Wire (
   Init ( wire, face, prec );
 }
 
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+Handle(ShapeFix_Wire) ShapeFix_Wire::Copy() const
+{
+  Handle(ShapeFix_Wire) aCopy = new ShapeFix_Wire (*this);
+  aCopy->myFixEdge = myFixEdge->Copy();
+  aCopy->myAnalyzer = new ShapeAnalysis_Wire;
+  aCopy->myAnalyzer->SetPrecision (myAnalyzer->Precision());
+  return aCopy;
+}
+
 //=======================================================================
 //function : SetPrecision
 //purpose  : 
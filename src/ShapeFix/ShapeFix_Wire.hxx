@@ -93,6 +93,12 @@ public:
   
   //! Empty Constructor, creates clear object with default flags
   Standard_EXPORT ShapeFix_Wire();
+
+  //! Returns a new tool with the same modes and parameters and its own
+  //! tools for analysis and fixing of edges, which can be used
+  //! concurrently with this one.
+  //! The context and message registrator are shared with this tool.
+  Standard_EXPORT Handle(ShapeFix_Wire) Copy() const;
   
   //! Create new object with default flags and prepare it for use
   //! (Loads analyzer with all the data for the wire and face)
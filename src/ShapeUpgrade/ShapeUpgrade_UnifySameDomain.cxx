@@ -48,6 +48,8 @@
 #include <gp_Dir.hxx>
 #include <gp_Lin.hxx>
 #include <IntPatch_ImpImpIntersection.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <ShapeAnalysis_Edge.hxx>
 #include <ShapeAnalysis_WireOrder.hxx>
 #include <ShapeAnalysis_Surface.hxx>
@@ -73,6 +75,7 @@
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_MapOfShape.hxx>
@@ -87,6 +90,8 @@
 #include <BRepTopAdaptor_FClass2d.hxx>
 #include <ElCLib.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
+#include <algorithm>
+#include <vector>
 #include <ElSLib.hxx>
 #include <GeomProjLib.hxx>
 
@@ -1180,6 +1185,58 @@ static Standard_Boolean AddOrdinaryEdges(TopTools_SequenceOfShape& edges,
   return isDropped;
 }
 
+//=======================================================================
+//function : AddOrdinaryEdges
+//purpose  : auxiliary
+//=======================================================================
+// the same as above for the vector of edges with the map of indices of
+// the edges present in it; the dropped edges are not removed from the vector
+// but only unbound from the map, so that adding of a face does not depend
+// on the number of the edges collected so far
+static void AddOrdinaryEdges(NCollection_Vector<TopoDS_Shape>& theEdges,
+                             TopTools_DataMapOfShapeInteger& theEdgeIndices,
+                             const TopoDS_Shape& theShape,
+                             TopTools_SequenceOfShape& theRemovedEdges)
+{
+  //map of edges
+  TopTools_IndexedMapOfShape aNewEdges;
+  //add edges without seams
+  for (TopExp_Explorer anExp (theShape, TopAbs_EDGE); anExp.More(); anExp.Next())
+  {
+    const TopoDS_Shape& anEdge = anExp.Current();
+    if (aNewEdges.Contains (anEdge))
+    {
+      aNewEdges.RemoveKey (anEdge);
+      theRemovedEdges.Append (anEdge);
+    }
+    else
+      aNewEdges.Add (anEdge);
+  }
+
+  //drop the edges already present, in the order of their addition
+  std::vector<Standard_Integer> aDropped;
+  for (Standard_Integer i = 1; i <= aNewEdges.Extent(); i++)
+  {
+    if (const Standard_Integer* anIndex = theEdgeIndices.Seek (aNewEdges (i)))
+      aDropped.push_back (*anIndex);
+  }
+  std::sort (aDropped.begin(), aDropped.end());
+  for (std::vector<Standard_Integer>::const_iterator anIt = aDropped.begin(); anIt != aDropped.end(); ++anIt)
+  {
+    const TopoDS_Shape& aCurrent = theEdges (*anIt);
+    aNewEdges.RemoveKey (aCurrent);
+    theEdgeIndices.UnBind (aCurrent);
+    theRemovedEdges.Append (aCurrent);
+  }
+
+  //add edges to the vector
+  for (Standard_Integer i = 1; i <= aNewEdges.Extent(); i++)
+  {
+    theEdgeIndices.Bind (aNewEdges (i), theEdges.Length());
+    theEdges.Append (aNewEdges (i));
+  }
+}
+
 //=======================================================================
 //function : getCylinder
 //purpose  : auxiliary
@@ -1320,12 +1377,56 @@ static Standard_Boolean GetNormalToSurface(const TopoDS_Face& theFace,
   return Standard_True;
 }
 
+namespace
+{
+  //! Surface of the face analyzed once for comparison with
+  //! the surfaces of the neighbour faces
+  struct UnifySurfaceInfo
+  {
+    Handle(Geom_Surface) Surface;  //!< Located surface without trimming
+    gp_Pln               Plane;    //!< Plane of the surface if it is planar
+    Standard_Boolean     IsPlanar; //!< Planarity flag
+
+    UnifySurfaceInfo() : IsPlanar (Standard_False) {}
+  };
+
+  //! Functor analyzing the surfaces of the faces
+  class UnifySurfaceInfoFunctor
+  {
+  public:
+    UnifySurfaceInfoFunctor (const TopTools_IndexedMapOfShape& theFaces,
+                             NCollection_Array1<UnifySurfaceInfo>& theInfos,
+                             const Standard_Real theLinTol)
+    : myFaces (theFaces), myInfos (theInfos), myLinTol (theLinTol) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      UnifySurfaceInfo& anInfo = myInfos.ChangeValue (theIndex);
+      anInfo.Surface = ClearRts (BRep_Tool::Surface (TopoDS::Face (myFaces (theIndex))));
+      GeomLib_IsPlanarSurface aPlanarityChecker (anInfo.Surface, myLinTol);
+      anInfo.IsPlanar = aPlanarityChecker.IsPlanar();
+      if (anInfo.IsPlanar)
+        anInfo.Plane = aPlanarityChecker.Plan();
+    }
+
+  private:
+    UnifySurfaceInfoFunctor& operator= (const UnifySurfaceInfoFunctor&);
+
+  private:
+    const TopTools_IndexedMapOfShape& myFaces;
+    NCollection_Array1<UnifySurfaceInfo>& myInfos;
+    Standard_Real myLinTol;
+  };
+}
+
 //=======================================================================
 //function : IsSameDomain
 //purpose  : 
 //=======================================================================
 static Standard_Boolean IsSameDomain(const TopoDS_Face& aFace,
                                      const TopoDS_Face& aCheckedFace,
+                                     const UnifySurfaceInfo& theInfo1,
+                                     const UnifySurfaceInfo& theInfo2,
                                      const Standard_Real theLinTol,
                                      const Standard_Real theAngTol,
                                      ShapeUpgrade_UnifySameDomain::DataMapOfFacePlane& theFacePlaneMap)
@@ -1340,11 +1441,8 @@ static Standard_Boolean IsSameDomain(const TopoDS_Face& aFace,
   if (S1 == S2 && L1 == L2)
     return Standard_True;
 
-  S1 = BRep_Tool::Surface(aFace);
-  S2 = BRep_Tool::Surface(aCheckedFace);
-
-  S1 = ClearRts(S1);
-  S2 = ClearRts(S2);
+  S1 = theInfo1.Surface;
+  S2 = theInfo2.Surface;
 
   //Handle(Geom_OffsetSurface) aGOFS1, aGOFS2;
   //aGOFS1 = Handle(Geom_OffsetSurface)::DownCast(S1);
@@ -1354,12 +1452,10 @@ static Standard_Boolean IsSameDomain(const TopoDS_Face& aFace,
 
   // case of two planar surfaces:
   // all kinds of surfaces checked, including b-spline and bezier
-  GeomLib_IsPlanarSurface aPlanarityChecker1(S1, theLinTol);
-  if (aPlanarityChecker1.IsPlanar()) {
-    GeomLib_IsPlanarSurface aPlanarityChecker2(S2, theLinTol);
-    if (aPlanarityChecker2.IsPlanar()) {
-      gp_Pln aPln1 = aPlanarityChecker1.Plan();
-      gp_Pln aPln2 = aPlanarityChecker2.Plan();
+  if (theInfo1.IsPlanar) {
+    if (theInfo2.IsPlanar) {
+      const gp_Pln& aPln1 = theInfo1.Plane;
+      const gp_Pln& aPln2 = theInfo2.Plane;
 
       if (aPln1.Position().Direction().IsParallel(aPln2.Position().Direction(), theAngTol) &&
         aPln1.Distance(aPln2) < theLinTol)
@@ -2634,6 +2730,7 @@ ShapeUpgrade_UnifySameDomain::ShapeUpgrade_UnifySameDomain()
     myConcatBSplines (Standard_False),
     myAllowInternal (Standard_False),
     mySafeInputMode(Standard_True),
+    myRunParallel(Standard_False),
     myHistory(new BRepTools_History)
 {
   myContext = new ShapeBuild_ReShape;
@@ -2656,6 +2753,7 @@ ShapeUpgrade_UnifySameDomain::ShapeUpgrade_UnifySameDomain(const TopoDS_Shape& a
     myConcatBSplines (ConcatBSplines),
     myAllowInternal (Standard_False),
     mySafeInputMode (Standard_True),
+    myRunParallel (Standard_False),
     myShape (aShape),
     myHistory(new BRepTools_History)
 {
@@ -2813,6 +2911,13 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(const TopoDS_Shape& theInpShape
   TopTools_IndexedDataMapOfShapeListOfShape aMapEdgeFaces;
   TopExp::MapShapesAndAncestors(theInpShape, TopAbs_EDGE, TopAbs_FACE, aMapEdgeFaces);
 
+  // analyze the surfaces of all faces once
+  TopTools_IndexedMapOfShape aFaceMap;
+  TopExp::MapShapes (theInpShape, TopAbs_FACE, aFaceMap);
+  NCollection_Array1<UnifySurfaceInfo> aSurfInfos (1, Max (aFaceMap.Extent(), 1));
+  UnifySurfaceInfoFunctor aSurfInfoFunctor (aFaceMap, aSurfInfos, myLinTol);
+  OSD_Parallel::For (1, aFaceMap.Extent() + 1, aSurfInfoFunctor, !myRunParallel);
+
   // map of processed shapes
   TopTools_MapOfShape aProcessed;
 
@@ -2830,7 +2935,13 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(const TopoDS_Shape& theInpShape
     TopTools_SequenceOfShape RemovedEdges;
 
     Standard_Integer dummy;
-    AddOrdinaryEdges(edges, aFace, dummy, RemovedEdges);
+
+    // Boundary edges collected during the search of the faces to unify;
+    // the edges dropped from the boundary are removed only from the map
+    NCollection_Vector<TopoDS_Shape> aBoundEdges;
+    TopTools_DataMapOfShapeInteger aBoundEdgeIndices;
+    AddOrdinaryEdges(aBoundEdges, aBoundEdgeIndices, aFace, RemovedEdges);
+    const UnifySurfaceInfo& aSurfInfo = aSurfInfos (aFaceMap.FindIndex (aFace));
 
     // Faces to get unified with the current faces
     TopTools_SequenceOfShape faces;
@@ -2857,8 +2968,12 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(const TopoDS_Shape& theInpShape
 
     // find adjacent faces to union
     Standard_Integer i;
-    for (i = 1; i <= edges.Length(); i++) {
-      TopoDS_Edge edge = TopoDS::Edge(edges(i));
+    for (Standard_Integer anEdgeIndex = 0; anEdgeIndex < aBoundEdges.Length(); anEdgeIndex++) {
+      const Standard_Integer* aBoundIndex = aBoundEdgeIndices.Seek (aBoundEdges (anEdgeIndex));
+      if (aBoundIndex == NULL || *aBoundIndex != anEdgeIndex)
+        continue; // already dropped from the boundary
+
+      TopoDS_Edge edge = TopoDS::Edge(aBoundEdges (anEdgeIndex));
       if (BRep_Tool::Degenerated(edge))
         continue;
 
@@ -2915,12 +3030,11 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(const TopoDS_Shape& theInpShape
           }
         }
         //
-        if (IsSameDomain(aFace,aCheckedFace, myLinTol, myAngTol, myFacePlaneMap)) {
+        if (IsSameDomain(aFace, aCheckedFace,
+                         aSurfInfo, aSurfInfos (aFaceMap.FindIndex (aCheckedFace)),
+                         myLinTol, myAngTol, myFacePlaneMap)) {
 
-          if (AddOrdinaryEdges(edges, aCheckedFace, dummy, RemovedEdges)) {
-            // sequence edges is modified
-            i = dummy;
-          }
+          AddOrdinaryEdges(aBoundEdges, aBoundEdgeIndices, aCheckedFace, RemovedEdges);
 
           faces.Append(aCheckedFace);
           aProcessed.Add(aCheckedFace);
@@ -2929,6 +3043,12 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(const TopoDS_Shape& theInpShape
       }
     }
 
+    for (Standard_Integer anEdgeIndex = 0; anEdgeIndex < aBoundEdges.Length(); anEdgeIndex++) {
+      const Standard_Integer* aBoundIndex = aBoundEdgeIndices.Seek (aBoundEdges (anEdgeIndex));
+      if (aBoundIndex != NULL && *aBoundIndex == anEdgeIndex)
+        edges.Append (aBoundEdges (anEdgeIndex));
+    }
+
     if (faces.Length() > 1) {
       if (myFacePlaneMap.IsBound(faces(1)))
       {
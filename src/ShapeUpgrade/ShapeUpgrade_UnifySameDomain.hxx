@@ -130,6 +130,23 @@ public:
     myAngTol = (theValue < Precision::Angular() ? Precision::Angular() : theValue);
   }
 
+  //! Sets the flag of parallel processing.
+  //! In parallel mode the surfaces of the faces are analyzed concurrently
+  //! before the search of the faces to unify. The search itself and the
+  //! unification of the found groups of faces remain sequential, because
+  //! the unification of a group modifies the edges shared with the neighbour
+  //! groups. Default value is false.
+  void SetRunParallel (const Standard_Boolean theIsParallel)
+  {
+    myRunParallel = theIsParallel;
+  }
+
+  //! Returns the flag of parallel processing.
+  Standard_Boolean RunParallel() const
+  {
+    return myRunParallel;
+  }
+
   //! Performs unification and builds the resulting shape.
   Standard_EXPORT void Build();
   
@@ -215,6 +232,7 @@ private:
   Standard_Boolean myConcatBSplines;
   Standard_Boolean myAllowInternal;
   Standard_Boolean mySafeInputMode;
+  Standard_Boolean myRunParallel;
   TopoDS_Shape myShape;
   Handle(ShapeBuild_ReShape) myContext;
   TopTools_MapOfShape myKeepShapes;